@@ -504,8 +504,42 @@ static void new_generator_output2(const std::string& file, const std::vector<uin
     }
 }
 
+static void new_generator_output_indexed(const std::string& file1, const std::string& file2, const std::string& file3,
+                                         std::map<uint32_t, uint32_t>& map)
+{
+    // Three-stage tables for 32-bit data where a lot of blocks are different so 32-bit stage2 is too big.
+    // stage3 contains only unique values and stage2 contains 16-bit indexes to them (0 - no data).
+    // The same as stage3 in new_generator_script() but the values are collected from the data here.
+    // The lookup is one more array access: stage3[stages(c, stage1, stage2)]
+
+    std::map<uint32_t, uint32_t> map_index;
+    std::map<uint32_t, uint32_t> value_index;
+    std::vector<uint32_t> vec(1, 0);
+
+    for (uint32_t c = 0; c <= 0x10FFFF; ++c)
+    {
+        map_index[c] = 0;
+
+        if (map.at(c) == 0)
+            continue;
+
+        if (!value_index.count(map.at(c)))
+        {
+            value_index[map.at(c)] = (uint32_t)vec.size();
+            vec.push_back(map.at(c));
+        }
+        map_index.at(c) = value_index.at(map.at(c));
+    }
+
+    ASSERTX(vec.size() <= 0xFFFF);
+
+    new_generator_output(file1, file2, 8, 16, true, map_index, 0x10FFFF); // stage1/2
+    new_generator_output2(file3, vec, 32); // stage3
+}
+
 static void new_generator_unicodedata_decompose_ccc_qc(const std::string& file1, const std::string& file2, const std::string& file3, bool compat,
-                                                       const std::string& file4 = {}, const std::string& file5 = {})
+                                                       const std::string& file4 = {}, const std::string& file5 = {}, const std::string& file6 = {},
+                                                       const std::string& file7 = {}, const std::string& file8 = {}, const std::string& file9 = {})
 {
     // https://www.unicode.org/reports/tr44/#UnicodeData.txt
     std::ifstream input("UnicodeData.txt", std::ios::binary);
@@ -589,6 +623,11 @@ static void new_generator_unicodedata_decompose_ccc_qc(const std::string& file1,
         }
     }
 
+    // Keep NFD data to merge offsets to it with ccc_qc data below
+    std::map<uint32_t, std::vector<uint32_t>> map_vec_nfd;
+    if (compat)
+        map_vec_nfd = map_vec;
+
     // And add code points in NFKD
     if (compat)
     {
@@ -698,7 +737,9 @@ static void new_generator_unicodedata_decompose_ccc_qc(const std::string& file1,
         }
     }
 
-    new_generator_output(file1, file2, 8, 16, true, map, 0x10FFFF);
+    // NFD stage1/stage2 data is merged with ccc_qc data so only stage3 is generated for it
+    if (!file1.empty())
+        new_generator_output(file1, file2, 8, 16, true, map, 0x10FFFF);
     new_generator_output2(file3, vec);
 
     // Generate ccc_qc data here too because we need map_vec with NFKD data generated before
@@ -864,7 +905,37 @@ static void new_generator_unicodedata_decompose_ccc_qc(const std::string& file1,
             }
         }
 
-        new_generator_output(file4, file5, 8, 16, true, map, 0x10FFFF);
+        // Merge offsets to decomposed code points in NFD (stage3_decomp_nfd) to bits 16-31,
+        // so NFC/NFD algorithms get CCC, Quick_Check and decomposition with a single lookup.
+        // Offsets must be calculated exactly the same way as for stage3 data above.
+        uint32_t offset = 1;
+        for (uint32_t c = 0; c <= 0x10FFFF; ++c)
+        {
+            if (map_vec_nfd.count(c))
+            {
+                map.at(c) |= offset << 16;
+                offset += 1 + (uint32_t)map_vec_nfd.at(c).size();
+            }
+        }
+        ASSERTX(offset <= 0xFFFF);
+
+        // Every code point with a decomposition has its own offset so 32-bit data in stage2 would
+        // double its size, use 16-bit indexes to unique values in stage3 instead (see the function).
+        new_generator_output_indexed(file4, file5, file6, map);
+
+        // The same data without NFKC/NFKD Quick_Check bits for the builds with UNI_ALGO_DISABLE_NFKC_NFKD.
+        // These bits are used only by NFKC/NFKD functions so without them a lot more blocks are the same
+        // and stage2 is smaller. Initial/trailing non-starters in NFKD must stay because they are needed
+        // for Stream-Safe Text Format in all normalization forms.
+        // This is the only data that can be reduced for such builds: NFKD decomposition data is not used there
+        // at all and the rest (composition, NFD decomposition and ccc_qc data) is needed by NFC itself.
+        if (!file7.empty())
+        {
+            for (uint32_t c = 0; c <= 0x10FFFF; ++c)
+                map.at(c) &= ~((uint32_t)1 << 10 | (uint32_t)1 << 11);
+
+            new_generator_output_indexed(file7, file8, file9, map);
+        }
     }
 }
 
@@ -1986,9 +2057,10 @@ static void new_generator()
 
     new_generator_unicodedata_compose("new_stage1_comp_cp1.txt", "new_stage2_comp_cp1.txt",
                                       "new_stage1_comp_cp2.txt", "new_stage2_comp_cp2.txt", "new_stage3_comp.txt");
-    new_generator_unicodedata_decompose_ccc_qc("new_stage1_decomp_nfd.txt", "new_stage2_decomp_nfd.txt", "new_stage3_decomp_nfd.txt", false);
+    new_generator_unicodedata_decompose_ccc_qc("", "", "new_stage3_decomp_nfd.txt", false);
     new_generator_unicodedata_decompose_ccc_qc("new_stage1_decomp_nfkd.txt", "new_stage2_decomp_nfkd.txt", "new_stage3_decomp_nfkd.txt", true,
-                                               "new_stage1_ccc_qc.txt", "new_stage2_ccc_qc.txt");
+                                               "new_stage1_ccc_qc_decomp.txt", "new_stage2_ccc_qc_decomp.txt", "new_stage3_ccc_qc_decomp.txt",
+                                               "new_stage1_ccc_qc_decomp_canon.txt", "new_stage2_ccc_qc_decomp_canon.txt", "new_stage3_ccc_qc_decomp_canon.txt");
 
     new_generator_break_grapheme("new_stage1_break_grapheme.txt", "new_stage2_break_grapheme.txt");
     new_generator_break_word("new_stage1_break_word.txt", "new_stage2_break_word.txt");
@@ -2101,10 +2173,12 @@ static void new_merger()
     data1 = std::string(std::istreambuf_iterator<char>(input1), std::istreambuf_iterator<char>());
     data2 = std::string(std::istreambuf_iterator<char>(input2), std::istreambuf_iterator<char>());
 
-    new_merger_replace_string(data1, data2, "new_stage1_ccc_qc.txt");
-    new_merger_replace_string(data1, data2, "new_stage2_ccc_qc.txt");
-    new_merger_replace_string(data1, data2, "new_stage1_decomp_nfd.txt");
-    new_merger_replace_string(data1, data2, "new_stage2_decomp_nfd.txt");
+    new_merger_replace_string(data1, data2, "new_stage1_ccc_qc_decomp.txt");
+    new_merger_replace_string(data1, data2, "new_stage2_ccc_qc_decomp.txt");
+    new_merger_replace_string(data1, data2, "new_stage3_ccc_qc_decomp.txt");
+    new_merger_replace_string(data1, data2, "new_stage1_ccc_qc_decomp_canon.txt");
+    new_merger_replace_string(data1, data2, "new_stage2_ccc_qc_decomp_canon.txt");
+    new_merger_replace_string(data1, data2, "new_stage3_ccc_qc_decomp_canon.txt");
     new_merger_replace_string(data1, data2, "new_stage3_decomp_nfd.txt");
     new_merger_replace_string(data1, data2, "new_stage1_decomp_nfkd.txt");
     new_merger_replace_string(data1, data2, "new_stage2_decomp_nfkd.txt");
@@ -11,11 +11,15 @@
 
 #include <string>
 #include <string_view>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
 #include <cassert>
 
 #include "config.h"
 #include "internal/safe_layer.h"
 #include "internal/search.h"
+#include "internal/simd.h"
 
 // Clang-Tidy thinks that locale.h form C is included here
 // NOLINTNEXTLINE(modernize-deprecated-headers, hicpp-deprecated-headers)
@@ -30,13 +34,66 @@ namespace una {
 
 namespace detail {
 
+#if !defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+// Contiguous case mapping with SIMD fast path for default lowercase, uppercase and case folding.
+// SIMD maps the ASCII prefix and low-level does the rest starting at the first non-ASCII byte.
+// Lowercase needs the text before Final_Sigma so low-level starts at the last cased letter
+// of the prefix instead, it maps the letter and everything after it the same way again,
+// so the result is always the same as if the whole string was given to low-level.
+// If Ascii is false it is just one low-level call, locale case mapping always uses this path.
+template<typename Dst, typename Src,
+#if defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnMap)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer, int, type_codept),
+#else // Safe layer
+    size_t(*FnMap)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>, int, type_codept),
+#endif
+    bool Ascii>
+uaiw_constexpr std::size_t t_map_simd(const Src& src, typename Dst::pointer dst, std::size_t dst_size, int mode, type_codept loc)
+{
+    const typename Src::const_pointer s = src.data();
+    const std::size_t n = src.size();
+
+    std::size_t i = 0; // Position where low-level starts
+    if constexpr (Ascii)
+    {
+        assert(loc == 0);
+        assert(mode == impl_case_map_mode_lowercase ||
+               mode == impl_case_map_mode_uppercase ||
+               mode == impl_case_map_mode_casefold);
+
+        i = simd::ascii_case(s, n, dst, mode == impl_case_map_mode_uppercase);
+        if (i == n)
+            return n;
+
+        if (mode == impl_case_map_mode_lowercase)
+        {
+            std::size_t j = i;
+            while (j > 0 && !((s[j - 1] >= 'A' && s[j - 1] <= 'Z') || (s[j - 1] >= 'a' && s[j - 1] <= 'z')))
+                --j;
+            if (j > 0)
+                i = j - 1;
+        }
+    }
+
+#if defined(UNI_ALGO_FORCE_C_POINTERS)
+    (void)dst_size;
+    return i + FnMap(s + i, s + n, dst + i, mode, loc);
+#else // Safe layer
+    return i + FnMap(safe::in{s + i, n - i}, safe::end{s + n}, safe::out{dst + i, dst_size - i}, mode, loc);
+#endif
+}
+#endif
+
 template<typename Dst, typename Src, size_t SizeX,
 #if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
-    size_t(*FnMap)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator, int, type_codept)>
+    size_t(*FnMap)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator, int, type_codept),
+    bool Ascii = false>
 #elif defined(UNI_ALGO_FORCE_C_POINTERS)
-    size_t(*FnMap)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer, int, type_codept)>
+    size_t(*FnMap)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer, int, type_codept),
+    bool Ascii = false>
 #else // Safe layer
-    size_t(*FnMap)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>, int, type_codept)>
+    size_t(*FnMap)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>, int, type_codept),
+    bool Ascii = false>
 #endif
 uaiw_constexpr void t_map(Dst & dst, const Src& src, int mode, type_codept loc = 0)
 {
@@ -58,14 +115,14 @@ uaiw_constexpr void t_map(Dst & dst, const Src& src, int mode, type_codept loc =
         dst.resize(FnMap(src.cbegin(), src.cend(), dst.begin(), mode, loc));
 #elif defined(UNI_ALGO_FORCE_C_POINTERS)
         dst.resize(length * SizeX);
-        dst.resize(FnMap(src.data(), src.data() + src.size(), dst.data(), mode, loc));
+        dst.resize(t_map_simd<Dst, Src, FnMap, Ascii>(src, dst.data(), dst.size(), mode, loc));
 #else // Safe layer
 #  if !defined(__cpp_lib_string_resize_and_overwrite)
         dst.resize(length * SizeX);
-        dst.resize(FnMap(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, safe::out{dst.data(), dst.size()}, mode, loc));
+        dst.resize(t_map_simd<Dst, Src, FnMap, Ascii>(src, dst.data(), dst.size(), mode, loc));
 #  else
         dst.resize_and_overwrite(length * SizeX, [&src, mode, loc](Dst::pointer p, std::size_t n) noexcept -> std::size_t {
-            return FnMap(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, safe::out{p, n}, mode, loc);
+            return t_map_simd<Dst, Src, FnMap, Ascii>(src, p, n, mode, loc);
         });
 #  endif
 #endif
@@ -78,19 +135,79 @@ uaiw_constexpr void t_map(Dst & dst, const Src& src, int mode, type_codept loc =
 
 template<typename Dst, typename Alloc, typename Src, size_t SizeX,
 #if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
-    size_t(*FnMap)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator, int, type_codept)>
+    size_t(*FnMap)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator, int, type_codept),
+    bool Ascii = false>
 #elif defined(UNI_ALGO_FORCE_C_POINTERS)
-    size_t(*FnMap)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer, int, type_codept)>
+    size_t(*FnMap)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer, int, type_codept),
+    bool Ascii = false>
 #else // Safe layer
-    size_t(*FnMap)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>, int, type_codept)>
+    size_t(*FnMap)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>, int, type_codept),
+    bool Ascii = false>
 #endif
 uaiw_constexpr Dst t_map(const Alloc& alloc, const Src& src, int mode, type_codept loc = 0)
 {
     Dst dst{alloc};
-    t_map<Dst, Src, SizeX, FnMap>(dst, src, mode, loc);
+    t_map<Dst, Src, SizeX, FnMap, Ascii>(dst, src, mode, loc);
     return dst;
 }
 
+// Append case mapping: the result is appended to an existing string so its capacity is reused,
+// the string is never shrunk. Returns the number of code units appended.
+
+template<typename Dst, typename Src, size_t SizeX,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnMap)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator, int, type_codept),
+    bool Ascii = false>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnMap)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer, int, type_codept),
+    bool Ascii = false>
+#else // Safe layer
+    size_t(*FnMap)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>, int, type_codept),
+    bool Ascii = false>
+#endif
+uaiw_constexpr std::size_t t_map_append(Dst& dst, const Src& src, int mode, type_codept loc = 0)
+{
+    const std::size_t length = src.size();
+    const std::size_t size = dst.size();
+
+    if (!length)
+        return 0;
+
+    if (length > (dst.max_size() - size) / SizeX) // Overflow protection
+    {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+
+    std::size_t written = 0;
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    dst.resize(size + length * SizeX);
+    written = FnMap(src.cbegin(), src.cend(), dst.begin() + static_cast<std::ptrdiff_t>(size), mode, loc);
+    dst.resize(size + written);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    dst.resize(size + length * SizeX);
+    written = t_map_simd<Dst, Src, FnMap, Ascii>(src, dst.data() + size, length * SizeX, mode, loc);
+    dst.resize(size + written);
+#else // Safe layer
+#  if !defined(__cpp_lib_string_resize_and_overwrite)
+    dst.resize(size + length * SizeX);
+    written = t_map_simd<Dst, Src, FnMap, Ascii>(src, dst.data() + size, length * SizeX, mode, loc);
+    dst.resize(size + written);
+#  else
+    dst.resize_and_overwrite(size + length * SizeX, [&src, &written, size, mode, loc](Dst::pointer p, std::size_t n) noexcept -> std::size_t {
+        written = t_map_simd<Dst, Src, FnMap, Ascii>(src, p + size, n - size, mode, loc);
+        return size + written;
+    });
+#  endif
+#endif
+
+    return written;
+}
+
 } // namespace detail
 
 namespace cases {
@@ -102,7 +219,17 @@ to_lowercase_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Allo
     static_assert(std::is_integral_v<UTF8>);
 
     return detail::t_map<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
-            detail::impl_x_case_map_utf8, detail::impl_case_map_loc_utf8>(alloc, source,
+            detail::impl_x_case_map_utf8, detail::impl_case_map_loc_utf8, true>(alloc, source,
+            detail::impl_case_map_mode_lowercase);
+}
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+to_lowercase_utf8(std::basic_string_view<UTF8> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_map_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_x_case_map_utf8, detail::impl_case_map_loc_utf8, true>(dst, source,
             detail::impl_case_map_mode_lowercase);
 }
 template<typename UTF16, typename Alloc = std::allocator<UTF16>>
@@ -115,6 +242,16 @@ to_lowercase_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Al
             detail::impl_x_case_map_utf16, detail::impl_case_map_loc_utf16>(alloc, source,
             detail::impl_case_map_mode_lowercase);
 }
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+to_lowercase_utf16(std::basic_string_view<UTF16> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_map_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_x_case_map_utf16, detail::impl_case_map_loc_utf16>(dst, source,
+            detail::impl_case_map_mode_lowercase);
+}
 template<typename UTF8, typename Alloc = std::allocator<UTF8>>
 uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
 to_uppercase_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
@@ -122,7 +259,17 @@ to_uppercase_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Allo
     static_assert(std::is_integral_v<UTF8>);
 
     return detail::t_map<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
-            detail::impl_x_case_map_utf8, detail::impl_case_map_loc_utf8>(alloc, source,
+            detail::impl_x_case_map_utf8, detail::impl_case_map_loc_utf8, true>(alloc, source,
+            detail::impl_case_map_mode_uppercase);
+}
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+to_uppercase_utf8(std::basic_string_view<UTF8> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_map_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_x_case_map_utf8, detail::impl_case_map_loc_utf8, true>(dst, source,
             detail::impl_case_map_mode_uppercase);
 }
 template<typename UTF16, typename Alloc = std::allocator<UTF16>>
@@ -135,6 +282,16 @@ to_uppercase_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Al
             detail::impl_x_case_map_utf16, detail::impl_case_map_loc_utf16>(alloc, source,
             detail::impl_case_map_mode_uppercase);
 }
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+to_uppercase_utf16(std::basic_string_view<UTF16> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_map_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_x_case_map_utf16, detail::impl_case_map_loc_utf16>(dst, source,
+            detail::impl_case_map_mode_uppercase);
+}
 template<typename UTF8, typename Alloc = std::allocator<UTF8>>
 uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
 to_casefold_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
@@ -142,7 +299,17 @@ to_casefold_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc
     static_assert(std::is_integral_v<UTF8>);
 
     return detail::t_map<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
-            detail::impl_x_case_map_utf8, detail::impl_case_map_loc_utf8>(alloc, source,
+            detail::impl_x_case_map_utf8, detail::impl_case_map_loc_utf8, true>(alloc, source,
+            detail::impl_case_map_mode_casefold);
+}
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+to_casefold_utf8(std::basic_string_view<UTF8> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_map_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_x_case_map_utf8, detail::impl_case_map_loc_utf8, true>(dst, source,
             detail::impl_case_map_mode_casefold);
 }
 template<typename UTF16, typename Alloc = std::allocator<UTF16>>
@@ -155,6 +322,16 @@ to_casefold_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = All
             detail::impl_x_case_map_utf16, detail::impl_case_map_loc_utf16>(alloc, source,
             detail::impl_case_map_mode_casefold);
 }
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+to_casefold_utf16(std::basic_string_view<UTF16> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_map_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_x_case_map_utf16, detail::impl_case_map_loc_utf16>(dst, source,
+            detail::impl_case_map_mode_casefold);
+}
 
 inline uaiw_constexpr std::string to_lowercase_utf8(std::string_view source)
 {
@@ -206,6 +383,16 @@ to_lowercase_utf8(std::basic_string_view<UTF8> source, const una::locale& locale
             detail::impl_x_case_map_utf8, detail::impl_case_map_locale_utf8>(alloc, source,
             detail::impl_case_map_mode_lowercase, static_cast<char32_t>(locale.get_language()));
 }
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+to_lowercase_utf8(std::basic_string_view<UTF8> source, const una::locale& locale, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_map_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_x_case_map_utf8, detail::impl_case_map_locale_utf8>(dst, source,
+            detail::impl_case_map_mode_lowercase, static_cast<char32_t>(locale.get_language()));
+}
 template<typename UTF16, typename Alloc = std::allocator<UTF16>>
 uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
 to_lowercase_utf16(std::basic_string_view<UTF16> source, const una::locale& locale, const Alloc& alloc = Alloc())
@@ -216,6 +403,16 @@ to_lowercase_utf16(std::basic_string_view<UTF16> source, const una::locale& loca
             detail::impl_x_case_map_utf16, detail::impl_case_map_locale_utf16>(alloc, source,
             detail::impl_case_map_mode_lowercase, static_cast<char32_t>(locale.get_language()));
 }
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+to_lowercase_utf16(std::basic_string_view<UTF16> source, const una::locale& locale, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_map_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_x_case_map_utf16, detail::impl_case_map_locale_utf16>(dst, source,
+            detail::impl_case_map_mode_lowercase, static_cast<char32_t>(locale.get_language()));
+}
 template<typename UTF8, typename Alloc = std::allocator<UTF8>>
 uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
 to_uppercase_utf8(std::basic_string_view<UTF8> source, const una::locale& locale, const Alloc& alloc = Alloc())
@@ -226,6 +423,16 @@ to_uppercase_utf8(std::basic_string_view<UTF8> source, const una::locale& locale
             detail::impl_x_case_map_utf8, detail::impl_case_map_locale_utf8>(alloc, source,
             detail::impl_case_map_mode_uppercase, static_cast<char32_t>(locale.get_language()));
 }
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+to_uppercase_utf8(std::basic_string_view<UTF8> source, const una::locale& locale, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_map_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_x_case_map_utf8, detail::impl_case_map_locale_utf8>(dst, source,
+            detail::impl_case_map_mode_uppercase, static_cast<char32_t>(locale.get_language()));
+}
 template<typename UTF16, typename Alloc = std::allocator<UTF16>>
 uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
 to_uppercase_utf16(std::basic_string_view<UTF16> source, const una::locale& locale, const Alloc& alloc = Alloc())
@@ -236,6 +443,16 @@ to_uppercase_utf16(std::basic_string_view<UTF16> source, const una::locale& loca
             detail::impl_x_case_map_utf16, detail::impl_case_map_locale_utf16>(alloc, source,
             detail::impl_case_map_mode_uppercase, static_cast<char32_t>(locale.get_language()));
 }
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+to_uppercase_utf16(std::basic_string_view<UTF16> source, const una::locale& locale, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_map_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_x_case_map_utf16, detail::impl_case_map_locale_utf16>(dst, source,
+            detail::impl_case_map_mode_uppercase, static_cast<char32_t>(locale.get_language()));
+}
 inline uaiw_constexpr std::string to_lowercase_utf8(std::string_view source, const una::locale& locale)
 {
     return to_lowercase_utf8<char>(source, locale);
@@ -275,6 +492,16 @@ to_titlecase_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Allo
             detail::impl_x_case_map_utf8, detail::impl_case_map_loc_utf8>(alloc, source,
             detail::impl_case_map_mode_titlecase);
 }
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+to_titlecase_utf8(std::basic_string_view<UTF8> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_map_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_x_case_map_utf8, detail::impl_case_map_loc_utf8>(dst, source,
+            detail::impl_case_map_mode_titlecase);
+}
 template<typename UTF16, typename Alloc = std::allocator<UTF16>>
 uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
 to_titlecase_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
@@ -285,6 +512,16 @@ to_titlecase_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Al
             detail::impl_x_case_map_utf16, detail::impl_case_map_loc_utf16>(alloc, source,
             detail::impl_case_map_mode_titlecase);
 }
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+to_titlecase_utf16(std::basic_string_view<UTF16> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_map_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_x_case_map_utf16, detail::impl_case_map_loc_utf16>(dst, source,
+            detail::impl_case_map_mode_titlecase);
+}
 inline uaiw_constexpr std::string to_titlecase_utf8(std::string_view source)
 {
     return to_titlecase_utf8<char>(source);
@@ -310,6 +547,16 @@ to_titlecase_utf8(std::basic_string_view<UTF8> source, const una::locale& locale
             detail::impl_x_case_map_utf8, detail::impl_case_map_locale_utf8>(alloc, source,
             detail::impl_case_map_mode_titlecase, static_cast<char32_t>(locale.get_language()));
 }
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+to_titlecase_utf8(std::basic_string_view<UTF8> source, const una::locale& locale, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_map_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_x_case_map_utf8, detail::impl_case_map_locale_utf8>(dst, source,
+            detail::impl_case_map_mode_titlecase, static_cast<char32_t>(locale.get_language()));
+}
 template<typename UTF16, typename Alloc = std::allocator<UTF16>>
 uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
 to_titlecase_utf16(std::basic_string_view<UTF16> source, const una::locale& locale, const Alloc& alloc = Alloc())
@@ -320,6 +567,16 @@ to_titlecase_utf16(std::basic_string_view<UTF16> source, const una::locale& loca
             detail::impl_x_case_map_utf16, detail::impl_case_map_locale_utf16>(alloc, source,
             detail::impl_case_map_mode_titlecase, static_cast<char32_t>(locale.get_language()));
 }
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+to_titlecase_utf16(std::basic_string_view<UTF16> source, const una::locale& locale, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_map_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_x_case_map_utf16, detail::impl_case_map_locale_utf16>(dst, source,
+            detail::impl_case_map_mode_titlecase, static_cast<char32_t>(locale.get_language()));
+}
 inline uaiw_constexpr std::string to_titlecase_utf8(std::string_view source, const una::locale& locale)
 {
     return to_titlecase_utf8<char>(source, locale);
@@ -702,6 +959,472 @@ inline uaiw_constexpr una::search search_utf16(std::wstring_view string1, std::w
 }
 #endif // WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF
 
+// Preprocessed caseless search for the same needle in many strings: the needle is case folded once
+// and Boyer-Moore-Horspool runs over case folded code points of the string, so every code point of the string
+// is decoded and folded only once, code units that cannot start a match are skipped without decoding.
+// The result is always the same as the result of una::caseless::search_utf8/utf16 for the same needle.
+class searcher
+{
+private:
+    static constexpr std::size_t local_window = 64;
+
+    std::u32string needle;
+    std::size_t window = 0;
+    detail::impl_case_searcher data{};
+
+    uaiw_constexpr void prepare(std::size_t size)
+    {
+        needle.resize(size);
+        detail::impl_case_searcher_prepare(&data, needle.data(), needle.size());
+
+        // Power of two that can hold the needle and all folded units of the last code point
+        window = 1;
+        while (window < needle.size() + detail::impl_max_case_expand - 1)
+            window *= 2;
+    }
+    template<typename UTF8>
+    uaiw_constexpr void init_utf8(std::basic_string_view<UTF8> source)
+    {
+        needle.resize(source.size() * detail::impl_max_case_expand);
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+        prepare(detail::impl_case_searcher_fold_utf8(source.cbegin(), source.cend(), needle.begin()));
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+        prepare(detail::impl_case_searcher_fold_utf8(source.data(), source.data() + source.size(), needle.data()));
+#else // Safe layer
+        namespace safe = detail::safe;
+        prepare(detail::impl_case_searcher_fold_utf8(safe::in{source.data(), source.size()}, safe::end{source.data() + source.size()},
+                                                     safe::out{needle.data(), needle.size()}));
+#endif
+    }
+    template<typename UTF16>
+    uaiw_constexpr void init_utf16(std::basic_string_view<UTF16> source)
+    {
+        needle.resize(source.size() * detail::impl_max_case_expand);
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+        prepare(detail::impl_case_searcher_fold_utf16(source.cbegin(), source.cend(), needle.begin()));
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+        prepare(detail::impl_case_searcher_fold_utf16(source.data(), source.data() + source.size(), needle.data()));
+#else // Safe layer
+        namespace safe = detail::safe;
+        prepare(detail::impl_case_searcher_fold_utf16(safe::in{source.data(), source.size()}, safe::end{source.data() + source.size()},
+                                                      safe::out{needle.data(), needle.size()}));
+#endif
+    }
+    template<class Find>
+    uaiw_constexpr una::search find(Find&& func) const
+    {
+        if (needle.empty())
+            return una::search{0, 0};
+
+        std::size_t pos = detail::impl_npos, end = detail::impl_npos;
+        bool ret = false;
+        if (window <= local_window)
+        {
+            detail::impl_case_searcher_unit units[local_window]{};
+            ret = func(units, &pos, &end);
+        }
+        else
+        {
+            std::vector<detail::impl_case_searcher_unit> units(window);
+            ret = func(units.data(), &pos, &end);
+        }
+
+        return ret ? una::search{pos, end} : una::search{};
+    }
+public:
+    uaiw_constexpr searcher() { prepare(0); }
+    uaiw_constexpr explicit searcher(std::string_view source) { init_utf8(source); }
+    uaiw_constexpr explicit searcher(std::u16string_view source) { init_utf16(source); }
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+    uaiw_constexpr explicit searcher(std::wstring_view source) { init_utf16(source); }
+#endif
+#ifdef __cpp_lib_char8_t
+    uaiw_constexpr explicit searcher(std::u8string_view source) { init_utf8(source); }
+#endif
+
+    template<typename UTF8>
+    uaiw_constexpr una::search search_utf8(std::basic_string_view<UTF8> source) const
+    {
+        static_assert(std::is_integral_v<UTF8>);
+
+        return find([this, source](detail::impl_case_searcher_unit* units, std::size_t* pos, std::size_t* end) {
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+            return detail::impl_case_searcher_utf8(&data, needle.cbegin(), source.cbegin(), source.cend(),
+                                                   units, window, pos, end);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+            return detail::impl_case_searcher_utf8(&data, needle.data(), source.data(), source.data() + source.size(),
+                                                   units, window, pos, end);
+#else // Safe layer
+            namespace safe = detail::safe;
+            return detail::impl_case_searcher_utf8(&data, safe::in{needle.data(), needle.size()},
+                                                   safe::in{source.data(), source.size()}, safe::end{source.data() + source.size()},
+                                                   units, window, pos, end);
+#endif
+        });
+    }
+    template<typename UTF16>
+    uaiw_constexpr una::search search_utf16(std::basic_string_view<UTF16> source) const
+    {
+        static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+        return find([this, source](detail::impl_case_searcher_unit* units, std::size_t* pos, std::size_t* end) {
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+            return detail::impl_case_searcher_utf16(&data, needle.cbegin(), source.cbegin(), source.cend(),
+                                                    units, window, pos, end);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+            return detail::impl_case_searcher_utf16(&data, needle.data(), source.data(), source.data() + source.size(),
+                                                    units, window, pos, end);
+#else // Safe layer
+            namespace safe = detail::safe;
+            return detail::impl_case_searcher_utf16(&data, safe::in{needle.data(), needle.size()},
+                                                    safe::in{source.data(), source.size()}, safe::end{source.data() + source.size()},
+                                                    units, window, pos, end);
+#endif
+        });
+    }
+    uaiw_constexpr una::search search_utf8(std::string_view source) const
+    {
+        return search_utf8<char>(source);
+    }
+    uaiw_constexpr una::search search_utf16(std::u16string_view source) const
+    {
+        return search_utf16<char16_t>(source);
+    }
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+    uaiw_constexpr una::search search_utf16(std::wstring_view source) const
+    {
+        return search_utf16<wchar_t>(source);
+    }
+#endif // WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF
+#ifdef __cpp_lib_char8_t
+    uaiw_constexpr una::search search_utf8(std::u8string_view source) const
+    {
+        return search_utf8<char8_t>(source);
+    }
+#endif // __cpp_lib_char8_t
+};
+
+// Multi-pattern caseless search: the patterns are case folded once and Aho-Corasick automaton is built
+// over case folded code points, then every code point of the string is decoded and folded only once
+// and all matches of all patterns are reported in a single pass.
+// Folded units in Latin range use DFA with a compressed alphabet (only units that are used by the patterns),
+// other units use goto and failure functions of the automaton.
+// Each match is the same as a match that una::caseless::search_utf8/utf16 finds for the pattern:
+// it starts at the first folded unit of a code point and ends at the last folded unit of a code point.
+// Matches are reported as func(index of the pattern, una::search) in order of the end position,
+// overlapping matches and matches of all patterns are reported, empty patterns are never reported.
+class matcher
+{
+private:
+    static constexpr std::size_t local_window = 64;
+    static constexpr detail::type_codept latin = 0x250; // Basic Latin to Latin Extended-B
+
+    std::vector<std::uint16_t> classes = std::vector<std::uint16_t>(latin, 0); // Latin unit -> DFA column
+    std::size_t columns = 1; // Column 0 is for Latin units that are not used by the patterns
+    std::vector<std::uint32_t> dfa{0}; // Latin transitions of all nodes
+    std::vector<std::uint32_t> fail{0};
+    std::vector<std::size_t> edge_first{0, 0}; // Non-Latin edges of a node: [edge_first[node], edge_first[node + 1])
+    std::vector<detail::type_codept> edge_unit;
+    std::vector<std::uint32_t> edge_next;
+    std::vector<std::uint32_t> report{0}; // The longest suffix node with patterns (the node itself or dict) or 0
+    std::vector<std::uint32_t> dict{0}; // The longest proper suffix node with patterns or 0
+    std::vector<std::size_t> depth{0}; // Number of folded units
+    std::vector<std::size_t> out_first{0, 0}; // Patterns of a node: [out_first[node], out_first[node + 1])
+    std::vector<std::size_t> out_pattern;
+    std::size_t window = 1;
+
+    template<typename Pattern>
+    uaiw_constexpr static std::u32string fold(std::basic_string_view<Pattern> source)
+    {
+        std::u32string result(source.size() * detail::impl_max_case_expand, 0);
+
+        if constexpr (sizeof(Pattern) == sizeof(char))
+        {
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+            result.resize(detail::impl_case_searcher_fold_utf8(source.cbegin(), source.cend(), result.begin()));
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+            result.resize(detail::impl_case_searcher_fold_utf8(source.data(), source.data() + source.size(), result.data()));
+#else // Safe layer
+            namespace safe = detail::safe;
+            result.resize(detail::impl_case_searcher_fold_utf8(safe::in{source.data(), source.size()}, safe::end{source.data() + source.size()},
+                                                               safe::out{result.data(), result.size()}));
+#endif
+        }
+        else
+        {
+            static_assert(sizeof(Pattern) == sizeof(char16_t), "Patterns must be UTF-8 or UTF-16 strings");
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+            result.resize(detail::impl_case_searcher_fold_utf16(source.cbegin(), source.cend(), result.begin()));
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+            result.resize(detail::impl_case_searcher_fold_utf16(source.data(), source.data() + source.size(), result.data()));
+#else // Safe layer
+            namespace safe = detail::safe;
+            result.resize(detail::impl_case_searcher_fold_utf16(safe::in{source.data(), source.size()}, safe::end{source.data() + source.size()},
+                                                                safe::out{result.data(), result.size()}));
+#endif
+        }
+
+        return result;
+    }
+    template<class Range>
+    uaiw_constexpr void build(const Range& patterns)
+    {
+        // Trie of folded patterns, edges of a node are sorted by unit
+        std::vector<std::vector<std::pair<detail::type_codept, std::uint32_t>>> trie(1);
+        std::vector<std::pair<std::uint32_t, std::size_t>> ends; // Node and index of a pattern
+
+        auto child = [&trie](std::uint32_t node, detail::type_codept c) -> std::uint32_t {
+            auto& edges = trie[node];
+            auto it = std::lower_bound(edges.begin(), edges.end(), c,
+                                       [](const auto& edge, detail::type_codept u) { return edge.first < u; });
+            return (it != edges.end() && it->first == c) ? it->second : 0;
+        };
+
+        std::size_t index = 0;
+        for (const auto& pattern : patterns)
+        {
+            using char_type = std::remove_cv_t<std::remove_reference_t<decltype(pattern[0])>>;
+            const std::u32string units = fold(std::basic_string_view<char_type>{pattern});
+            if (!units.empty())
+            {
+                std::uint32_t node = 0;
+                for (char32_t c : units)
+                {
+                    std::uint32_t next = child(node, c);
+                    if (next == 0)
+                    {
+                        next = static_cast<std::uint32_t>(trie.size());
+                        auto& edges = trie[node];
+                        edges.insert(std::lower_bound(edges.begin(), edges.end(), std::pair{c, next}), std::pair{c, next});
+                        trie.emplace_back();
+                        depth.push_back(depth[node] + 1);
+                    }
+                    node = next;
+                }
+                ends.emplace_back(node, index);
+                if (depth[node] > window)
+                    window = depth[node];
+
+                for (char32_t c : units)
+                {
+                    if (c < latin && classes[c] == 0)
+                        classes[c] = static_cast<std::uint16_t>(columns++);
+                }
+            }
+            ++index;
+        }
+
+        const std::size_t size = trie.size();
+
+        // Power of two that can hold the longest pattern
+        std::size_t pow2 = 1;
+        while (pow2 < window)
+            pow2 *= 2;
+        window = pow2;
+
+        std::sort(ends.begin(), ends.end());
+        out_first.assign(size + 1, 0);
+        for (const auto& end : ends)
+        {
+            ++out_first[end.first + 1];
+            out_pattern.push_back(end.second);
+        }
+        for (std::size_t i = 0; i < size; ++i)
+            out_first[i + 1] += out_first[i];
+
+        std::vector<detail::type_codept> column_unit(columns, 0);
+        for (detail::type_codept c = 0; c < latin; ++c)
+            column_unit[classes[c]] = c;
+
+        // Breadth-first order so failure links and DFA of shorter nodes are ready
+        fail.assign(size, 0);
+        report.assign(size, 0);
+        dict.assign(size, 0);
+        dfa.assign(size * columns, 0);
+
+        std::vector<std::uint32_t> order{0};
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            const std::uint32_t node = order[i];
+
+            for (const auto& edge : trie[node])
+            {
+                const std::uint32_t next = edge.second;
+                if (node != 0)
+                {
+                    std::uint32_t f = fail[node];
+                    while (f != 0 && child(f, edge.first) == 0)
+                        f = fail[f];
+                    fail[next] = child(f, edge.first);
+                }
+                dict[next] = report[fail[next]];
+                report[next] = (out_first[next] != out_first[next + 1]) ? next : dict[next];
+                order.push_back(next);
+            }
+
+            for (std::size_t k = 1; k < columns; ++k)
+            {
+                const std::uint32_t next = child(node, column_unit[k]);
+                dfa[node * columns + k] = (next != 0 || node == 0) ? next : dfa[fail[node] * columns + k];
+            }
+        }
+
+        edge_first.assign(size + 1, 0);
+        for (std::size_t node = 0; node < size; ++node)
+        {
+            for (const auto& edge : trie[node])
+            {
+                if (edge.first >= latin)
+                {
+                    edge_unit.push_back(edge.first);
+                    edge_next.push_back(edge.second);
+                }
+            }
+            edge_first[node + 1] = edge_unit.size();
+        }
+    }
+    uaiw_constexpr std::uint32_t next(std::uint32_t node, detail::type_codept c) const
+    {
+        if (c < latin)
+            return dfa[node * columns + classes[c]];
+
+        while (true)
+        {
+            const auto first = edge_unit.begin() + static_cast<std::ptrdiff_t>(edge_first[node]);
+            const auto last = edge_unit.begin() + static_cast<std::ptrdiff_t>(edge_first[node + 1]);
+            const auto it = std::lower_bound(first, last, c);
+            if (it != last && *it == c)
+                return edge_next[static_cast<std::size_t>(it - edge_unit.begin())];
+            if (node == 0)
+                return 0;
+            node = fail[node];
+        }
+    }
+    template<class Iter, class End, class FnNext, class Func>
+    uaiw_constexpr void scan(Iter first, End last, FnNext fn_next, std::size_t* ring, Func& func) const
+    {
+        // The ring holds the start of the code point for the first folded unit of a code point
+        // and impl_npos for others so a match can be checked that it starts on a code point
+        const std::size_t mask = window - 1;
+        std::size_t count = 0;
+        std::uint32_t node = 0;
+
+        for (Iter src = first; src != last;)
+        {
+            const std::size_t pos = static_cast<std::size_t>(src - first);
+            detail::type_codept units[detail::impl_max_case_expand] = {0};
+            std::size_t size = 0;
+            src = fn_next(src, last, units, &size);
+            const std::size_t end = static_cast<std::size_t>(src - first);
+
+            for (std::size_t i = 0; i < size; ++i, ++count)
+            {
+                ring[count & mask] = (i == 0) ? pos : detail::impl_npos;
+                node = next(node, units[i]);
+            }
+
+            // A match always ends on the last folded unit of a code point
+            for (std::uint32_t n = report[node]; n != 0; n = dict[n])
+            {
+                const std::size_t start = ring[(count - depth[n]) & mask];
+                if (start == detail::impl_npos)
+                    continue;
+
+                for (std::size_t i = out_first[n]; i < out_first[n + 1]; ++i)
+                    func(out_pattern[i], una::search{start, end});
+            }
+        }
+    }
+    template<class Func, class Scan>
+    uaiw_constexpr void find(Func& func, Scan&& scan_with) const
+    {
+        if (depth.size() == 1)
+            return;
+
+        if (window <= local_window)
+        {
+            std::size_t ring[local_window]{};
+            scan_with(ring, func);
+        }
+        else
+        {
+            std::vector<std::size_t> ring(window);
+            scan_with(ring.data(), func);
+        }
+    }
+public:
+    uaiw_constexpr matcher() = default;
+    uaiw_constexpr explicit matcher(std::initializer_list<std::string_view> patterns) { build(patterns); }
+    uaiw_constexpr explicit matcher(std::initializer_list<std::u16string_view> patterns) { build(patterns); }
+    // Range of UTF-8 or UTF-16 strings, the index of a pattern is its index in the range
+    template<class Range, class = std::enable_if_t<!std::is_convertible_v<const Range&, std::string_view> &&
+                                                   !std::is_convertible_v<const Range&, std::u16string_view>>>
+    uaiw_constexpr explicit matcher(const Range& patterns) { build(patterns); }
+
+    template<typename UTF8, class Func>
+    uaiw_constexpr void search_utf8(std::basic_string_view<UTF8> source, Func&& func) const
+    {
+        static_assert(std::is_integral_v<UTF8>);
+
+        find(func, [this, source](std::size_t* ring, auto& f) {
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+            scan(source.cbegin(), source.cend(), [](auto src, auto end, auto units, auto size) {
+                return detail::impl_case_fold_next_utf8(src, end, units, size); }, ring, f);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+            scan(source.data(), source.data() + source.size(), [](auto src, auto end, auto units, auto size) {
+                return detail::impl_case_fold_next_utf8(src, end, units, size); }, ring, f);
+#else // Safe layer
+            namespace safe = detail::safe;
+            scan(safe::in{source.data(), source.size()}, safe::end{source.data() + source.size()}, [](auto src, auto end, auto units, auto size) {
+                return detail::impl_case_fold_next_utf8(src, end, units, size); }, ring, f);
+#endif
+        });
+    }
+    template<typename UTF16, class Func>
+    uaiw_constexpr void search_utf16(std::basic_string_view<UTF16> source, Func&& func) const
+    {
+        static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+        find(func, [this, source](std::size_t* ring, auto& f) {
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+            scan(source.cbegin(), source.cend(), [](auto src, auto end, auto units, auto size) {
+                return detail::impl_case_fold_next_utf16(src, end, units, size); }, ring, f);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+            scan(source.data(), source.data() + source.size(), [](auto src, auto end, auto units, auto size) {
+                return detail::impl_case_fold_next_utf16(src, end, units, size); }, ring, f);
+#else // Safe layer
+            namespace safe = detail::safe;
+            scan(safe::in{source.data(), source.size()}, safe::end{source.data() + source.size()}, [](auto src, auto end, auto units, auto size) {
+                return detail::impl_case_fold_next_utf16(src, end, units, size); }, ring, f);
+#endif
+        });
+    }
+    template<class Func>
+    uaiw_constexpr void search_utf8(std::string_view source, Func&& func) const
+    {
+        search_utf8<char>(source, func);
+    }
+    template<class Func>
+    uaiw_constexpr void search_utf16(std::u16string_view source, Func&& func) const
+    {
+        search_utf16<char16_t>(source, func);
+    }
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+    template<class Func>
+    uaiw_constexpr void search_utf16(std::wstring_view source, Func&& func) const
+    {
+        search_utf16<wchar_t>(source, func);
+    }
+#endif // WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF
+#ifdef __cpp_lib_char8_t
+    template<class Func>
+    uaiw_constexpr void search_utf8(std::u8string_view source, Func&& func) const
+    {
+        search_utf8<char8_t>(source, func);
+    }
+#endif // __cpp_lib_char8_t
+};
+
 #ifdef UNI_ALGO_EXPERIMENTAL
 
 #ifndef UNI_ALGO_DISABLE_COLLATE
@@ -757,6 +1480,67 @@ inline uaiw_constexpr bool like_utf8(std::string_view string1, std::string_view
     return like_utf8<char>(string1, string2, escape);
 }
 
+// Precompiled pattern for like_utf8 for the same pattern that is used with many strings:
+// the literal of the pattern is case folded once and simple patterns "abc", "abc%", "%abc" and "%abc%"
+// are matched without backtracking, the result is always the same as the result of like_utf8.
+class like_pattern
+{
+private:
+    static constexpr std::size_t local_window = 64;
+
+    std::string pattern;
+    std::u32string literal;
+    detail::impl_case_like_pattern data{};
+
+    template<typename Func>
+    uaiw_constexpr bool match(Func&& func) const
+    {
+        if (data.window <= local_window)
+        {
+            detail::impl_case_searcher_unit units[local_window]{};
+            return func(units);
+        }
+
+        std::vector<detail::impl_case_searcher_unit> units(data.window);
+        return func(units.data());
+    }
+public:
+    uaiw_constexpr explicit like_pattern(std::string_view source, char32_t escape = 0)
+        : pattern{source}, literal(source.size() * detail::impl_max_case_expand, 0)
+    {
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+        literal.resize(detail::impl_case_like_compile_utf8(&data, pattern.cbegin(), pattern.cend(), '%', '_', escape, literal.begin()));
+        detail::impl_case_like_prepare(&data, literal.cbegin());
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+        literal.resize(detail::impl_case_like_compile_utf8(&data, pattern.data(), pattern.data() + pattern.size(), '%', '_', escape, literal.data()));
+        detail::impl_case_like_prepare(&data, literal.data());
+#else // Safe layer
+        namespace safe = detail::safe;
+        literal.resize(detail::impl_case_like_compile_utf8(&data, safe::in{pattern.data(), pattern.size()}, safe::end{pattern.data() + pattern.size()},
+                                                           '%', '_', escape, safe::out{literal.data(), literal.size()}));
+        detail::impl_case_like_prepare(&data, safe::in{literal.data(), literal.size()});
+#endif
+    }
+
+    uaiw_constexpr bool match_utf8(std::string_view source) const
+    {
+        return match([this, source](detail::impl_case_searcher_unit* window) {
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+            return detail::impl_case_like_match_utf8(&data, literal.cbegin(), window,
+                                                     source.cbegin(), source.cend(), std::string_view{pattern}.cbegin(), std::string_view{pattern}.cend());
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+            return detail::impl_case_like_match_utf8(&data, literal.data(), window,
+                                                     source.data(), source.data() + source.size(), pattern.data(), pattern.data() + pattern.size());
+#else // Safe layer
+            namespace safe = detail::safe;
+            return detail::impl_case_like_match_utf8(&data, safe::in{literal.data(), literal.size()}, window,
+                                                     safe::in{source.data(), source.size()}, safe::end{source.data() + source.size()},
+                                                     safe::in{pattern.data(), pattern.size()}, safe::end{pattern.data() + pattern.size()});
+#endif
+        });
+    }
+};
+
 #endif // UNI_ALGO_EXPERIMENTAL
 
 } // namespace caseless
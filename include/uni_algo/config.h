@@ -50,6 +50,8 @@
 // Disable NFKC and NFKD normalization forms (part of Normalization module).
 // These forms are rarely used and can be disabled.
 // Reduces Unicode data size by ~100 KB.
+// Note that this also switches to smaller ccc/Quick_Check data without NFKC/NFKD bits (~7 KB).
+// Other normalization data is already linked only for the used forms (header-only or --gc-sections).
 
 // ----------------------- ALL DEFINES BELOW THIS LINE DO NOT CHANGE UNICODE DATA SIZE ----------------------
 
@@ -65,6 +67,11 @@
 // it might be better to disable it and do the call manually only when needed.
 // Note that ranges (una::ranges::to_utf8/to_utf16 and such) never do shring_to_fit() call.
 
+//#define UNI_ALGO_DISABLE_SIMD
+// Disable SIMD fast paths (SSSE3/AVX2 on x86-64 with runtime detection and NEON on AArch64).
+// The results of all functions are always the same with or without SIMD fast paths
+// so the define is only usefull for tests and if runtime CPU detection is a problem.
+
 //#define UNI_ALGO_DISABLE_FULL_CASE
 // Note that this define can be deprecated in the future.
 // Disable full case mapping and use simple case mapping instead.
@@ -12,6 +12,8 @@
 #include "config.h"
 #include "internal/safe_layer.h"
 #include "internal/error.h"
+#include "internal/simd.h"
+#include "internal/bounded.h"
 
 #include "impl/impl_conv.h"
 
@@ -22,8 +24,57 @@ namespace detail {
 // Implementation details
 // There were 2 possible ways to implement the conversion: using resize or using back_inserter,
 // back_inserter was always 10-30% slower in tests even with reserve so it uses resize approach.
-// Also it doesn't use 2-pass approach: calculate converted string size and then the actual conversion.
-// This is obviously at least 50% slower, so it uses 1-pass with shrink_to_fit after.
+// The default functions use 1-pass approach: allocate memory for the worst case, convert
+// and then shrink_to_fit, it is the fastest one but it allocates more memory than needed for a while.
+// 2-pass approach: calculate converted string size and then the actual conversion is at least 50% slower
+// but it allocates memory only once for the exact size, it is used by una::exact functions (see below).
+
+#if !defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+// Contiguous UTF-8 -> UTF-16/UTF-32 conversion with SIMD fast path.
+// SIMD transcodes valid parts (only ASCII blocks for UTF-32) and everything between them is given to low-level
+// in pieces that always end on a code point boundary so the result and the error position
+// are the same as if the whole string was given to low-level.
+// For other conversions or if SIMD is not available it is just one low-level call.
+template<typename Dst, typename Src,
+#if defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer, size_t*)>
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>, size_t*)>
+#endif
+uaiw_constexpr std::size_t t_utf_simd(const Src& src, typename Dst::pointer dst, std::size_t dst_size, std::size_t* error)
+{
+    using src_type = typename Src::value_type;
+    using dst_type = typename Dst::value_type;
+
+    const typename Src::const_pointer s = src.data();
+    const std::size_t n = src.size();
+
+    std::size_t i = 0; // Source position
+    std::size_t o = 0; // Destination position
+    while (i < n)
+    {
+        std::size_t written = 0;
+        i += simd::utf8to(s + i, n - i, dst + o, dst_size - o, &written);
+        o += written;
+        if (i == n)
+            break;
+
+        const std::size_t next = i + simd::utf8to_next<src_type, dst_type>(s + i, n - i);
+#if defined(UNI_ALGO_FORCE_C_POINTERS)
+        o += FnUTF(s + i, s + next, dst + o, error);
+#else // Safe layer
+        o += FnUTF(safe::in{s + i, next - i}, safe::end{s + next}, safe::out{dst + o, dst_size - o}, error);
+#endif
+        if (error && *error != impl_npos)
+        {
+            *error += i;
+            break;
+        }
+        i = next;
+    }
+    return o;
+}
+#endif
 
 template<typename Dst, typename Alloc, typename Src, size_t SizeX,
 #if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
@@ -55,14 +106,14 @@ uaiw_constexpr Dst t_utf(const Alloc& alloc, const Src& src)
         dst.resize(FnUTF(src.cbegin(), src.cend(), dst.begin(), nullptr));
 #elif defined(UNI_ALGO_FORCE_C_POINTERS)
         dst.resize(length * SizeX);
-        dst.resize(FnUTF(src.data(), src.data() + src.size(), dst.data(), nullptr));
+        dst.resize(t_utf_simd<Dst, Src, FnUTF>(src, dst.data(), dst.size(), nullptr));
 #else // Safe layer
 #  if !defined(__cpp_lib_string_resize_and_overwrite)
         dst.resize(length * SizeX);
-        dst.resize(FnUTF(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, safe::out{dst.data(), dst.size()}, nullptr));
+        dst.resize(t_utf_simd<Dst, Src, FnUTF>(src, dst.data(), dst.size(), nullptr));
 #  else
         dst.resize_and_overwrite(length * SizeX, [&src](Dst::pointer p, std::size_t n) noexcept -> std::size_t {
-            return FnUTF(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, safe::out{p, n}, nullptr);
+            return t_utf_simd<Dst, Src, FnUTF>(src, p, n, nullptr);
         });
 #  endif
 #endif
@@ -109,15 +160,15 @@ uaiw_constexpr Dst t_utf(const Alloc& alloc, const Src& src, una::error& error)
         const std::size_t size = FnUTF(src.cbegin(), src.cend(), dst.begin(), &err);
 #elif defined(UNI_ALGO_FORCE_C_POINTERS)
         dst.resize(length * SizeX);
-        const std::size_t size = FnUTF(src.data(), src.data() + src.size(), dst.data(), &err);
+        const std::size_t size = t_utf_simd<Dst, Src, FnUTF>(src, dst.data(), dst.size(), &err);
 #else // Safe layer
 #  if !defined(__cpp_lib_string_resize_and_overwrite)
         dst.resize(length * SizeX);
-        const std::size_t size = FnUTF(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, safe::out{dst.data(), dst.size()}, &err);
+        const std::size_t size = t_utf_simd<Dst, Src, FnUTF>(src, dst.data(), dst.size(), &err);
 #  else
         std::size_t size = 0;
         dst.resize_and_overwrite(length * SizeX, [&src, &size, &err](Dst::pointer p, std::size_t n) noexcept -> std::size_t {
-            size = FnUTF(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, safe::out{p, n}, &err);
+            size = t_utf_simd<Dst, Src, FnUTF>(src, p, n, &err);
             return size;
         });
 #  endif
@@ -135,10 +186,853 @@ uaiw_constexpr Dst t_utf(const Alloc& alloc, const Src& src, una::error& error)
 #endif
     }
 
-    return dst;
+    return dst;
+}
+
+// Append conversion: the result is appended to an existing string so its capacity is reused,
+// the string is never shrunk. Returns the number of code units appended.
+
+template<typename Dst, typename Src, size_t SizeX,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnUTF)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer, size_t*)>
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>, size_t*)>
+#endif
+uaiw_constexpr std::size_t t_utf_append(Dst& dst, const Src& src, std::size_t* error = nullptr)
+{
+    const std::size_t length = src.size();
+    const std::size_t size = dst.size();
+
+    if (!length)
+        return 0;
+
+    if (length > (dst.max_size() - size) / SizeX) // Overflow protection
+    {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+
+    std::size_t written = 0;
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    dst.resize(size + length * SizeX);
+    written = FnUTF(src.cbegin(), src.cend(), dst.begin() + static_cast<std::ptrdiff_t>(size), error);
+    dst.resize(size + written);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    dst.resize(size + length * SizeX);
+    written = t_utf_simd<Dst, Src, FnUTF>(src, dst.data() + size, length * SizeX, error);
+    dst.resize(size + written);
+#else // Safe layer
+#  if !defined(__cpp_lib_string_resize_and_overwrite)
+    dst.resize(size + length * SizeX);
+    written = t_utf_simd<Dst, Src, FnUTF>(src, dst.data() + size, length * SizeX, error);
+    dst.resize(size + written);
+#  else
+    dst.resize_and_overwrite(size + length * SizeX, [&src, &written, size, error](Dst::pointer p, std::size_t n) noexcept -> std::size_t {
+        written = t_utf_simd<Dst, Src, FnUTF>(src, p + size, n - size, error);
+        return size + written;
+    });
+#  endif
+#endif
+
+    // Strict mode: nothing is appended if there is an error
+    if (error && *error != impl_npos)
+    {
+        dst.resize(size);
+        return 0;
+    }
+
+    return written;
+}
+
+template<typename Dst, typename Src, size_t SizeX,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnUTF)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer, size_t*)>
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>, size_t*)>
+#endif
+uaiw_constexpr std::size_t t_utf_append(Dst& dst, const Src& src, una::error& error)
+{
+    error.reset();
+
+    std::size_t err = impl_npos;
+
+    const std::size_t written = t_utf_append<Dst, Src, SizeX, FnUTF>(dst, src, &err);
+
+    if (err != impl_npos)
+        error = una::error{una::error::code::ill_formed_utf, err};
+
+    return written;
+}
+
+// Exact size conversion: 2-pass approach, the result length is counted first and then memory is allocated
+// only once for the exact size so it uses less memory than 1-pass approach but it is slower.
+// The result and the error position are the same because the counting uses the same low-level functions
+// with an output iterator that only counts code units and SIMD counts only valid parts.
+
+class count_out
+{
+private:
+    std::size_t count = 0;
+
+    struct proxy
+    {
+        template<typename T>
+        uaiw_constexpr proxy& operator=(T) { return *this; } // no-op
+    };
+
+public:
+    uaiw_constexpr proxy operator*() { return proxy{}; }
+    uaiw_constexpr count_out operator++(int)
+    {
+        count_out temp{*this};
+        ++count;
+        return temp;
+    }
+    uaiw_constexpr std::size_t operator-(const count_out& rhs) const { return count - rhs.count; }
+};
+
+template<typename Dst, typename Src,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnCount)(typename Src::const_iterator, typename Src::const_iterator, count_out, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnCount)(typename Src::const_pointer, typename Src::const_pointer, count_out, size_t*)>
+#else // Safe layer
+    size_t(*FnCount)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, count_out, size_t*)>
+#endif
+uaiw_constexpr std::size_t t_utf_count(const Src& src, std::size_t* error)
+{
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    return FnCount(src.cbegin(), src.cend(), count_out{}, error);
+#else
+    using src_type = typename Src::value_type;
+    using dst_type = typename Dst::value_type;
+
+    const typename Src::const_pointer s = src.data();
+    const std::size_t n = src.size();
+
+    std::size_t i = 0; // Source position
+    std::size_t count = 0;
+    while (i < n)
+    {
+        i += simd::count_prefix<src_type, dst_type>(s + i, n - i, &count);
+        if (i == n)
+            break;
+
+        const std::size_t next = i + simd::count_prefix_next<src_type, dst_type>(s + i, n - i);
+#if defined(UNI_ALGO_FORCE_C_POINTERS)
+        count += FnCount(s + i, s + next, count_out{}, error);
+#else // Safe layer
+        count += FnCount(safe::in{s + i, next - i}, safe::end{s + next}, count_out{}, error);
+#endif
+        if (error && *error != impl_npos)
+        {
+            *error += i;
+            break;
+        }
+        i = next;
+    }
+
+    return count;
+#endif
+}
+
+template<typename Dst, typename Alloc, typename Src,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnUTF)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator, size_t*),
+    size_t(*FnCount)(typename Src::const_iterator, typename Src::const_iterator, count_out, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer, size_t*),
+    size_t(*FnCount)(typename Src::const_pointer, typename Src::const_pointer, count_out, size_t*)>
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>, size_t*),
+    size_t(*FnCount)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, count_out, size_t*)>
+#endif
+uaiw_constexpr Dst t_utf_exact(const Alloc& alloc, const Src& src, std::size_t* error)
+{
+    Dst dst{alloc};
+
+    if (src.size())
+    {
+        const std::size_t size = t_utf_count<Dst, Src, FnCount>(src, error);
+        if (error && *error != impl_npos)
+            return dst;
+
+        if (size > dst.max_size()) // Overflow protection
+        {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+            throw std::bad_alloc();
+#else
+            std::abort();
+#endif
+        }
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+        dst.resize(size);
+        FnUTF(src.cbegin(), src.cend(), dst.begin(), nullptr);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+        dst.resize(size);
+        t_utf_simd<Dst, Src, FnUTF>(src, dst.data(), dst.size(), nullptr);
+#else // Safe layer
+#  if !defined(__cpp_lib_string_resize_and_overwrite)
+        dst.resize(size);
+        t_utf_simd<Dst, Src, FnUTF>(src, dst.data(), dst.size(), nullptr);
+#  else
+        dst.resize_and_overwrite(size, [&src](Dst::pointer p, std::size_t n) noexcept -> std::size_t {
+            return t_utf_simd<Dst, Src, FnUTF>(src, p, n, nullptr);
+        });
+#  endif
+#endif
+    }
+
+    return dst;
+}
+
+template<typename Dst, typename Alloc, typename Src,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnUTF)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator, size_t*),
+    size_t(*FnCount)(typename Src::const_iterator, typename Src::const_iterator, count_out, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer, size_t*),
+    size_t(*FnCount)(typename Src::const_pointer, typename Src::const_pointer, count_out, size_t*)>
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>, size_t*),
+    size_t(*FnCount)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, count_out, size_t*)>
+#endif
+uaiw_constexpr Dst t_utf_exact(const Alloc& alloc, const Src& src, una::error& error)
+{
+    error.reset();
+
+    std::size_t err = impl_npos;
+
+    // The string is not allocated at all if there is an error
+    Dst dst = t_utf_exact<Dst, Alloc, Src, FnUTF, FnCount>(alloc, src, &err);
+    if (err != impl_npos)
+        error = una::error{una::error::code::ill_formed_utf, err};
+
+    return dst;
+}
+
+// Conversion of a buffer to a buffer, used by streaming and bounded conversion
+template<typename Src, typename Dst,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnUTF)(typename std::basic_string_view<Src>::const_iterator, typename std::basic_string_view<Src>::const_iterator, Dst*, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(const Src*, const Src*, Dst*, size_t*)>
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<const Src*>, safe::end<const Src*>, safe::out<Dst*>, size_t*)>
+#endif
+uaiw_constexpr std::size_t t_utf_ptr(const Src* s, std::size_t n, Dst* dst, std::size_t dst_size, std::size_t* error)
+{
+    const std::basic_string_view<Src> src{s, n};
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    (void)dst_size;
+    return FnUTF(src.cbegin(), src.cend(), dst, error);
+#else
+    return t_utf_simd<std::basic_string<Dst>, std::basic_string_view<Src>, FnUTF>(src, dst, dst_size, error);
+#endif
+}
+
+// Streaming conversion: a chunk is converted to a caller buffer and an incomplete sequence at the end
+// of the chunk is carried over to the next chunk. The split is always before a code unit where low-level
+// starts a new sequence anyway (UTF-8 lead byte or UTF-16 high surrogate) so the result and the error
+// position are the same as if the whole stream was given to low-level at once.
+
+template<typename Src, typename Dst, std::size_t SrcUTF, size_t SizeX,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnUTF)(typename std::basic_string_view<Src>::const_iterator, typename std::basic_string_view<Src>::const_iterator, Dst*, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(const Src*, const Src*, Dst*, size_t*)>
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<const Src*>, safe::end<const Src*>, safe::out<Dst*>, size_t*)>
+#endif
+class conv_stream
+{
+    static_assert(std::is_integral_v<Src>);
+    static_assert(std::is_integral_v<Dst>);
+
+private:
+    static constexpr std::size_t max_carry = (SrcUTF == 8) ? 3 : (SrcUTF == 16) ? 1 : 0;
+
+    Src carry[max_carry + 1] = {};
+    std::size_t carry_size = 0;
+    std::size_t stream_pos = 0; // Number of code units in the stream that have been converted
+    std::size_t stream_error = impl_npos;
+
+    uaiw_constexpr std::size_t convert(const Src* s, std::size_t n, Dst* dst, std::size_t dst_size, std::size_t* error)
+    {
+        if (n == 0)
+            return 0;
+
+        const std::size_t written = t_utf_ptr<Src, Dst, FnUTF>(s, n, dst, dst_size, error);
+        if (error && *error != impl_npos)
+            *error += stream_pos;
+        else
+            stream_pos += n;
+
+        return written;
+    }
+
+    uaiw_constexpr std::size_t t_feed(std::basic_string_view<Src> chunk, Dst* dst, std::size_t dst_size, std::size_t* error)
+    {
+        assert(dst_size >= buffer_size(chunk.size()));
+
+        std::size_t written = 0;
+
+        // Complete the carried sequence with the first code units of the chunk
+        if constexpr (max_carry > 0)
+        {
+            while (carry_size && !chunk.empty())
+            {
+                carry[carry_size++] = chunk.front();
+                chunk.remove_prefix(1);
+
+                const std::size_t keep = utf_tail<SrcUTF>(carry, carry_size);
+                if (keep == carry_size)
+                    continue;
+
+                written += convert(carry, carry_size - keep, dst + written, dst_size - written, error);
+                if (error && *error != impl_npos)
+                    return written;
+
+                for (std::size_t i = 0; i < keep; ++i)
+                    carry[i] = carry[carry_size - keep + i];
+                carry_size = keep;
+            }
+        }
+
+        if (chunk.empty())
+            return written;
+
+        const std::size_t keep = utf_tail<SrcUTF>(chunk.data(), chunk.size());
+
+        written += convert(chunk.data(), chunk.size() - keep, dst + written, dst_size - written, error);
+        if (error && *error != impl_npos)
+            return written;
+
+        for (std::size_t i = 0; i < keep && i < max_carry; ++i) // keep <= max_carry, helps GCC to see it
+            carry[i] = chunk[chunk.size() - keep + i];
+        carry_size = keep;
+
+        return written;
+    }
+
+    uaiw_constexpr std::size_t t_finish(Dst* dst, std::size_t dst_size, std::size_t* error)
+    {
+        assert(dst_size >= buffer_size(0));
+
+        const std::size_t written = convert(carry, carry_size, dst, dst_size, error);
+        carry_size = 0;
+
+        return written;
+    }
+
+public:
+    uaiw_constexpr conv_stream() noexcept = default;
+
+    // The size of dst that is always enough for a chunk of this size
+    static uaiw_constexpr std::size_t buffer_size(std::size_t chunk_size) noexcept
+    {
+        return (chunk_size + max_carry) * SizeX;
+    }
+
+    // Converts the chunk to dst and returns the number of code units written,
+    // an incomplete sequence at the end of the chunk is carried over to the next call
+    uaiw_constexpr std::size_t feed(std::basic_string_view<Src> chunk, Dst* dst, std::size_t dst_size)
+    {
+        return t_feed(chunk, dst, dst_size, nullptr);
+    }
+    // Stops on the first ill-formed sequence, the error position is the position in the stream
+    // and all following calls return the same error until reset
+    uaiw_constexpr std::size_t feed(std::basic_string_view<Src> chunk, Dst* dst, std::size_t dst_size, una::error& error)
+    {
+        error.reset();
+
+        if (stream_error != impl_npos)
+        {
+            error = una::error{una::error::code::ill_formed_utf, stream_error};
+            return 0;
+        }
+
+        std::size_t err = impl_npos;
+        const std::size_t written = t_feed(chunk, dst, dst_size, &err);
+        if (err != impl_npos)
+        {
+            stream_error = err;
+            error = una::error{una::error::code::ill_formed_utf, err};
+        }
+        return written;
+    }
+
+    // Converts the carried incomplete sequence at the end of the stream and resets the stream position,
+    // dst must be at least buffer_size(0)
+    uaiw_constexpr std::size_t finish(Dst* dst, std::size_t dst_size)
+    {
+        const std::size_t written = t_finish(dst, dst_size, nullptr);
+        reset();
+        return written;
+    }
+    uaiw_constexpr std::size_t finish(Dst* dst, std::size_t dst_size, una::error& error)
+    {
+        error.reset();
+
+        std::size_t err = stream_error;
+        std::size_t written = 0;
+        if (err == impl_npos)
+            written = t_finish(dst, dst_size, &err);
+        if (err != impl_npos)
+            error = una::error{una::error::code::ill_formed_utf, err};
+        reset();
+        return written;
+    }
+
+    uaiw_constexpr void reset() noexcept
+    {
+        carry_size = 0;
+        stream_pos = 0;
+        stream_error = impl_npos;
+    }
+};
+
+// Bounded conversion: see t_bounded in internal/bounded.h, a boundary is any position
+// where low-level starts a new sequence anyway as in streaming conversion.
+
+template<typename Src, typename Dst, std::size_t SrcUTF,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnUTF)(typename std::basic_string_view<Src>::const_iterator, typename std::basic_string_view<Src>::const_iterator, Dst*, size_t*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(const Src*, const Src*, Dst*, size_t*)>
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<const Src*>, safe::end<const Src*>, safe::out<Dst*>, size_t*)>
+#endif
+struct conv_bounded
+{
+    // A piece returned by next() is one code point but the buffer for it is a whole SIMD block (16 ASCII
+    // at once) because the compiler cannot see that the SIMD path is never reached for such a short piece
+    static constexpr std::size_t max_segment = 16;
+
+    static uaiw_constexpr std::size_t boundary(const Src* s, std::size_t i, std::size_t /*n*/)
+    {
+        return i - utf_tail<SrcUTF>(s, i);
+    }
+    static uaiw_constexpr std::size_t next(const Src* s, std::size_t n)
+    {
+        if constexpr (SrcUTF == 8)
+        {
+            const char32_t c = static_cast<char32_t>(s[0]) & 0xFF;
+            const std::size_t length = (c >= 0xF5) ? 1 : (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : (c >= 0xC2) ? 2 : 1;
+            std::size_t i = 1;
+            while (i < length && i < n && (static_cast<char32_t>(s[i]) & 0xC0) == 0x80)
+                ++i;
+            return i;
+        }
+        else if constexpr (SrcUTF == 16)
+        {
+            return (n > 1 && utf_tail<SrcUTF>(s, 1) == 1) ? 2 : 1;
+        }
+        else
+        {
+            (void)s;
+            (void)n;
+            return 1;
+        }
+    }
+    static uaiw_constexpr std::size_t process(const Src* s, std::size_t n, Dst* dst, std::size_t dst_size, std::size_t* error)
+    {
+        return t_utf_ptr<Src, Dst, FnUTF>(s, n, dst, dst_size, error);
+    }
+};
+
+} // namespace detail
+
+// Template functions
+
+template<typename UTF8, typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf8to16(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_x_utf8to16, detail::impl_utf8to16>(alloc, source);
+}
+template<typename UTF8, typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+utf8to16(std::basic_string_view<UTF8> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_x_utf8to16, detail::impl_utf8to16>(dst, source);
+}
+template<typename UTF16, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf16to8(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_x_utf16to8, detail::impl_utf16to8>(alloc, source);
+}
+template<typename UTF16, typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+utf16to8(std::basic_string_view<UTF16> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_x_utf16to8, detail::impl_utf16to8>(dst, source);
+}
+template<typename UTF8, typename UTF32, typename Alloc = std::allocator<UTF32>>
+uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf8to32(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_x_utf8to32, detail::impl_utf8to32>(alloc, source);
+}
+template<typename UTF8, typename UTF32, typename Alloc>
+uaiw_constexpr std::size_t
+utf8to32(std::basic_string_view<UTF8> source, std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_append<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_x_utf8to32, detail::impl_utf8to32>(dst, source);
+}
+template<typename UTF32, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf32to8(std::basic_string_view<UTF32> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            detail::impl_x_utf32to8, detail::impl_utf32to8>(alloc, source);
+}
+template<typename UTF32, typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+utf32to8(std::basic_string_view<UTF32> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF32>,
+            detail::impl_x_utf32to8, detail::impl_utf32to8>(dst, source);
+}
+template<typename UTF16, typename UTF32, typename Alloc = std::allocator<UTF32>>
+uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf16to32(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_x_utf16to32, detail::impl_utf16to32>(alloc, source);
+}
+template<typename UTF16, typename UTF32, typename Alloc>
+uaiw_constexpr std::size_t
+utf16to32(std::basic_string_view<UTF16> source, std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_append<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_x_utf16to32, detail::impl_utf16to32>(dst, source);
+}
+template<typename UTF32, typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf32to16(std::basic_string_view<UTF32> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            detail::impl_x_utf32to16, detail::impl_utf32to16>(alloc, source);
+}
+template<typename UTF32, typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+utf32to16(std::basic_string_view<UTF32> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF32>,
+            detail::impl_x_utf32to16, detail::impl_utf32to16>(dst, source);
+}
+
+// Short non-template functions for std::string, std::wstring, std::u16string, std::u32string
+
+inline uaiw_constexpr std::u16string utf8to16u(std::string_view source)
+{
+    return utf8to16<char, char16_t>(source);
+}
+inline uaiw_constexpr std::string utf16to8(std::u16string_view source)
+{
+    return utf16to8<char16_t, char>(source);
+}
+inline uaiw_constexpr std::u32string utf8to32u(std::string_view source)
+{
+    return utf8to32<char, char32_t>(source);
+}
+inline uaiw_constexpr std::string utf32to8(std::u32string_view source)
+{
+    return utf32to8<char32_t, char>(source);
+}
+inline uaiw_constexpr std::u32string utf16to32u(std::u16string_view source)
+{
+    return utf16to32<char16_t, char32_t>(source);
+}
+inline uaiw_constexpr std::u16string utf32to16u(std::u32string_view source)
+{
+    return utf32to16<char32_t, char16_t>(source);
+}
+
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+inline uaiw_constexpr std::wstring utf8to16(std::string_view source)
+{
+    return utf8to16<char, wchar_t>(source);
+}
+inline uaiw_constexpr std::string utf16to8(std::wstring_view source)
+{
+    return utf16to8<wchar_t, char>(source);
+}
+inline uaiw_constexpr std::u32string utf16to32u(std::wstring_view source)
+{
+    return utf16to32<wchar_t, char32_t>(source);
+}
+inline uaiw_constexpr std::wstring utf32to16(std::u32string_view source)
+{
+    return utf32to16<char32_t, wchar_t>(source);
+}
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+inline uaiw_constexpr std::wstring utf8to32(std::string_view source)
+{
+    return utf8to32<char, wchar_t>(source);
+}
+inline uaiw_constexpr std::string utf32to8(std::wstring_view source)
+{
+    return utf32to8<wchar_t, char>(source);
+}
+inline uaiw_constexpr std::wstring utf16to32(std::u16string_view source)
+{
+    return utf16to32<char16_t, wchar_t>(source);
+}
+inline uaiw_constexpr std::u16string utf32to16u(std::wstring_view source)
+{
+    return utf32to16<wchar_t, char16_t>(source);
+}
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+
+namespace strict {
+
+// Template functions
+
+template<typename UTF8, typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf8to16(std::basic_string_view<UTF8> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_x_utf8to16, detail::impl_utf8to16>(alloc, source, error);
+}
+template<typename UTF8, typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+utf8to16(std::basic_string_view<UTF8> source, una::error& error, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_x_utf8to16, detail::impl_utf8to16>(dst, source, error);
+}
+template<typename UTF16, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf16to8(std::basic_string_view<UTF16> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_x_utf16to8, detail::impl_utf16to8>(alloc, source, error);
+}
+template<typename UTF16, typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+utf16to8(std::basic_string_view<UTF16> source, una::error& error, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_utf_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_x_utf16to8, detail::impl_utf16to8>(dst, source, error);
+}
+template<typename UTF8, typename UTF32, typename Alloc = std::allocator<UTF32>>
+uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf8to32(std::basic_string_view<UTF8> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_x_utf8to32, detail::impl_utf8to32>(alloc, source, error);
+}
+template<typename UTF8, typename UTF32, typename Alloc>
+uaiw_constexpr std::size_t
+utf8to32(std::basic_string_view<UTF8> source, una::error& error, std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_append<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_x_utf8to32, detail::impl_utf8to32>(dst, source, error);
+}
+template<typename UTF32, typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+utf32to8(std::basic_string_view<UTF32> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            detail::impl_x_utf32to8, detail::impl_utf32to8>(alloc, source, error);
+}
+template<typename UTF32, typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+utf32to8(std::basic_string_view<UTF32> source, una::error& error, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF32>,
+            detail::impl_x_utf32to8, detail::impl_utf32to8>(dst, source, error);
+}
+template<typename UTF16, typename UTF32, typename Alloc = std::allocator<UTF32>>
+uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
+utf16to32(std::basic_string_view<UTF16> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_x_utf16to32, detail::impl_utf16to32>(alloc, source, error);
+}
+template<typename UTF16, typename UTF32, typename Alloc>
+uaiw_constexpr std::size_t
+utf16to32(std::basic_string_view<UTF16> source, una::error& error, std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_append<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_x_utf16to32, detail::impl_utf16to32>(dst, source, error);
+}
+template<typename UTF32, typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+utf32to16(std::basic_string_view<UTF32> source, una::error& error, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            detail::impl_x_utf32to16, detail::impl_utf32to16>(alloc, source, error);
+}
+template<typename UTF32, typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+utf32to16(std::basic_string_view<UTF32> source, una::error& error, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_utf_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF32>,
+            detail::impl_x_utf32to16, detail::impl_utf32to16>(dst, source, error);
+}
+
+// Short non-template functions for std::string, std::wstring, std::u16string, std::u32string
+
+inline uaiw_constexpr std::u16string utf8to16u(std::string_view source, una::error& error)
+{
+    return utf8to16<char, char16_t>(source, error);
+}
+inline uaiw_constexpr std::string utf16to8(std::u16string_view source, una::error& error)
+{
+    return utf16to8<char16_t, char>(source, error);
+}
+inline uaiw_constexpr std::u32string utf8to32u(std::string_view source, una::error& error)
+{
+    return utf8to32<char, char32_t>(source, error);
+}
+inline uaiw_constexpr std::string utf32to8(std::u32string_view source, una::error& error)
+{
+    return utf32to8<char32_t, char>(source, error);
+}
+inline uaiw_constexpr std::u32string utf16to32u(std::u16string_view source, una::error& error)
+{
+    return utf16to32<char16_t, char32_t>(source, error);
+}
+inline uaiw_constexpr std::u16string utf32to16u(std::u32string_view source, una::error& error)
+{
+    return utf32to16<char32_t, char16_t>(source, error);
+}
+
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+inline uaiw_constexpr std::wstring utf8to16(std::string_view source, una::error& error)
+{
+    return utf8to16<char, wchar_t>(source, error);
+}
+inline uaiw_constexpr std::string utf16to8(std::wstring_view source, una::error& error)
+{
+    return utf16to8<wchar_t, char>(source, error);
+}
+inline uaiw_constexpr std::u32string utf16to32u(std::wstring_view source, una::error& error)
+{
+    return utf16to32<wchar_t, char32_t>(source, error);
+}
+inline uaiw_constexpr std::wstring utf32to16(std::u32string_view source, una::error& error)
+{
+    return utf32to16<char32_t, wchar_t>(source, error);
+}
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+inline uaiw_constexpr std::wstring utf8to32(std::string_view source, una::error& error)
+{
+    return utf8to32<char, wchar_t>(source, error);
+}
+inline uaiw_constexpr std::string utf32to8(std::wstring_view source, una::error& error)
+{
+    return utf32to8<wchar_t, char>(source, error);
+}
+inline uaiw_constexpr std::wstring utf16to32(std::u16string_view source, una::error& error)
+{
+    return utf16to32<char16_t, wchar_t>(source, error);
+}
+inline uaiw_constexpr std::u16string utf32to16u(std::wstring_view source, una::error& error)
+{
+    return utf32to16<wchar_t, char16_t>(source, error);
 }
+#endif // WCHAR_MAX >= 0x7FFFFFFF
 
-} // namespace detail
+} // namespace strict
+
+namespace exact {
+
+// The same functions as above but the result length is counted first so memory is allocated only once
+// for the exact size, it is slower but a string never takes more memory than needed even temporarily.
 
 // Template functions
 
@@ -149,8 +1043,8 @@ utf8to16(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
     static_assert(std::is_integral_v<UTF8>);
     static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
 
-    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF8>,
-            detail::impl_x_utf8to16, detail::impl_utf8to16>(alloc, source);
+    return detail::t_utf_exact<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_utf8to16, detail::impl_utf8to16>(alloc, source, nullptr);
 }
 template<typename UTF16, typename UTF8, typename Alloc = std::allocator<UTF8>>
 uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
@@ -159,8 +1053,8 @@ utf16to8(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
     static_assert(std::is_integral_v<UTF8>);
     static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
 
-    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF16>,
-            detail::impl_x_utf16to8, detail::impl_utf16to8>(alloc, source);
+    return detail::t_utf_exact<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_utf16to8, detail::impl_utf16to8>(alloc, source, nullptr);
 }
 template<typename UTF8, typename UTF32, typename Alloc = std::allocator<UTF32>>
 uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
@@ -169,8 +1063,8 @@ utf8to32(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
     static_assert(std::is_integral_v<UTF8>);
     static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF8>,
-            detail::impl_x_utf8to32, detail::impl_utf8to32>(alloc, source);
+    return detail::t_utf_exact<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_utf8to32, detail::impl_utf8to32>(alloc, source, nullptr);
 }
 template<typename UTF32, typename UTF8, typename Alloc = std::allocator<UTF8>>
 uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
@@ -179,8 +1073,8 @@ utf32to8(std::basic_string_view<UTF32> source, const Alloc& alloc = Alloc())
     static_assert(std::is_integral_v<UTF8>);
     static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF32>,
-            detail::impl_x_utf32to8, detail::impl_utf32to8>(alloc, source);
+    return detail::t_utf_exact<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            detail::impl_utf32to8, detail::impl_utf32to8>(alloc, source, nullptr);
 }
 template<typename UTF16, typename UTF32, typename Alloc = std::allocator<UTF32>>
 uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
@@ -189,8 +1083,8 @@ utf16to32(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
     static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
     static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF16>,
-            detail::impl_x_utf16to32, detail::impl_utf16to32>(alloc, source);
+    return detail::t_utf_exact<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_utf16to32, detail::impl_utf16to32>(alloc, source, nullptr);
 }
 template<typename UTF32, typename UTF16, typename Alloc = std::allocator<UTF16>>
 uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
@@ -199,8 +1093,8 @@ utf32to16(std::basic_string_view<UTF32> source, const Alloc& alloc = Alloc())
     static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
     static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF32>,
-            detail::impl_x_utf32to16, detail::impl_utf32to16>(alloc, source);
+    return detail::t_utf_exact<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            detail::impl_utf32to16, detail::impl_utf32to16>(alloc, source, nullptr);
 }
 
 // Short non-template functions for std::string, std::wstring, std::u16string, std::u32string
@@ -277,8 +1171,8 @@ utf8to16(std::basic_string_view<UTF8> source, una::error& error, const Alloc& al
     static_assert(std::is_integral_v<UTF8>);
     static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
 
-    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF8>,
-            detail::impl_x_utf8to16, detail::impl_utf8to16>(alloc, source, error);
+    return detail::t_utf_exact<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_utf8to16, detail::impl_utf8to16>(alloc, source, error);
 }
 template<typename UTF16, typename UTF8, typename Alloc = std::allocator<UTF8>>
 uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
@@ -287,8 +1181,8 @@ utf16to8(std::basic_string_view<UTF16> source, una::error& error, const Alloc& a
     static_assert(std::is_integral_v<UTF8>);
     static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
 
-    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF16>,
-            detail::impl_x_utf16to8, detail::impl_utf16to8>(alloc, source, error);
+    return detail::t_utf_exact<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_utf16to8, detail::impl_utf16to8>(alloc, source, error);
 }
 template<typename UTF8, typename UTF32, typename Alloc = std::allocator<UTF32>>
 uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
@@ -297,8 +1191,8 @@ utf8to32(std::basic_string_view<UTF8> source, una::error& error, const Alloc& al
     static_assert(std::is_integral_v<UTF8>);
     static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF8>,
-            detail::impl_x_utf8to32, detail::impl_utf8to32>(alloc, source, error);
+    return detail::t_utf_exact<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_utf8to32, detail::impl_utf8to32>(alloc, source, error);
 }
 template<typename UTF32, typename UTF8, typename Alloc = std::allocator<UTF8>>
 uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
@@ -307,8 +1201,8 @@ utf32to8(std::basic_string_view<UTF32> source, una::error& error, const Alloc& a
     static_assert(std::is_integral_v<UTF8>);
     static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-    return detail::t_utf<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF32>,
-            detail::impl_x_utf32to8, detail::impl_utf32to8>(alloc, source, error);
+    return detail::t_utf_exact<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            detail::impl_utf32to8, detail::impl_utf32to8>(alloc, source, error);
 }
 template<typename UTF16, typename UTF32, typename Alloc = std::allocator<UTF32>>
 uaiw_constexpr std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>
@@ -317,8 +1211,8 @@ utf16to32(std::basic_string_view<UTF16> source, una::error& error, const Alloc&
     static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
     static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-    return detail::t_utf<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF16>,
-            detail::impl_x_utf16to32, detail::impl_utf16to32>(alloc, source, error);
+    return detail::t_utf_exact<std::basic_string<UTF32, std::char_traits<UTF32>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_utf16to32, detail::impl_utf16to32>(alloc, source, error);
 }
 template<typename UTF32, typename UTF16, typename Alloc = std::allocator<UTF16>>
 uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
@@ -327,8 +1221,8 @@ utf32to16(std::basic_string_view<UTF32> source, una::error& error, const Alloc&
     static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
     static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
 
-    return detail::t_utf<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF32>,
-            detail::impl_x_utf32to16, detail::impl_utf32to16>(alloc, source, error);
+    return detail::t_utf_exact<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF32>,
+            detail::impl_utf32to16, detail::impl_utf32to16>(alloc, source, error);
 }
 
 // Short non-template functions for std::string, std::wstring, std::u16string, std::u32string
@@ -396,6 +1290,203 @@ inline uaiw_constexpr std::u16string utf32to16u(std::wstring_view source, una::e
 
 } // namespace strict
 
+} // namespace exact
+
+namespace bounded {
+
+// The same functions as above but the result is written to a caller buffer, as much as fits,
+// and the conversion always stops on a code point boundary. The number of code units read and written
+// is returned so the conversion can be continued from there with another buffer.
+
+// Template functions
+
+template<typename UTF8, typename UTF16>
+uaiw_constexpr bounded_result utf8to16(std::basic_string_view<UTF8> source, UTF16* dst, std::size_t dst_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_bounded<UTF8, UTF16, detail::impl_x_utf8to16,
+            detail::conv_bounded<UTF8, UTF16, 8, detail::impl_utf8to16>>(source, dst, dst_size, nullptr);
+}
+template<typename UTF16, typename UTF8>
+uaiw_constexpr bounded_result utf16to8(std::basic_string_view<UTF16> source, UTF8* dst, std::size_t dst_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_bounded<UTF16, UTF8, detail::impl_x_utf16to8,
+            detail::conv_bounded<UTF16, UTF8, 16, detail::impl_utf16to8>>(source, dst, dst_size, nullptr);
+}
+template<typename UTF8, typename UTF32>
+uaiw_constexpr bounded_result utf8to32(std::basic_string_view<UTF8> source, UTF32* dst, std::size_t dst_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_bounded<UTF8, UTF32, detail::impl_x_utf8to32,
+            detail::conv_bounded<UTF8, UTF32, 8, detail::impl_utf8to32>>(source, dst, dst_size, nullptr);
+}
+template<typename UTF32, typename UTF8>
+uaiw_constexpr bounded_result utf32to8(std::basic_string_view<UTF32> source, UTF8* dst, std::size_t dst_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_bounded<UTF32, UTF8, detail::impl_x_utf32to8,
+            detail::conv_bounded<UTF32, UTF8, 32, detail::impl_utf32to8>>(source, dst, dst_size, nullptr);
+}
+template<typename UTF16, typename UTF32>
+uaiw_constexpr bounded_result utf16to32(std::basic_string_view<UTF16> source, UTF32* dst, std::size_t dst_size)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_bounded<UTF16, UTF32, detail::impl_x_utf16to32,
+            detail::conv_bounded<UTF16, UTF32, 16, detail::impl_utf16to32>>(source, dst, dst_size, nullptr);
+}
+template<typename UTF32, typename UTF16>
+uaiw_constexpr bounded_result utf32to16(std::basic_string_view<UTF32> source, UTF16* dst, std::size_t dst_size)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_bounded<UTF32, UTF16, detail::impl_x_utf32to16,
+            detail::conv_bounded<UTF32, UTF16, 32, detail::impl_utf32to16>>(source, dst, dst_size, nullptr);
+}
+
+// Short non-template functions for std::string, std::u16string, std::u32string
+
+inline uaiw_constexpr bounded_result utf8to16(std::string_view source, char16_t* dst, std::size_t dst_size)
+{
+    return utf8to16<char, char16_t>(source, dst, dst_size);
+}
+inline uaiw_constexpr bounded_result utf16to8(std::u16string_view source, char* dst, std::size_t dst_size)
+{
+    return utf16to8<char16_t, char>(source, dst, dst_size);
+}
+inline uaiw_constexpr bounded_result utf8to32(std::string_view source, char32_t* dst, std::size_t dst_size)
+{
+    return utf8to32<char, char32_t>(source, dst, dst_size);
+}
+inline uaiw_constexpr bounded_result utf32to8(std::u32string_view source, char* dst, std::size_t dst_size)
+{
+    return utf32to8<char32_t, char>(source, dst, dst_size);
+}
+inline uaiw_constexpr bounded_result utf16to32(std::u16string_view source, char32_t* dst, std::size_t dst_size)
+{
+    return utf16to32<char16_t, char32_t>(source, dst, dst_size);
+}
+inline uaiw_constexpr bounded_result utf32to16(std::u32string_view source, char16_t* dst, std::size_t dst_size)
+{
+    return utf32to16<char32_t, char16_t>(source, dst, dst_size);
+}
+
+namespace strict {
+
+// Template functions
+
+template<typename UTF8, typename UTF16>
+uaiw_constexpr bounded_result utf8to16(std::basic_string_view<UTF8> source, UTF16* dst, std::size_t dst_size, una::error& error)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_bounded<UTF8, UTF16, detail::impl_x_utf8to16,
+            detail::conv_bounded<UTF8, UTF16, 8, detail::impl_utf8to16>>(source, dst, dst_size, error);
+}
+template<typename UTF16, typename UTF8>
+uaiw_constexpr bounded_result utf16to8(std::basic_string_view<UTF16> source, UTF8* dst, std::size_t dst_size, una::error& error)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_bounded<UTF16, UTF8, detail::impl_x_utf16to8,
+            detail::conv_bounded<UTF16, UTF8, 16, detail::impl_utf16to8>>(source, dst, dst_size, error);
+}
+template<typename UTF8, typename UTF32>
+uaiw_constexpr bounded_result utf8to32(std::basic_string_view<UTF8> source, UTF32* dst, std::size_t dst_size, una::error& error)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_bounded<UTF8, UTF32, detail::impl_x_utf8to32,
+            detail::conv_bounded<UTF8, UTF32, 8, detail::impl_utf8to32>>(source, dst, dst_size, error);
+}
+template<typename UTF32, typename UTF8>
+uaiw_constexpr bounded_result utf32to8(std::basic_string_view<UTF32> source, UTF8* dst, std::size_t dst_size, una::error& error)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_bounded<UTF32, UTF8, detail::impl_x_utf32to8,
+            detail::conv_bounded<UTF32, UTF8, 32, detail::impl_utf32to8>>(source, dst, dst_size, error);
+}
+template<typename UTF16, typename UTF32>
+uaiw_constexpr bounded_result utf16to32(std::basic_string_view<UTF16> source, UTF32* dst, std::size_t dst_size, una::error& error)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_bounded<UTF16, UTF32, detail::impl_x_utf16to32,
+            detail::conv_bounded<UTF16, UTF32, 16, detail::impl_utf16to32>>(source, dst, dst_size, error);
+}
+template<typename UTF32, typename UTF16>
+uaiw_constexpr bounded_result utf32to16(std::basic_string_view<UTF32> source, UTF16* dst, std::size_t dst_size, una::error& error)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return detail::t_bounded<UTF32, UTF16, detail::impl_x_utf32to16,
+            detail::conv_bounded<UTF32, UTF16, 32, detail::impl_utf32to16>>(source, dst, dst_size, error);
+}
+
+// Short non-template functions for std::string, std::u16string, std::u32string
+
+inline uaiw_constexpr bounded_result utf8to16(std::string_view source, char16_t* dst, std::size_t dst_size, una::error& error)
+{
+    return utf8to16<char, char16_t>(source, dst, dst_size, error);
+}
+inline uaiw_constexpr bounded_result utf16to8(std::u16string_view source, char* dst, std::size_t dst_size, una::error& error)
+{
+    return utf16to8<char16_t, char>(source, dst, dst_size, error);
+}
+inline uaiw_constexpr bounded_result utf8to32(std::string_view source, char32_t* dst, std::size_t dst_size, una::error& error)
+{
+    return utf8to32<char, char32_t>(source, dst, dst_size, error);
+}
+inline uaiw_constexpr bounded_result utf32to8(std::u32string_view source, char* dst, std::size_t dst_size, una::error& error)
+{
+    return utf32to8<char32_t, char>(source, dst, dst_size, error);
+}
+inline uaiw_constexpr bounded_result utf16to32(std::u16string_view source, char32_t* dst, std::size_t dst_size, una::error& error)
+{
+    return utf16to32<char16_t, char32_t>(source, dst, dst_size, error);
+}
+inline uaiw_constexpr bounded_result utf32to16(std::u32string_view source, char16_t* dst, std::size_t dst_size, una::error& error)
+{
+    return utf32to16<char32_t, char16_t>(source, dst, dst_size, error);
+}
+
+} // namespace strict
+
+} // namespace bounded
+
+// Streaming conversion of chunks to a caller buffer with fixed memory, see detail::conv_stream
+
+template<typename UTF8 = char, typename UTF16 = char16_t>
+using utf8to16_stream = detail::conv_stream<UTF8, UTF16, 8, detail::impl_x_utf8to16, detail::impl_utf8to16>;
+template<typename UTF16 = char16_t, typename UTF8 = char>
+using utf16to8_stream = detail::conv_stream<UTF16, UTF8, 16, detail::impl_x_utf16to8, detail::impl_utf16to8>;
+template<typename UTF8 = char, typename UTF32 = char32_t>
+using utf8to32_stream = detail::conv_stream<UTF8, UTF32, 8, detail::impl_x_utf8to32, detail::impl_utf8to32>;
+template<typename UTF32 = char32_t, typename UTF8 = char>
+using utf32to8_stream = detail::conv_stream<UTF32, UTF8, 32, detail::impl_x_utf32to8, detail::impl_utf32to8>;
+template<typename UTF16 = char16_t, typename UTF32 = char32_t>
+using utf16to32_stream = detail::conv_stream<UTF16, UTF32, 16, detail::impl_x_utf16to32, detail::impl_utf16to32>;
+template<typename UTF32 = char32_t, typename UTF16 = char16_t>
+using utf32to16_stream = detail::conv_stream<UTF32, UTF16, 32, detail::impl_x_utf32to16, detail::impl_utf32to16>;
+
 template<typename UTF8>
 uaiw_constexpr bool is_valid_utf8(std::basic_string_view<UTF8> source)
 {
@@ -404,10 +1495,12 @@ uaiw_constexpr bool is_valid_utf8(std::basic_string_view<UTF8> source)
 #if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
     return detail::impl_is_valid_utf8(source.cbegin(), source.cend(), nullptr);
 #elif defined(UNI_ALGO_FORCE_C_POINTERS)
-    return detail::impl_is_valid_utf8(source.data(), source.data() + source.size(), nullptr);
+    const std::size_t skip = detail::simd::utf8_valid_prefix(source.data(), source.size());
+    return detail::impl_is_valid_utf8(source.data() + skip, source.data() + source.size(), nullptr);
 #else // Safe layer
     namespace safe = detail::safe;
-    return detail::impl_is_valid_utf8(safe::in{source.data(), source.size()}, safe::end{source.data() + source.size()}, nullptr);
+    const std::size_t skip = detail::simd::utf8_valid_prefix(source.data(), source.size());
+    return detail::impl_is_valid_utf8(safe::in{source.data() + skip, source.size() - skip}, safe::end{source.data() + source.size()}, nullptr);
 #endif
 }
 
@@ -450,10 +1543,16 @@ uaiw_constexpr bool is_valid_utf8(std::basic_string_view<UTF8> source, una::erro
 #if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
     const bool ret = detail::impl_is_valid_utf8(source.cbegin(), source.cend(), &err);
 #elif defined(UNI_ALGO_FORCE_C_POINTERS)
-    const bool ret = detail::impl_is_valid_utf8(source.data(), source.data() + source.size(), &err);
+    const std::size_t skip = detail::simd::utf8_valid_prefix(source.data(), source.size());
+    const bool ret = detail::impl_is_valid_utf8(source.data() + skip, source.data() + source.size(), &err);
+    if (!ret)
+        err += skip;
 #else // Safe layer
     namespace safe = detail::safe;
-    const bool ret = detail::impl_is_valid_utf8(safe::in{source.data(), source.size()}, safe::end{source.data() + source.size()}, &err);
+    const std::size_t skip = detail::simd::utf8_valid_prefix(source.data(), source.size());
+    const bool ret = detail::impl_is_valid_utf8(safe::in{source.data() + skip, source.size() - skip}, safe::end{source.data() + source.size()}, &err);
+    if (!ret)
+        err += skip;
 #endif
     error = ret ? una::error{} : una::error{una::error::code::ill_formed_utf, err};
 
@@ -632,6 +1731,88 @@ inline uaiw_constexpr std::u8string utf32to8u(std::wstring_view source, una::err
 
 } // namespace strict
 
+namespace exact {
+
+inline uaiw_constexpr std::u16string utf8to16u(std::u8string_view source)
+{
+    return utf8to16<char8_t, char16_t>(source);
+}
+inline uaiw_constexpr std::u8string utf16to8u(std::u16string_view source)
+{
+    return utf16to8<char16_t, char8_t>(source);
+}
+inline uaiw_constexpr std::u32string utf8to32u(std::u8string_view source)
+{
+    return utf8to32<char8_t, char32_t>(source);
+}
+inline uaiw_constexpr std::u8string utf32to8u(std::u32string_view source)
+{
+    return utf32to8<char32_t, char8_t>(source);
+}
+
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+inline uaiw_constexpr std::wstring utf8to16(std::u8string_view source)
+{
+    return utf8to16<char8_t, wchar_t>(source);
+}
+inline uaiw_constexpr std::u8string utf16to8u(std::wstring_view source)
+{
+    return utf16to8<wchar_t, char8_t>(source);
+}
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+inline uaiw_constexpr std::wstring utf8to32(std::u8string_view source)
+{
+    return utf8to32<char8_t, wchar_t>(source);
+}
+inline uaiw_constexpr std::u8string utf32to8u(std::wstring_view source)
+{
+    return utf32to8<wchar_t, char8_t>(source);
+}
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+
+namespace strict {
+
+inline uaiw_constexpr std::u16string utf8to16u(std::u8string_view source, una::error& error)
+{
+    return utf8to16<char8_t, char16_t>(source, error);
+}
+inline uaiw_constexpr std::u8string utf16to8u(std::u16string_view source, una::error& error)
+{
+    return utf16to8<char16_t, char8_t>(source, error);
+}
+inline uaiw_constexpr std::u32string utf8to32u(std::u8string_view source, una::error& error)
+{
+    return utf8to32<char8_t, char32_t>(source, error);
+}
+inline uaiw_constexpr std::u8string utf32to8u(std::u32string_view source, una::error& error)
+{
+    return utf32to8<char32_t, char8_t>(source, error);
+}
+
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+inline uaiw_constexpr std::wstring utf8to16(std::u8string_view source, una::error& error)
+{
+    return utf8to16<char8_t, wchar_t>(source, error);
+}
+inline uaiw_constexpr std::u8string utf16to8u(std::wstring_view source, una::error& error)
+{
+    return utf16to8<wchar_t, char8_t>(source, error);
+}
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+inline uaiw_constexpr std::wstring utf8to32(std::u8string_view source, una::error& error)
+{
+    return utf8to32<char8_t, wchar_t>(source, error);
+}
+inline uaiw_constexpr std::u8string utf32to8u(std::wstring_view source, una::error& error)
+{
+    return utf32to8<wchar_t, char8_t>(source, error);
+}
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+
+} // namespace strict
+
+} // namespace exact
+
 #endif // __cpp_lib_char8_t
 
 } // namespace una
@@ -0,0 +1,230 @@
+/* C++ Standard Library wrapper for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See notice at the end of this file. */
+
+#ifndef UNI_ALGO_EXT_CASE_CACHE_H_UAIH
+#define UNI_ALGO_EXT_CASE_CACHE_H_UAIH
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "../config.h"
+#include "../case.h"
+
+namespace unx {
+
+// What case_cache stores for a source string
+enum class case_cache_mode
+{
+    casefold, // una::cases::to_casefold_utf8
+#if defined(UNI_ALGO_EXPERIMENTAL) && !defined(UNI_ALGO_DISABLE_COLLATE)
+    sortkey // una::caseless::sortkey_utf8
+#endif
+};
+
+// Thread-safe bounded cache of case folded strings or sort keys for the same short strings
+// that are case folded many times (user names, tags etc.) so hot strings do not go through
+// case mapping again. The cache is split into shards by the hash of the source, lookups take
+// a shared lock of a shard so they never wait for each other, only an insert takes an exclusive lock.
+// When a shard is full an entry that was not used since the last sweep is replaced (CLOCK).
+// Sources longer than max_size bypass the cache and are not counted as hits or misses.
+class case_cache
+{
+private:
+    struct entry
+    {
+        std::string key;
+        std::string value;
+        std::atomic<bool> used{false};
+    };
+    struct shard
+    {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string_view, std::size_t> index; // Views of the keys in entries
+        std::unique_ptr<entry[]> entries;
+        std::size_t capacity = 0;
+        std::size_t size = 0;
+        std::size_t hand = 0;
+    };
+
+    static constexpr std::size_t max_shards = 16;
+    static constexpr std::size_t min_shard_capacity = 16;
+
+    case_cache_mode mode = case_cache_mode::casefold;
+    std::size_t max_size = 0;
+    std::size_t num_shards = 1;
+    std::unique_ptr<shard[]> shards;
+    std::atomic<std::size_t> hit_count{0};
+    std::atomic<std::size_t> miss_count{0};
+
+    std::string transform(std::string_view source) const
+    {
+#if defined(UNI_ALGO_EXPERIMENTAL) && !defined(UNI_ALGO_DISABLE_COLLATE)
+        if (mode == case_cache_mode::sortkey)
+            return una::caseless::sortkey_utf8(source);
+#endif
+        return una::cases::to_casefold_utf8(source);
+    }
+    void insert(shard& s, std::string_view source, const std::string& value)
+    {
+        const std::unique_lock lock{s.mutex};
+
+        // Another thread could insert it while the lock was not held
+        if (s.capacity == 0 || s.index.find(source) != s.index.end())
+            return;
+
+        std::size_t i = s.size;
+        if (s.size < s.capacity)
+            ++s.size;
+        else
+        {
+            // Give a second chance to the entries that were used since the last sweep
+            while (s.entries[s.hand].used.exchange(false, std::memory_order_relaxed))
+                s.hand = (s.hand + 1) % s.capacity;
+            i = s.hand;
+            s.hand = (s.hand + 1) % s.capacity;
+            s.index.erase(s.entries[i].key);
+        }
+
+        entry& e = s.entries[i];
+        e.key = source;
+        e.value = value;
+        e.used.store(false, std::memory_order_relaxed);
+        s.index.emplace(e.key, i);
+    }
+public:
+    // capacity is the maximum number of cached strings, 0 disables the cache,
+    // max_size is the maximum size of a cached source string in code units
+    explicit case_cache(case_cache_mode cache_mode = case_cache_mode::casefold,
+                        std::size_t capacity = 4096, std::size_t max_source_size = 64)
+        : mode{cache_mode}, max_size{max_source_size}
+    {
+        num_shards = max_shards;
+        while (num_shards > 1 && capacity / num_shards < min_shard_capacity)
+            num_shards /= 2;
+
+        shards = std::make_unique<shard[]>(num_shards);
+        for (std::size_t i = 0; i < num_shards; ++i)
+        {
+            shards[i].capacity = capacity / num_shards;
+            shards[i].entries = std::make_unique<entry[]>(shards[i].capacity);
+            shards[i].index.reserve(shards[i].capacity);
+        }
+    }
+    case_cache(const case_cache&) = delete;
+    case_cache& operator=(const case_cache&) = delete;
+
+    // The same as una::cases::to_casefold_utf8 or una::caseless::sortkey_utf8 depends on the mode
+    std::string transform_utf8(std::string_view source)
+    {
+        if (source.size() > max_size)
+            return transform(source);
+
+        shard& s = shards[std::hash<std::string_view>{}(source) & (num_shards - 1)];
+        {
+            const std::shared_lock lock{s.mutex};
+
+            const auto it = s.index.find(source);
+            if (it != s.index.end())
+            {
+                entry& e = s.entries[it->second];
+                e.used.store(true, std::memory_order_relaxed);
+                hit_count.fetch_add(1, std::memory_order_relaxed);
+                return e.value;
+            }
+        }
+        miss_count.fetch_add(1, std::memory_order_relaxed);
+
+        std::string value = transform(source);
+        insert(s, source, value);
+        return value;
+    }
+
+    std::size_t hits() const noexcept { return hit_count.load(std::memory_order_relaxed); }
+    std::size_t misses() const noexcept { return miss_count.load(std::memory_order_relaxed); }
+    void reset_counters() noexcept
+    {
+        hit_count.store(0, std::memory_order_relaxed);
+        miss_count.store(0, std::memory_order_relaxed);
+    }
+    // The number of cached strings
+    std::size_t size() const
+    {
+        std::size_t result = 0;
+        for (std::size_t i = 0; i < num_shards; ++i)
+        {
+            const std::shared_lock lock{shards[i].mutex};
+            result += shards[i].size;
+        }
+        return result;
+    }
+    void clear()
+    {
+        for (std::size_t i = 0; i < num_shards; ++i)
+        {
+            shard& s = shards[i];
+            const std::unique_lock lock{s.mutex};
+            s.index.clear();
+            for (std::size_t j = 0; j < s.size; ++j)
+            {
+                s.entries[j].key.clear();
+                s.entries[j].value.clear();
+            }
+            s.size = 0;
+            s.hand = 0;
+        }
+    }
+};
+
+} // namespace unx
+
+#endif // UNI_ALGO_EXT_CASE_CACHE_H_UAIH
+
+/* Public Domain License:
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+ * software, either in source code form or as a compiled binary, for any purpose,
+ * commercial or non-commercial, and by any means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors of this
+ * software dedicate any and all copyright interest in the software to the public
+ * domain. We make this dedication for the benefit of the public at large and to
+ * the detriment of our heirs and successors. We intend this dedication to be an
+ * overt act of relinquishment in perpetuity of all present and future rights to
+ * this software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * MIT License:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
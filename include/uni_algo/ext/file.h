@@ -0,0 +1,411 @@
+/* C++ Standard Library wrapper for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See notice at the end of this file. */
+
+#ifndef UNI_ALGO_EXT_FILE_H_UAIH
+#define UNI_ALGO_EXT_FILE_H_UAIH
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "../config.h"
+#include "../conv.h"
+#include "../case.h"
+#include "../norm.h"
+
+namespace unx {
+
+// Transforms that can be applied to a UTF-8 file
+enum class file_transform
+{
+    utf8to16, // UTF-8 to UTF-16LE without BOM
+    nfc,
+    lowercase,
+    uppercase,
+    casefold
+};
+
+// The default size of a chunk, a multiple of the most common large page size
+inline constexpr std::size_t file_chunk_size = 2 * 1024 * 1024;
+
+} // namespace unx
+
+namespace una::detail::file {
+
+// Read-only memory mapping of a whole file
+class mapped
+{
+public:
+    mapped() = default;
+    mapped(const mapped&) = delete;
+    mapped& operator=(const mapped&) = delete;
+    ~mapped() { close(); }
+
+    std::error_code open(const std::string& path)
+    {
+        close();
+#ifdef _WIN32
+        file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                             OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return last_error();
+        LARGE_INTEGER file_size{};
+        if (!::GetFileSizeEx(file, &file_size))
+            return last_error();
+        if (static_cast<unsigned long long>(file_size.QuadPart) > SIZE_MAX)
+            return std::error_code{ERROR_FILE_TOO_LARGE, std::system_category()};
+        size = static_cast<std::size_t>(file_size.QuadPart);
+        if (size == 0) // Empty files cannot be mapped
+            return std::error_code{};
+        mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+            return last_error();
+        data = static_cast<const char*>(::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!data)
+            return last_error();
+#else
+        fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            return last_error();
+        struct stat st{};
+        if (::fstat(fd, &st) == -1)
+            return last_error();
+        if (static_cast<std::uintmax_t>(st.st_size) > SIZE_MAX)
+            return std::error_code{EFBIG, std::generic_category()};
+        size = static_cast<std::size_t>(st.st_size);
+        if (size == 0) // Empty files cannot be mapped
+            return std::error_code{};
+        void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED)
+            return last_error();
+        data = static_cast<const char*>(addr);
+        ::madvise(addr, size, MADV_SEQUENTIAL);
+#endif
+        return std::error_code{};
+    }
+    void close() noexcept
+    {
+#ifdef _WIN32
+        if (data)
+            ::UnmapViewOfFile(data);
+        if (mapping)
+            ::CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE)
+            ::CloseHandle(file);
+        mapping = nullptr;
+        file = INVALID_HANDLE_VALUE;
+#else
+        if (data)
+            ::munmap(const_cast<char*>(data), size);
+        if (fd != -1)
+            ::close(fd);
+        fd = -1;
+#endif
+        data = nullptr;
+        size = 0;
+    }
+    // Tells the system that the pages before the position are not needed anymore
+    // so the resident memory stays bounded even for huge files
+    void release(std::size_t pos) noexcept
+    {
+#ifndef _WIN32
+        const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        pos -= pos % page;
+        if (data && pos > released)
+        {
+            ::madvise(const_cast<char*>(data) + released, pos - released, MADV_DONTNEED);
+            released = pos;
+        }
+#else
+        (void)pos;
+#endif
+    }
+    std::string_view view() const noexcept
+    {
+        return data ? std::string_view{data, size} : std::string_view{};
+    }
+
+private:
+    static std::error_code last_error() noexcept
+    {
+#ifdef _WIN32
+        return std::error_code{static_cast<int>(::GetLastError()), std::system_category()};
+#else
+        return std::error_code{errno, std::generic_category()};
+#endif
+    }
+
+    const char* data = nullptr;
+    std::size_t size = 0;
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int fd = -1;
+    std::size_t released = 0;
+#endif
+};
+
+// The same boundaries as in bounded and parallel normalization, see una::detail::norm_bounded
+using norm_nfc = norm_bounded<char, char, 8, impl_norm_is_nfc_qc_yes_prop, impl_norm_to_nfc_utf8>;
+
+// Returns true if the source can be split at the position so the result of processing both parts
+// separately is the same as the result of processing the whole source
+inline bool is_split(std::string_view s, std::size_t p, unx::file_transform mode)
+{
+    if (utf_tail<8>(s.data(), p) != 0)
+        return false; // Inside of a sequence
+
+    if (mode == unx::file_transform::nfc)
+    {
+        bool is_boundary = false;
+        norm_nfc::boundary_before(s.data() + p, s.size() - p, &is_boundary);
+        return is_boundary;
+    }
+    return true;
+}
+
+inline bool is_case_ignorable(std::string_view s, std::size_t p, std::size_t* next, bool* is_sigma)
+{
+    type_codept c = 0;
+    const char* it = inline_iter_utf8(s.data() + p, s.data() + s.size(), &c, impl_iter_replacement);
+    *next = static_cast<std::size_t>(it - s.data());
+    *is_sigma = (c == 0x03A3);
+    return impl_case_is_case_ignorable_prop(impl_case_get_prop(c));
+}
+
+// Lowercase depends on the context only for U+03A3 (Final_Sigma) and the context is the case-ignorable
+// code points after and before it, so a position can be split if the nearest code points around it
+// that are not case-ignorable are not U+03A3. Otherwise all positions up to the one after the next
+// such code point cannot be split either so the search continues from there.
+// The first position is already checked that way so the search back stops there.
+// Only U+03A3 repeated without other letters has no split positions at all.
+inline std::size_t split_lowercase(std::string_view s, std::size_t first, std::size_t last)
+{
+    std::size_t p = last - utf_tail<8>(s.data(), last);
+    if (p <= first)
+    {
+        bool is_sigma = false;
+        is_case_ignorable(s, first, &p, &is_sigma);
+    }
+
+    while (p < s.size())
+    {
+        std::size_t next = 0;
+        bool is_sigma = false;
+
+        for (std::size_t q = p; q > first;)
+        {
+            q = q - 1 - utf_tail<8>(s.data(), q - 1);
+            if (!is_case_ignorable(s, q, &next, &is_sigma))
+                break;
+        }
+        const bool is_sigma_before = is_sigma;
+
+        std::size_t r = p;
+        is_sigma = false;
+        while (r < s.size() && is_case_ignorable(s, r, &next, &is_sigma))
+            r = next;
+
+        if (!is_sigma_before && !is_sigma)
+            return p;
+        if (r >= s.size())
+            break;
+        p = next; // After the next code point that is not case-ignorable
+    }
+    return s.size();
+}
+
+// Returns the end of the chunk that starts at the first position and should end near the last position.
+// Looks back a few code units from the last position first and then forward so the chunk can be
+// bigger than requested only if the source has no split positions for a long time.
+inline std::size_t split(std::string_view s, std::size_t first, std::size_t last, unx::file_transform mode)
+{
+    if (last >= s.size())
+        return s.size();
+
+    if (mode == unx::file_transform::lowercase)
+        return split_lowercase(s, first, last);
+
+    for (std::size_t p = last; p > first && last - p < 32; --p)
+    {
+        if (is_split(s, p, mode))
+            return p;
+    }
+    for (std::size_t p = last + 1; p < s.size(); ++p)
+    {
+        if (is_split(s, p, mode))
+            return p;
+    }
+    return s.size();
+}
+
+inline bool is_little_endian() noexcept
+{
+    const char16_t test = 1;
+    return *reinterpret_cast<const unsigned char*>(&test) == 1;
+}
+
+} // namespace una::detail::file
+
+namespace unx {
+
+// Transforms the source chunk by chunk, the output buffer is reused for all chunks so the memory
+// is bounded by the chunk size multiplied by the worst case of the transform.
+// Chunks end near multiples of the chunk size and never break a code point or the context
+// the transform depends on so the result is always the same as the result for the whole source.
+// Write is called for every chunk: bool write(const char* data, std::size_t size, std::size_t read)
+// where read is the number of bytes of the source that are done, return false to stop.
+// Returns false if write returned false.
+template<class Write>
+bool transform_chunks(std::string_view source, file_transform mode, Write write, std::size_t chunk_size = file_chunk_size)
+{
+    namespace file = una::detail::file;
+
+    if (chunk_size == 0)
+        chunk_size = file_chunk_size;
+
+    std::string buffer;
+    std::u16string buffer16;
+
+    const bool swap = !file::is_little_endian();
+
+    std::size_t pos = 0;
+    while (pos < source.size())
+    {
+        const std::size_t grid = (pos / chunk_size + 1) * chunk_size;
+        const std::size_t end = file::split(source, pos, grid, mode);
+        const std::string_view chunk = source.substr(pos, end - pos);
+
+        buffer.clear();
+        switch (mode)
+        {
+        case file_transform::utf8to16:
+            buffer16.clear();
+            una::utf8to16(chunk, buffer16);
+            if (swap)
+            {
+                for (char16_t& c : buffer16)
+                    c = static_cast<char16_t>(((c & 0xFF) << 8) | (c >> 8));
+            }
+            break;
+        case file_transform::nfc:
+            una::norm::to_nfc_utf8(chunk, buffer);
+            break;
+        case file_transform::lowercase:
+            una::cases::to_lowercase_utf8(chunk, buffer);
+            break;
+        case file_transform::uppercase:
+            una::cases::to_uppercase_utf8(chunk, buffer);
+            break;
+        case file_transform::casefold:
+            una::cases::to_casefold_utf8(chunk, buffer);
+            break;
+        }
+
+        pos = end;
+
+        const bool result = (mode == file_transform::utf8to16)
+            ? write(reinterpret_cast<const char*>(buffer16.data()), buffer16.size() * sizeof(char16_t), pos)
+            : write(buffer.data(), buffer.size(), pos);
+        if (!result)
+            return false;
+    }
+    return true;
+}
+
+// Memory maps the input file and writes the transformed data to the output file chunk by chunk.
+// The input must be in UTF-8, ill-formed sequences are replaced with U+FFFD.
+inline std::error_code transform_file(const std::string& input, const std::string& output,
+                                      file_transform mode, std::size_t chunk_size = file_chunk_size)
+{
+    una::detail::file::mapped source;
+    std::error_code ec = source.open(input);
+    if (ec)
+        return ec;
+
+    std::FILE* stream = std::fopen(output.c_str(), "wb");
+    if (!stream)
+        return std::error_code{errno, std::generic_category()};
+
+    const bool result = transform_chunks(source.view(), mode,
+        [&](const char* data, std::size_t size, std::size_t read) {
+            if (std::fwrite(data, 1, size, stream) != size)
+                return false;
+            source.release(read);
+            return true;
+        }, chunk_size);
+
+    if (!result)
+        ec = std::error_code{errno ? errno : EIO, std::generic_category()};
+    if (std::fclose(stream) != 0 && !ec)
+        ec = std::error_code{errno, std::generic_category()};
+
+    return ec;
+}
+
+} // namespace unx
+
+#endif // UNI_ALGO_EXT_FILE_H_UAIH
+
+/* Public Domain License:
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+ * software, either in source code form or as a compiled binary, for any purpose,
+ * commercial or non-commercial, and by any means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors of this
+ * software dedicate any and all copyright interest in the software to the public
+ * domain. We make this dedication for the benefit of the public at large and to
+ * the detriment of our heirs and successors. We intend this dedication to be an
+ * overt act of relinquishment in perpetuity of all present and future rights to
+ * this software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * MIT License:
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
@@ -0,0 +1,510 @@
+/* C++ Standard Library wrapper for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Parallel conversion and normalization.
+// This extension is not included by other files because it uses std::thread
+// so a program that includes it must be linked with threads library (Threads::Threads in CMake).
+
+#ifndef UNI_ALGO_EXT_PARALLEL_H_UAIH
+#define UNI_ALGO_EXT_PARALLEL_H_UAIH
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "../config.h"
+#include "../conv.h"
+#ifndef UNI_ALGO_DISABLE_NORM
+#include "../norm.h"
+#endif
+
+namespace unx {
+
+// The default executor for parallel functions: runs tasks on new threads and on the calling thread.
+// An executor is any object that can be called as executor(count, task) and must call task(i)
+// for every i in [0, count) in any order on any threads and return when all of them are done.
+// So it can be a simple adapter for any thread pool.
+class thread_executor
+{
+public:
+    // 0 means the number of hardware threads
+    explicit thread_executor(std::size_t threads = 0) noexcept : num_threads{threads} {}
+
+    template<class Fn>
+    void operator()(std::size_t count, Fn task) const
+    {
+        std::size_t threads = num_threads ? num_threads : std::thread::hardware_concurrency();
+        if (threads == 0)
+            threads = 1;
+        if (threads > count)
+            threads = count;
+
+        std::atomic<std::size_t> next{0};
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+        std::exception_ptr error;
+        std::mutex mutex;
+
+        auto worker = [&]() {
+            try
+            {
+                for (std::size_t i = next++; i < count; i = next++)
+                    task(i);
+            }
+            catch (...)
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+                if (!error)
+                    error = std::current_exception();
+                next = count; // Stop all workers
+            }
+        };
+
+        std::vector<std::thread> pool;
+        try
+        {
+            pool.reserve(threads - 1);
+            for (std::size_t i = 1; i < threads; ++i)
+                pool.emplace_back(worker);
+        }
+        catch (...) {} // Less threads is fine all tasks are done by the rest of them anyway
+
+        worker();
+        for (std::thread& thread : pool)
+            thread.join();
+
+        if (error)
+            std::rethrow_exception(error);
+#else
+        auto worker = [&]() {
+            for (std::size_t i = next++; i < count; i = next++)
+                task(i);
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (std::size_t i = 1; i < threads; ++i)
+            pool.emplace_back(worker);
+
+        worker();
+        for (std::thread& thread : pool)
+            thread.join();
+#endif
+    }
+
+private:
+    std::size_t num_threads = 0;
+};
+
+} // namespace unx
+
+namespace una::detail {
+
+// The default size of a chunk for parallel functions, smaller sources are processed on the calling thread
+inline constexpr std::size_t parallel_chunk_size = 1024 * 1024;
+
+// Returns count + 1 positions of the chunks of about chunk_size code units in the source of n code units.
+// split(i) - the position of a boundary near i, must be non-decreasing for increasing i
+// The split function is cheap so the boundaries are found on the calling thread.
+// If the previous boundary is already after the next position just use it so a source
+// without boundaries for a long time doesn't cause the same search again and again.
+template<class FnSplit>
+std::vector<std::size_t> parallel_bounds(std::size_t n, std::size_t chunk_size, FnSplit split)
+{
+    const std::size_t count = (n + chunk_size - 1) / chunk_size;
+
+    std::vector<std::size_t> bounds(count + 1, 0);
+    bounds[count] = n;
+    for (std::size_t i = 1; i < count; ++i)
+    {
+        const std::size_t pos = i * chunk_size;
+        bounds[i] = (bounds[i - 1] >= pos) ? bounds[i - 1] : split(pos);
+        if (bounds[i] < bounds[i - 1])
+            bounds[i] = bounds[i - 1];
+    }
+    return bounds;
+}
+
+// Splits the source to chunks and processes them in parallel.
+// The result is the concatenation of the results of the chunks so split must return positions
+// where the result of processing both parts separately is the same as the result of processing the whole.
+// split(s, n, i) - the position of a boundary near i in s[0, n), must be non-decreasing for increasing i
+// process(src) - processes the chunk, returns the result as a string
+template<typename Dst, typename Src, class Executor, class FnSplit, class FnProcess>
+std::basic_string<Dst> t_parallel(std::basic_string_view<Src> src, Executor&& executor,
+                                  std::size_t chunk_size, FnSplit split, FnProcess process)
+{
+    const std::size_t n = src.size();
+
+    if (chunk_size == 0 || n / chunk_size < 2)
+        return process(src);
+
+    const std::vector<std::size_t> bounds = parallel_bounds(n, chunk_size,
+        [&src, n, split](std::size_t i) { return split(src.data(), n, i); });
+    const std::size_t count = bounds.size() - 1;
+
+    std::vector<std::basic_string<Dst>> parts(count);
+    executor(count, [&](std::size_t i) {
+        parts[i] = process(src.substr(bounds[i], bounds[i + 1] - bounds[i]));
+    });
+
+    std::vector<std::size_t> offsets(count + 1, 0);
+    for (std::size_t i = 0; i < count; ++i)
+        offsets[i + 1] = offsets[i] + parts[i].size();
+
+    std::basic_string<Dst> result;
+    result.resize(offsets[count]);
+    executor(count, [&](std::size_t i) {
+        parts[i].copy(result.data() + offsets[i], parts[i].size());
+        std::basic_string<Dst>{}.swap(parts[i]); // Free memory as soon as possible
+    });
+
+    return result;
+}
+
+// Parallel conversion: the source is split to chunks before a code unit where low-level starts a new sequence
+// anyway (the same as streaming conversion), the result length of every chunk is counted in parallel,
+// then memory is allocated only once and every chunk is converted in parallel straight to its place.
+// The result and the error position are the same as serial conversion because the first error
+// in the first chunk with an error is the first error in the whole source.
+
+template<typename Src, typename Dst, std::size_t SrcUTF,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnUTF)(typename std::basic_string_view<Src>::const_iterator, typename std::basic_string_view<Src>::const_iterator, Dst*, size_t*),
+    size_t(*FnCount)(typename std::basic_string_view<Src>::const_iterator, typename std::basic_string_view<Src>::const_iterator, count_out, size_t*),
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(const Src*, const Src*, Dst*, size_t*),
+    size_t(*FnCount)(const Src*, const Src*, count_out, size_t*),
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<const Src*>, safe::end<const Src*>, safe::out<Dst*>, size_t*),
+    size_t(*FnCount)(safe::in<const Src*>, safe::end<const Src*>, count_out, size_t*),
+#endif
+    class Executor, class FnSerial>
+std::basic_string<Dst> t_utf_parallel(std::basic_string_view<Src> src, Executor&& executor,
+                                      std::size_t chunk_size, std::size_t* error, FnSerial serial)
+{
+    const std::size_t n = src.size();
+
+    if (chunk_size == 0 || n / chunk_size < 2)
+        return serial(src);
+
+    const std::vector<std::size_t> bounds = parallel_bounds(n, chunk_size,
+        [&src](std::size_t i) { return i - utf_tail<SrcUTF>(src.data(), i); });
+    const std::size_t count = bounds.size() - 1;
+
+    // Count the length of every chunk, offsets[i + 1] is the length of the chunk i for now
+    std::vector<std::size_t> offsets(count + 1, 0);
+    std::vector<std::size_t> errors(count, impl_npos);
+    executor(count, [&](std::size_t i) {
+        const std::basic_string_view<Src> chunk = src.substr(bounds[i], bounds[i + 1] - bounds[i]);
+        offsets[i + 1] = t_utf_count<std::basic_string<Dst>, std::basic_string_view<Src>, FnCount>(chunk, error ? &errors[i] : nullptr);
+    });
+
+    if (error)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (errors[i] != impl_npos)
+            {
+                *error = bounds[i] + errors[i];
+                return std::basic_string<Dst>{};
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+        offsets[i + 1] += offsets[i];
+
+    std::basic_string<Dst> dst;
+
+    if (offsets[count] > dst.max_size()) // Overflow protection
+    {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+
+    dst.resize(offsets[count]);
+    executor(count, [&](std::size_t i) {
+        t_utf_ptr<Src, Dst, FnUTF>(src.data() + bounds[i], bounds[i + 1] - bounds[i],
+                                   dst.data() + offsets[i], offsets[i + 1] - offsets[i], nullptr);
+    });
+
+    return dst;
+}
+
+template<typename Src, typename Dst, std::size_t SrcUTF,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnUTF)(typename std::basic_string_view<Src>::const_iterator, typename std::basic_string_view<Src>::const_iterator, Dst*, size_t*),
+    size_t(*FnCount)(typename std::basic_string_view<Src>::const_iterator, typename std::basic_string_view<Src>::const_iterator, count_out, size_t*),
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnUTF)(const Src*, const Src*, Dst*, size_t*),
+    size_t(*FnCount)(const Src*, const Src*, count_out, size_t*),
+#else // Safe layer
+    size_t(*FnUTF)(safe::in<const Src*>, safe::end<const Src*>, safe::out<Dst*>, size_t*),
+    size_t(*FnCount)(safe::in<const Src*>, safe::end<const Src*>, count_out, size_t*),
+#endif
+    class Executor, class FnSerial>
+std::basic_string<Dst> t_utf_parallel(std::basic_string_view<Src> src, Executor&& executor,
+                                      std::size_t chunk_size, una::error& error, FnSerial serial)
+{
+    error.reset();
+
+    std::size_t err = impl_npos;
+
+    std::basic_string<Dst> dst = t_utf_parallel<Src, Dst, SrcUTF, FnUTF, FnCount>(src, executor, chunk_size, &err,
+        [&error, &serial](std::basic_string_view<Src> s) { return serial(s, error); });
+    if (err != impl_npos)
+        error = una::error{una::error::code::ill_formed_utf, err};
+
+    return dst;
+}
+
+} // namespace una::detail
+
+namespace unx {
+
+// Parallel conversion: the same functions as una::utf8to16 and others but the source is split to chunks
+// that are converted in parallel by the executor (see unx::thread_executor), by default all hardware threads are used.
+// Sources smaller than two chunks are converted on the calling thread.
+// The result and the error position are always the same as the result of the serial functions.
+
+template<typename UTF8, typename UTF16, class Executor = thread_executor>
+std::basic_string<UTF16>
+utf8to16_parallel(std::basic_string_view<UTF8> source, Executor&& executor = Executor{}, std::size_t chunk_size = una::detail::parallel_chunk_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return una::detail::t_utf_parallel<UTF8, UTF16, 8, una::detail::impl_utf8to16, una::detail::impl_utf8to16>(source, executor, chunk_size, nullptr,
+        [](std::basic_string_view<UTF8> s) { return una::utf8to16<UTF8, UTF16>(s); });
+}
+template<typename UTF16, typename UTF8, class Executor = thread_executor>
+std::basic_string<UTF8>
+utf16to8_parallel(std::basic_string_view<UTF16> source, Executor&& executor = Executor{}, std::size_t chunk_size = una::detail::parallel_chunk_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return una::detail::t_utf_parallel<UTF16, UTF8, 16, una::detail::impl_utf16to8, una::detail::impl_utf16to8>(source, executor, chunk_size, nullptr,
+        [](std::basic_string_view<UTF16> s) { return una::utf16to8<UTF16, UTF8>(s); });
+}
+template<typename UTF8, typename UTF32, class Executor = thread_executor>
+std::basic_string<UTF32>
+utf8to32_parallel(std::basic_string_view<UTF8> source, Executor&& executor = Executor{}, std::size_t chunk_size = una::detail::parallel_chunk_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return una::detail::t_utf_parallel<UTF8, UTF32, 8, una::detail::impl_utf8to32, una::detail::impl_utf8to32>(source, executor, chunk_size, nullptr,
+        [](std::basic_string_view<UTF8> s) { return una::utf8to32<UTF8, UTF32>(s); });
+}
+
+inline std::u16string utf8to16u_parallel(std::string_view source)
+{
+    return utf8to16_parallel<char, char16_t>(source);
+}
+inline std::string utf16to8_parallel(std::u16string_view source)
+{
+    return utf16to8_parallel<char16_t, char>(source);
+}
+inline std::u32string utf8to32u_parallel(std::string_view source)
+{
+    return utf8to32_parallel<char, char32_t>(source);
+}
+
+namespace strict {
+
+template<typename UTF8, typename UTF16, class Executor = thread_executor>
+std::basic_string<UTF16>
+utf8to16_parallel(std::basic_string_view<UTF8> source, una::error& error, Executor&& executor = Executor{}, std::size_t chunk_size = una::detail::parallel_chunk_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return una::detail::t_utf_parallel<UTF8, UTF16, 8, una::detail::impl_utf8to16, una::detail::impl_utf8to16>(source, executor, chunk_size, error,
+        [](std::basic_string_view<UTF8> s, una::error& e) { return una::strict::utf8to16<UTF8, UTF16>(s, e); });
+}
+template<typename UTF16, typename UTF8, class Executor = thread_executor>
+std::basic_string<UTF8>
+utf16to8_parallel(std::basic_string_view<UTF16> source, una::error& error, Executor&& executor = Executor{}, std::size_t chunk_size = una::detail::parallel_chunk_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return una::detail::t_utf_parallel<UTF16, UTF8, 16, una::detail::impl_utf16to8, una::detail::impl_utf16to8>(source, executor, chunk_size, error,
+        [](std::basic_string_view<UTF16> s, una::error& e) { return una::strict::utf16to8<UTF16, UTF8>(s, e); });
+}
+template<typename UTF8, typename UTF32, class Executor = thread_executor>
+std::basic_string<UTF32>
+utf8to32_parallel(std::basic_string_view<UTF8> source, una::error& error, Executor&& executor = Executor{}, std::size_t chunk_size = una::detail::parallel_chunk_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+    static_assert(std::is_integral_v<UTF32> && sizeof(UTF32) >= sizeof(char32_t));
+
+    return una::detail::t_utf_parallel<UTF8, UTF32, 8, una::detail::impl_utf8to32, una::detail::impl_utf8to32>(source, executor, chunk_size, error,
+        [](std::basic_string_view<UTF8> s, una::error& e) { return una::strict::utf8to32<UTF8, UTF32>(s, e); });
+}
+
+inline std::u16string utf8to16u_parallel(std::string_view source, una::error& error)
+{
+    return utf8to16_parallel<char, char16_t>(source, error);
+}
+inline std::string utf16to8_parallel(std::u16string_view source, una::error& error)
+{
+    return utf16to8_parallel<char16_t, char>(source, error);
+}
+inline std::u32string utf8to32u_parallel(std::string_view source, una::error& error)
+{
+    return utf8to32_parallel<char, char32_t>(source, error);
+}
+
+} // namespace strict
+
+#ifndef UNI_ALGO_DISABLE_NORM
+
+namespace norm {
+
+// Parallel normalization: the source is split to chunks on boundaries where the result is the same
+// as if the whole string was normalized at once and the chunks are normalized in parallel so the result
+// is always the same as the result of una::norm functions. Executor runs the chunks (see unx::thread_executor),
+// by default all hardware threads are used. Sources smaller than two chunks are normalized on the calling thread.
+
+template<typename UTF8, class Executor = thread_executor>
+std::basic_string<UTF8>
+to_nfc_utf8_parallel(std::basic_string_view<UTF8> source, Executor&& executor = Executor{}, std::size_t chunk_size = una::detail::parallel_chunk_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    using traits = una::detail::norm_bounded<UTF8, UTF8, 8, una::detail::impl_norm_is_nfc_qc_yes_prop, una::detail::impl_norm_to_nfc_utf8>;
+    return una::detail::t_parallel<UTF8>(source, executor, chunk_size, traits::split,
+        [](std::basic_string_view<UTF8> s) { return una::norm::to_nfc_utf8<UTF8>(s); });
+}
+template<typename UTF8, class Executor = thread_executor>
+std::basic_string<UTF8>
+to_nfd_utf8_parallel(std::basic_string_view<UTF8> source, Executor&& executor = Executor{}, std::size_t chunk_size = una::detail::parallel_chunk_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    using traits = una::detail::norm_bounded<UTF8, UTF8, 8, una::detail::impl_norm_is_nfc_qc_yes_prop, una::detail::impl_norm_to_nfd_utf8>;
+    return una::detail::t_parallel<UTF8>(source, executor, chunk_size, traits::split,
+        [](std::basic_string_view<UTF8> s) { return una::norm::to_nfd_utf8<UTF8>(s); });
+}
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+template<typename UTF8, class Executor = thread_executor>
+std::basic_string<UTF8>
+to_nfkc_utf8_parallel(std::basic_string_view<UTF8> source, Executor&& executor = Executor{}, std::size_t chunk_size = una::detail::parallel_chunk_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    using traits = una::detail::norm_bounded<UTF8, UTF8, 8, una::detail::impl_norm_is_nfkc_qc_yes_prop, una::detail::impl_norm_to_nfkc_utf8>;
+    return una::detail::t_parallel<UTF8>(source, executor, chunk_size, traits::split,
+        [](std::basic_string_view<UTF8> s) { return una::norm::to_nfkc_utf8<UTF8>(s); });
+}
+template<typename UTF8, class Executor = thread_executor>
+std::basic_string<UTF8>
+to_nfkd_utf8_parallel(std::basic_string_view<UTF8> source, Executor&& executor = Executor{}, std::size_t chunk_size = una::detail::parallel_chunk_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    using traits = una::detail::norm_bounded<UTF8, UTF8, 8, una::detail::impl_norm_is_nfkc_qc_yes_prop, una::detail::impl_norm_to_nfkd_utf8>;
+    return una::detail::t_parallel<UTF8>(source, executor, chunk_size, traits::split,
+        [](std::basic_string_view<UTF8> s) { return una::norm::to_nfkd_utf8<UTF8>(s); });
+}
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+template<typename UTF16, class Executor = thread_executor>
+std::basic_string<UTF16>
+to_nfc_utf16_parallel(std::basic_string_view<UTF16> source, Executor&& executor = Executor{}, std::size_t chunk_size = una::detail::parallel_chunk_size)
+{
+    static_assert(std::is_integral_v<UTF16>);
+
+    using traits = una::detail::norm_bounded<UTF16, UTF16, 16, una::detail::impl_norm_is_nfc_qc_yes_prop, una::detail::impl_norm_to_nfc_utf16>;
+    return una::detail::t_parallel<UTF16>(source, executor, chunk_size, traits::split,
+        [](std::basic_string_view<UTF16> s) { return una::norm::to_nfc_utf16<UTF16>(s); });
+}
+template<typename UTF16, class Executor = thread_executor>
+std::basic_string<UTF16>
+to_nfd_utf16_parallel(std::basic_string_view<UTF16> source, Executor&& executor = Executor{}, std::size_t chunk_size = una::detail::parallel_chunk_size)
+{
+    static_assert(std::is_integral_v<UTF16>);
+
+    using traits = una::detail::norm_bounded<UTF16, UTF16, 16, una::detail::impl_norm_is_nfc_qc_yes_prop, una::detail::impl_norm_to_nfd_utf16>;
+    return una::detail::t_parallel<UTF16>(source, executor, chunk_size, traits::split,
+        [](std::basic_string_view<UTF16> s) { return una::norm::to_nfd_utf16<UTF16>(s); });
+}
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+template<typename UTF16, class Executor = thread_executor>
+std::basic_string<UTF16>
+to_nfkc_utf16_parallel(std::basic_string_view<UTF16> source, Executor&& executor = Executor{}, std::size_t chunk_size = una::detail::parallel_chunk_size)
+{
+    static_assert(std::is_integral_v<UTF16>);
+
+    using traits = una::detail::norm_bounded<UTF16, UTF16, 16, una::detail::impl_norm_is_nfkc_qc_yes_prop, una::detail::impl_norm_to_nfkc_utf16>;
+    return una::detail::t_parallel<UTF16>(source, executor, chunk_size, traits::split,
+        [](std::basic_string_view<UTF16> s) { return una::norm::to_nfkc_utf16<UTF16>(s); });
+}
+template<typename UTF16, class Executor = thread_executor>
+std::basic_string<UTF16>
+to_nfkd_utf16_parallel(std::basic_string_view<UTF16> source, Executor&& executor = Executor{}, std::size_t chunk_size = una::detail::parallel_chunk_size)
+{
+    static_assert(std::is_integral_v<UTF16>);
+
+    using traits = una::detail::norm_bounded<UTF16, UTF16, 16, una::detail::impl_norm_is_nfkc_qc_yes_prop, una::detail::impl_norm_to_nfkd_utf16>;
+    return una::detail::t_parallel<UTF16>(source, executor, chunk_size, traits::split,
+        [](std::basic_string_view<UTF16> s) { return una::norm::to_nfkd_utf16<UTF16>(s); });
+}
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+inline std::string to_nfc_utf8_parallel(std::string_view source)
+{
+    return to_nfc_utf8_parallel<char>(source);
+}
+inline std::string to_nfd_utf8_parallel(std::string_view source)
+{
+    return to_nfd_utf8_parallel<char>(source);
+}
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+inline std::string to_nfkc_utf8_parallel(std::string_view source)
+{
+    return to_nfkc_utf8_parallel<char>(source);
+}
+inline std::string to_nfkd_utf8_parallel(std::string_view source)
+{
+    return to_nfkd_utf8_parallel<char>(source);
+}
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+inline std::u16string to_nfc_utf16_parallel(std::u16string_view source)
+{
+    return to_nfc_utf16_parallel<char16_t>(source);
+}
+inline std::u16string to_nfd_utf16_parallel(std::u16string_view source)
+{
+    return to_nfd_utf16_parallel<char16_t>(source);
+}
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+inline std::u16string to_nfkc_utf16_parallel(std::u16string_view source)
+{
+    return to_nfkc_utf16_parallel<char16_t>(source);
+}
+inline std::u16string to_nfkd_utf16_parallel(std::u16string_view source)
+{
+    return to_nfkd_utf16_parallel<char16_t>(source);
+}
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+} // namespace norm
+
+#endif // UNI_ALGO_DISABLE_NORM
+
+} // namespace unx
+
+#endif // UNI_ALGO_EXT_PARALLEL_H_UAIH
@@ -4,7 +4,9 @@
 
 UNI_ALGO_IMPL_NAMESPACE_BEGIN
 
-uaix_const_data uaix_data_array(unsigned char, stage1_ccc_qc, 8704) = {
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+
+uaix_const_data uaix_data_array(unsigned char, stage1_ccc_qc_decomp, 8704) = {
 0,1,2,3,4,5,6,7,
 8,9,0,10,11,12,13,14,
 15,16,17,18,19,20,21,22,
@@ -67,16 +69,16 @@ uaix_const_data uaix_data_array(unsigned char, stage1_ccc_qc, 8704) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,89,89,90,91,92,93,
-94,95,96,97,98,99,100,101,
-0,0,0,102,0,103,104,0,
-0,0,0,0,0,0,0,105,
-0,0,0,0,106,107,0,0,
-0,0,108,0,0,109,110,111,
-112,113,114,115,116,117,118,0,
-119,120,0,121,122,123,124,0,
-125,0,126,127,128,129,0,0,
-122,0,130,131,0,0,132,0,
+0,0,89,90,91,92,93,94,
+95,96,97,98,99,100,101,102,
+0,0,0,103,0,104,105,0,
+0,0,0,0,0,0,0,106,
+0,0,0,0,107,108,0,0,
+0,0,109,0,0,110,111,112,
+113,114,115,116,117,118,119,0,
+120,121,0,122,123,124,125,0,
+126,0,127,128,129,130,0,0,
+123,0,131,132,0,0,133,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -95,8 +97,8 @@ uaix_const_data uaix_data_array(unsigned char, stage1_ccc_qc, 8704) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,133,134,0,
-0,0,0,0,0,0,0,135,
+0,0,0,0,0,134,135,0,
+0,0,0,0,0,0,0,136,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -116,22 +118,22 @@ uaix_const_data uaix_data_array(unsigned char, stage1_ccc_qc, 8704) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,136,0,0,0,0,0,0,
+0,137,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,137,138,139,0,0,0,
-140,141,142,68,68,143,68,144,
+0,0,138,139,140,0,0,0,
+141,142,143,68,68,144,68,145,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-145,146,134,0,0,147,0,0,
-0,148,0,0,0,0,0,0,
-0,149,150,0,0,0,0,0,
-0,0,0,0,151,152,0,0,
-0,0,153,154,155,0,0,0,
+146,147,135,0,0,148,0,0,
+0,149,0,0,0,0,0,0,
+0,150,151,0,0,0,0,0,
+0,0,0,0,152,153,0,0,
+0,0,154,155,156,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,156,
+0,0,0,0,0,0,0,157,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -195,7 +197,7 @@ uaix_const_data uaix_data_array(unsigned char, stage1_ccc_qc, 8704) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-89,89,89,89,157,0,0,0,
+158,159,160,161,162,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1094,7 +1096,7 @@ uaix_const_data uaix_data_array(unsigned char, stage1_ccc_qc, 8704) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0};
 
-uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
+uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc_decomp, 20864) = {
 /* Block: 0 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1117,60 +1119,60 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-3072,0,0,0,0,0,0,0,
-7168,0,3072,0,0,0,0,7168,
-0,0,3072,3072,7168,3072,0,0,
-7168,3072,3072,0,3072,3072,3072,0,
-6656,6656,6656,6656,6656,6656,0,6656,
-6656,6656,6656,6656,6656,6656,6656,6656,
-0,6656,6656,6656,6656,6656,6656,0,
-0,6656,6656,6656,6656,6656,0,0,
-6656,6656,6656,6656,6656,6656,0,6656,
-6656,6656,6656,6656,6656,6656,6656,6656,
-0,6656,6656,6656,6656,6656,6656,0,
-0,6656,6656,6656,6656,6656,0,6656,
+1,0,0,0,0,0,0,0,
+2,0,1,0,0,0,0,2,
+0,0,1,1,2,1,0,0,
+2,1,1,0,1,1,1,0,
+3,4,5,6,7,8,0,9,
+10,11,12,13,14,15,16,17,
+0,18,19,20,21,22,23,0,
+0,24,25,26,27,28,0,0,
+29,30,31,32,33,34,0,35,
+36,37,38,39,40,41,42,43,
+0,44,45,46,47,48,49,0,
+0,50,51,52,53,54,0,55,
 /* Block: 2 */
-6656,6656,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,6656,6656,
-0,0,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,0,0,
-6656,6656,6656,6656,6656,6656,6656,6656,
-6656,0,3072,3072,6656,6656,6656,6656,
-0,6656,6656,6656,6656,6656,6656,3072,
-3072,0,0,6656,6656,6656,6656,6656,
-6656,3072,0,0,6656,6656,6656,6656,
-6656,6656,0,0,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,0,0,
-6656,6656,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,6656,3072,
+56,57,58,59,60,61,62,63,
+64,65,66,67,68,69,70,71,
+0,0,72,73,74,75,76,77,
+78,79,80,81,82,83,84,85,
+86,87,88,89,90,91,0,0,
+92,93,94,95,96,97,98,99,
+100,0,1,1,101,102,103,104,
+0,105,106,107,108,109,110,1,
+1,0,0,111,112,113,114,115,
+116,1,0,0,117,118,119,120,
+121,122,0,0,123,124,125,126,
+127,128,129,130,131,132,133,134,
+135,136,137,138,139,140,0,0,
+141,142,143,144,145,146,147,148,
+149,150,151,152,153,154,155,156,
+157,158,159,160,161,162,163,1,
 /* Block: 3 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-6656,6656,0,0,0,0,0,0,
-0,0,0,0,0,0,0,6656,
-6656,0,0,0,0,0,0,0,
+164,165,0,0,0,0,0,0,
+0,0,0,0,0,0,0,166,
+167,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,7168,7168,7168,3072,
-3072,3072,3072,3072,3072,6656,6656,6656,
-6656,6656,6656,6656,6656,10752,10752,10752,
-10752,10752,10752,10752,10752,0,10752,10752,
-10752,10752,6656,6656,0,0,6656,6656,
-6656,6656,6656,6656,10752,10752,6656,6656,
-6656,3072,3072,3072,6656,6656,0,0,
-6656,6656,10752,10752,6656,6656,6656,6656,
+0,0,0,0,2,2,2,1,
+1,1,1,1,1,168,169,170,
+171,172,173,174,175,176,177,178,
+179,180,181,182,183,0,184,185,
+186,187,188,189,0,0,190,191,
+192,193,194,195,196,197,198,199,
+200,1,1,1,201,202,0,0,
+203,204,205,206,207,208,209,210,
 /* Block: 4 */
-6656,6656,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,0,0,6656,6656,
-0,0,0,0,0,0,6656,6656,
-6656,6656,10752,10752,10752,10752,6656,6656,
-10752,10752,6656,6656,0,0,0,0,
+211,212,213,214,215,216,217,218,
+219,220,221,222,223,224,225,226,
+227,228,229,230,231,232,233,234,
+235,236,237,238,0,0,239,240,
+0,0,0,0,0,0,241,242,
+243,244,245,246,247,248,249,250,
+251,252,253,254,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1187,69 +1189,69 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,0,0,0,0,0,0,0,
+1,1,1,1,1,1,1,1,
+1,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-7168,7168,7168,7168,7168,7168,0,0,
-3072,3072,3072,3072,3072,0,0,0,
+2,2,2,2,2,2,0,0,
+1,1,1,1,1,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 6 */
-17894,17894,17894,17894,17894,16614,17894,17894,
-17894,17894,17894,17894,17894,16614,16614,17894,
-16614,17894,16614,17894,17894,16616,16604,16604,
-16604,16604,16616,17880,16604,16604,16604,16604,
-16604,16586,16586,17884,17884,17884,17884,17866,
-17866,16604,16604,16604,16604,17884,17884,16604,
-17884,17884,16604,16604,16385,16385,16385,16385,
-17665,16604,16604,16604,16604,16614,16614,16614,
-20454,20454,17894,20454,36838,17904,16614,16604,
-16604,16604,16614,16614,16614,16604,16604,0,
-16614,16614,16614,16604,16604,16604,16604,16614,
-16616,16604,16604,16614,16617,16618,16618,16617,
-16618,16618,16617,16614,16614,16614,16614,16614,
-16614,16614,16614,16614,16614,16614,16614,16614,
-0,0,0,0,3840,0,0,0,
-0,0,7168,0,0,0,3840,0,
+255,255,255,255,255,256,255,255,
+255,255,255,255,255,256,256,255,
+256,255,256,255,255,257,258,258,
+258,258,257,259,258,258,258,258,
+258,260,260,261,261,261,261,262,
+262,258,258,258,258,261,261,258,
+261,261,258,258,263,263,263,263,
+264,258,258,258,258,256,256,256,
+265,266,255,267,268,269,256,258,
+258,258,256,256,256,258,258,0,
+256,256,256,258,258,258,258,256,
+257,258,258,256,270,271,271,270,
+271,271,270,256,256,256,256,256,
+256,256,256,256,256,256,256,256,
+0,0,0,0,272,0,0,0,
+0,0,2,0,0,0,273,0,
 /* Block: 7 */
-0,0,0,0,7168,11776,6656,3840,
-6656,6656,6656,0,6656,0,6656,6656,
-10752,0,0,0,0,0,0,0,
+0,0,0,0,2,274,275,276,
+277,278,279,0,280,0,281,282,
+283,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,6656,6656,6656,6656,6656,6656,
-10752,0,0,0,0,0,0,0,
+0,0,284,285,286,287,288,289,
+290,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,6656,6656,6656,6656,6656,0,
-3072,3072,3072,7680,7680,3072,3072,0,
+0,0,291,292,293,294,295,0,
+1,1,1,296,297,1,1,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-3072,3072,3072,0,3072,3072,0,0,
-0,3072,0,0,0,0,0,0,
+1,1,1,0,1,1,0,0,
+0,1,0,0,0,0,0,0,
 /* Block: 8 */
-6656,6656,0,6656,0,0,0,6656,
-0,0,0,0,6656,6656,6656,0,
+298,299,0,300,0,0,0,301,
+0,0,0,0,302,303,304,0,
 0,0,0,0,0,0,0,0,
-0,6656,0,0,0,0,0,0,
+0,305,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,6656,0,0,0,0,0,0,
+0,306,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-6656,6656,0,6656,0,0,0,6656,
-0,0,0,0,6656,6656,6656,0,
+307,308,0,309,0,0,0,310,
+0,0,0,0,311,312,313,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,6656,6656,
+0,0,0,0,0,0,314,315,
 0,0,0,0,0,0,0,0,
 /* Block: 9 */
-0,0,0,16614,16614,16614,16614,16614,
+0,0,0,256,256,256,256,256,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1257,24 +1259,24 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,6656,6656,0,0,0,0,0,
+0,316,317,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-6656,6656,6656,6656,0,0,6656,6656,
-0,0,6656,6656,6656,6656,6656,6656,
-0,0,6656,6656,6656,6656,6656,6656,
-0,0,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,0,0,
-6656,6656,0,0,0,0,0,0,
+318,319,320,321,0,0,322,323,
+0,0,324,325,326,327,328,329,
+0,0,330,331,332,333,334,335,
+0,0,336,337,338,339,340,341,
+342,343,344,345,346,347,0,0,
+348,349,0,0,0,0,0,0,
 /* Block: 10 */
-0,0,0,0,0,0,0,3072,
+0,0,0,0,0,0,0,1,
 0,0,0,0,0,0,0,0,
-0,16604,16614,16614,16614,16614,16604,16614,
-16614,16614,16606,16604,16614,16614,16614,16614,
-16614,16614,16604,16604,16604,16604,16604,16604,
-16614,16614,16604,16614,16614,16606,16612,16614,
-16394,16395,16396,16397,16398,16399,16400,16401,
-16402,16403,16403,16404,16405,16406,0,16407,
-0,16408,16409,0,16614,16604,0,16402,
+0,258,256,256,256,256,258,256,
+256,256,350,258,256,256,256,256,
+256,256,258,258,258,258,258,258,
+256,256,258,256,256,350,351,256,
+352,353,354,355,356,357,358,359,
+360,361,361,362,363,364,0,365,
+0,366,367,0,256,258,0,360,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1285,20 +1287,20 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 /* Block: 11 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16614,16614,16614,16614,16614,16614,16614,16614,
-16414,16415,16416,0,0,0,0,0,
-0,0,6656,6656,6656,6656,6656,0,
+256,256,256,256,256,256,256,256,
+368,369,370,0,0,0,0,0,
+0,0,371,372,373,374,375,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,16411,16412,16413,16414,16415,
-16416,16417,16418,17894,17894,17884,16604,16614,
-16614,16614,16614,16614,16604,16614,16614,16604,
+0,0,0,376,377,378,368,369,
+370,379,380,255,255,261,258,256,
+256,256,256,256,258,256,256,258,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16419,0,0,0,0,3072,3072,3072,
-3072,0,0,0,0,0,0,0,
+381,0,0,0,0,1,1,1,
+1,0,0,0,0,0,0,0,
 /* Block: 12 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1308,25 +1310,25 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-6656,0,6656,0,0,0,0,0,
+382,0,383,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,6656,0,0,16614,16614,
-16614,16614,16614,16614,16614,0,0,16614,
-16614,16614,16614,16604,16614,0,0,16614,
-16614,0,16604,16614,16614,16604,0,0,
+0,0,0,384,0,0,256,256,
+256,256,256,256,256,0,0,256,
+256,256,256,258,256,0,0,256,
+256,0,258,256,256,258,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 13 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,16420,0,0,0,0,0,0,
+0,385,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16614,16604,16614,16614,16604,16614,16614,16604,
-16604,16604,16614,16604,16604,16614,16604,16614,
-16614,16614,16604,16614,16604,16614,16604,16614,
-16604,16614,16614,0,0,0,0,0,
+256,258,256,256,258,256,256,258,
+258,258,256,258,258,256,258,256,
+256,256,258,256,258,256,258,256,
+258,256,256,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1347,22 +1349,22 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,16614,16614,16614,16614,16614,
-16614,16614,16604,16614,0,0,0,0,
-0,0,0,0,0,16604,0,0,
+0,0,0,256,256,256,256,256,
+256,256,258,256,0,0,0,0,
+0,0,0,0,0,258,0,0,
 /* Block: 15 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,16614,16614,
-16614,16614,0,16614,16614,16614,16614,16614,
-16614,16614,16614,16614,0,16614,16614,16614,
-0,16614,16614,16614,16614,16614,0,0,
+0,0,0,0,0,0,256,256,
+256,256,0,256,256,256,256,256,
+256,256,256,256,0,256,256,256,
+0,256,256,256,256,256,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,16604,16604,16604,0,0,0,0,
+0,258,258,258,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1371,32 +1373,32 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16614,16604,16604,16604,16614,16614,16614,16614,
+256,258,258,258,256,256,256,256,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,16614,16614,16614,16614,16614,16604,
-16604,16604,16604,16604,16614,16614,16614,16614,
-16614,16614,16614,16614,16614,16614,16614,16614,
-16614,16614,0,16604,16614,16614,16604,16614,
-16614,16604,16614,16614,16614,16604,16604,16604,
-16411,16412,16413,16614,16614,16614,16604,16614,
-16614,16604,16604,16614,16614,16614,16614,16614,
+0,0,256,256,256,256,256,258,
+258,258,258,258,256,256,256,256,
+256,256,256,256,256,256,256,256,
+256,256,0,258,256,256,258,256,
+256,258,256,256,256,258,258,258,
+376,377,378,256,256,256,258,256,
+256,258,258,256,256,256,256,256,
 /* Block: 17 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,6656,0,0,0,0,0,0,
-0,6656,0,0,6656,0,0,0,
-0,0,0,0,17671,0,0,0,
+0,386,0,0,0,0,0,0,
+0,387,0,0,388,0,0,0,
+0,0,0,0,389,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,16393,0,0,
-0,16614,16604,16614,16614,0,0,0,
-7936,7936,7936,7936,7936,7936,7936,7936,
+0,0,0,0,0,390,0,0,
+0,256,258,256,256,0,0,0,
+391,392,393,394,395,396,397,398,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1409,15 +1411,15 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16391,0,1280,0,
+0,0,0,0,399,0,400,0,
 0,0,0,0,0,0,0,0,
-0,0,0,2560,2560,16393,0,0,
-0,0,0,0,0,0,0,1280,
-0,0,0,0,7936,7936,0,7936,
+0,0,0,401,402,390,0,0,
+0,0,0,0,0,0,0,400,
+0,0,0,0,403,404,0,405,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,16614,0,
+0,0,0,0,0,0,256,0,
 /* Block: 19 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1425,12 +1427,12 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,7936,0,0,7936,0,
-0,0,0,0,16391,0,0,0,
+0,0,0,406,0,0,407,0,
+0,0,0,0,399,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,16393,0,0,
+0,0,0,0,0,390,0,0,
 0,0,0,0,0,0,0,0,
-0,7936,7936,7936,0,0,7936,0,
+0,408,409,410,0,0,411,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1443,9 +1445,9 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16391,0,0,0,
+0,0,0,0,399,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,16393,0,0,
+0,0,0,0,0,390,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1460,11 +1462,11 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16391,0,1280,0,
+0,0,0,0,399,0,400,0,
 0,0,0,0,0,0,0,0,
-2560,0,0,2560,2560,16393,0,0,
-0,0,0,0,0,0,1280,1280,
-0,0,0,0,7936,7936,0,0,
+412,0,0,413,414,390,0,0,
+0,0,0,0,0,0,400,400,
+0,0,0,0,415,416,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1472,15 +1474,15 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 /* Block: 22 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,2560,0,0,0,
+0,0,0,0,417,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1280,0,
+0,0,0,0,0,0,400,0,
 0,0,0,0,0,0,0,0,
-0,0,2560,2560,2560,16393,0,0,
-0,0,0,0,0,0,0,1280,
+0,0,418,419,420,390,0,0,
+0,0,0,0,0,0,0,400,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1494,10 +1496,10 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16391,0,0,0,
+0,0,0,0,399,0,0,0,
 0,0,0,0,0,0,0,0,
-6656,0,0,0,0,16393,0,0,
-0,0,0,0,0,16468,17755,0,
+421,0,0,0,0,390,0,0,
+0,0,0,0,0,422,423,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1511,10 +1513,10 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16391,0,0,0,
-2560,0,1280,0,0,0,0,2560,
-2560,0,2560,2560,0,16393,0,0,
-0,0,0,0,0,1280,1280,0,
+0,0,0,0,399,0,0,0,
+424,0,400,0,0,0,0,425,
+426,0,427,428,0,390,0,0,
+0,0,0,0,0,400,400,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1528,10 +1530,10 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,16393,16393,0,1280,0,
+0,0,0,390,390,0,400,0,
 0,0,0,0,0,0,0,0,
-0,0,2560,2560,2560,16393,0,0,
-0,0,0,0,0,0,0,1280,
+0,0,429,430,431,390,0,0,
+0,0,0,0,0,0,0,400,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1547,9 +1549,9 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,17673,0,0,0,0,1280,
+0,0,432,0,0,0,0,400,
 0,0,0,0,0,0,0,0,
-0,0,6656,0,2560,6656,2560,1280,
+0,0,433,0,434,435,436,400,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1561,10 +1563,10 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,3072,0,0,0,0,
-16487,16487,16393,0,0,0,0,0,
+0,0,0,1,0,0,0,0,
+437,437,390,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16491,16491,16491,16491,0,0,0,0,
+438,438,438,438,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1578,43 +1580,43 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,3072,0,0,0,0,
-16502,16502,16393,0,0,0,0,0,
+0,0,0,1,0,0,0,0,
+439,439,390,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16506,16506,16506,16506,0,0,0,0,
+440,440,440,440,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,3072,3072,0,0,
+0,0,0,0,1,1,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 29 */
 0,0,0,0,0,0,0,0,
-0,0,0,0,3072,0,0,0,
+0,0,0,0,1,0,0,0,
 0,0,0,0,0,0,0,0,
-16604,16604,0,0,0,0,0,0,
+258,258,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,16604,0,16604,
-0,16600,0,0,0,0,0,0,
-0,0,0,3840,0,0,0,0,
-0,0,0,0,0,3840,0,0,
-0,0,3840,0,0,0,0,3840,
-0,0,0,0,3840,0,0,0,
+0,0,0,0,0,258,0,258,
+0,441,0,0,0,0,0,0,
+0,0,0,442,0,0,0,0,
+0,0,0,0,0,443,0,0,
+0,0,444,0,0,0,0,445,
+0,0,0,0,446,0,0,0,
 0,0,0,0,0,0,0,0,
-0,3840,0,0,0,0,0,0,
-0,16513,16514,36608,16516,36608,7936,11264,
-7936,11264,16514,16514,16514,16514,0,0,
+0,447,0,0,0,0,0,0,
+0,448,449,450,451,452,453,454,
+455,454,449,449,449,449,0,0,
 /* Block: 30 */
-16514,36608,16614,16614,16393,0,16614,16614,
+449,456,256,256,390,0,256,256,
 0,0,0,0,0,0,0,0,
-0,0,0,3840,0,0,0,0,
-0,0,0,0,0,3840,0,0,
-0,0,3840,0,0,0,0,3840,
-0,0,0,0,3840,0,0,0,
+0,0,0,457,0,0,0,0,
+0,0,0,0,0,458,0,0,
+0,0,459,0,0,0,0,460,
+0,0,0,0,461,0,0,0,
 0,0,0,0,0,0,0,0,
-0,3840,0,0,0,0,0,0,
-0,0,0,0,0,0,16604,0,
+0,462,0,0,0,0,0,0,
+0,0,0,0,0,0,258,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1627,10 +1629,10 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,2560,0,
-0,0,0,0,0,0,1280,0,
-0,0,0,0,0,0,0,16391,
-0,16393,16393,0,0,0,0,0,
+0,0,0,0,0,0,463,0,
+0,0,0,0,0,0,400,0,
+0,0,0,0,0,0,0,399,
+0,390,390,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1641,7 +1643,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 /* Block: 32 */
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,16604,0,0,
+0,0,0,0,0,258,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1655,7 +1657,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,3072,0,0,0,
+0,0,0,0,1,0,0,0,
 /* Block: 33 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1669,9 +1671,9 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,1280,1280,1280,1280,1280,1280,1280,
-1280,1280,1280,1280,1280,1280,1280,1280,
-1280,1280,1280,1280,1280,1280,0,0,
+0,400,400,400,400,400,400,400,
+400,400,400,400,400,400,400,400,
+400,400,400,400,400,400,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 34 */
 0,0,0,0,0,0,0,0,
@@ -1679,10 +1681,10 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-1280,1280,1280,1280,1280,1280,1280,1280,
-1280,1280,1280,1280,1280,1280,1280,1280,
-1280,1280,1280,1280,1280,1280,1280,1280,
-1280,1280,1280,0,0,0,0,0,
+400,400,400,400,400,400,400,400,
+400,400,400,400,400,400,400,400,
+400,400,400,400,400,400,400,400,
+400,400,400,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1702,7 +1704,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,16614,16614,16614,
+0,0,0,0,0,256,256,256,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1710,11 +1712,11 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 /* Block: 36 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16393,16393,0,0,
+0,0,0,0,390,390,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16393,0,0,0,
+0,0,0,0,390,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1735,8 +1737,8 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,16393,0,0,0,0,0,
-0,0,0,0,0,16614,0,0,
+0,0,390,0,0,0,0,0,
+0,0,0,0,0,256,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1747,7 +1749,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,16612,0,0,0,0,0,0,
+0,351,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1766,7 +1768,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,16606,16614,16604,0,0,0,0,
+0,350,256,258,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1778,8 +1780,8 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 /* Block: 40 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,16614,
-16604,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,256,
+258,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1788,10 +1790,10 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16393,0,0,0,0,0,0,0,
+390,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,16614,16614,16614,
-16614,16614,16614,16614,16614,0,0,16604,
+0,0,0,0,0,256,256,256,
+256,256,256,256,256,0,0,258,
 /* Block: 41 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1799,10 +1801,10 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16614,16614,16614,16614,16614,16604,16604,16604,
-16604,16604,16604,16614,16614,16604,0,16604,
-16604,16614,16614,16604,16604,16614,16614,16614,
-16614,16614,16604,16614,16614,16614,16614,0,
+256,256,256,256,256,258,258,258,
+258,258,258,256,256,258,0,258,
+258,256,256,258,258,256,256,256,
+256,256,258,256,256,256,256,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1810,21 +1812,21 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 42 */
-0,0,0,0,0,0,2560,0,
-2560,0,2560,0,2560,0,2560,0,
-0,0,2560,0,0,0,0,0,
+0,0,0,0,0,0,464,0,
+465,0,466,0,467,0,468,0,
+0,0,469,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16391,1280,0,0,
-0,0,0,2560,0,2560,0,0,
-2560,2560,0,2560,16393,0,0,0,
+0,0,0,0,399,400,0,0,
+0,0,0,470,0,471,0,0,
+472,473,0,474,390,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,16614,16604,16614,16614,16614,
-16614,16614,16614,16614,0,0,0,0,
+0,0,0,256,258,256,256,256,
+256,256,256,256,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 43 */
 0,0,0,0,0,0,0,0,
@@ -1832,16 +1834,16 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,16393,16393,0,0,0,0,
+0,0,390,390,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,16391,0,
+0,0,0,0,0,0,399,0,
 0,0,0,0,0,0,0,0,
-0,0,16393,16393,0,0,0,0,
+0,0,390,390,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 44 */
 0,0,0,0,0,0,0,0,
@@ -1850,7 +1852,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,16391,
+0,0,0,0,0,0,0,399,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -1871,176 +1873,176 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16614,16614,16614,0,16385,16604,16604,16604,
-16604,16604,16614,16614,16604,16604,16604,16604,
-16614,0,16385,16385,16385,16385,16385,16385,
-16385,0,0,0,0,16604,0,0,
-0,0,0,0,16614,0,0,0,
-16614,16614,0,0,0,0,0,0,
+256,256,256,0,263,258,258,258,
+258,258,256,256,258,258,258,258,
+256,0,263,263,263,263,263,263,
+263,0,0,0,0,258,0,0,
+0,0,0,0,256,0,0,0,
+256,256,0,0,0,0,0,0,
 /* Block: 46 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,3072,3072,3072,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,0,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,0,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,0,0,0,0,0,
+0,0,0,0,1,1,1,0,
+1,1,1,1,1,1,1,1,
+1,1,1,0,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-3072,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,
 /* Block: 47 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-16614,16614,16604,16614,16614,16614,16614,16614,
-16614,16614,16604,16614,16614,16618,16598,16604,
-16586,16614,16614,16614,16614,16614,16614,16614,
-16614,16614,16614,16614,16614,16614,16614,16614,
-16614,16614,16614,16614,16614,16614,16614,16614,
-16614,16614,16614,16614,16614,16614,16614,16614,
-16614,16614,16614,16614,16614,16614,16616,16612,
-16612,16604,16602,16614,16617,16604,16614,16604,
+0,0,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+256,256,258,256,256,256,256,256,
+256,256,258,256,256,271,475,258,
+260,256,256,256,256,256,256,256,
+256,256,256,256,256,256,256,256,
+256,256,256,256,256,256,256,256,
+256,256,256,256,256,256,256,256,
+256,256,256,256,256,256,257,351,
+351,258,476,256,270,258,256,258,
 /* Block: 48 */
-6656,6656,6656,6656,6656,6656,6656,6656,
-10752,10752,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,10752,10752,10752,10752,
-6656,6656,6656,6656,10752,10752,6656,6656,
-6656,6656,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,10752,10752,
-6656,6656,6656,6656,6656,6656,6656,6656,
-10752,10752,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,10752,10752,10752,10752,
-10752,10752,10752,10752,6656,6656,6656,6656,
-6656,6656,6656,6656,10752,10752,6656,6656,
-6656,6656,6656,6656,10752,10752,10752,10752,
-10752,10752,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,6656,6656,
-10752,10752,10752,10752,6656,6656,6656,6656,
+477,478,479,480,481,482,483,484,
+485,486,487,488,489,490,491,492,
+493,494,495,496,497,498,499,500,
+501,502,503,504,505,506,507,508,
+509,510,511,512,513,514,515,516,
+517,518,519,520,521,522,523,524,
+525,526,527,528,529,530,531,532,
+533,534,535,536,537,538,539,540,
+541,542,543,544,545,546,547,548,
+549,550,551,552,553,554,555,556,
+557,558,559,560,561,562,563,564,
+565,566,567,568,569,570,571,572,
+573,574,575,576,577,578,579,580,
+581,582,583,584,585,586,587,588,
+589,590,591,592,593,594,595,596,
+597,598,599,600,601,602,603,604,
 /* Block: 49 */
-6656,6656,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,6656,6656,
-6656,6656,6656,6656,6656,6656,6656,6656,
-6656,6656,3072,7680,0,0,0,0,
-6656,6656,6656,6656,10752,10752,10752,10752,
-10752,10752,10752,10752,10752,10752,10752,10752,
-10752,10752,10752,10752,10752,10752,10752,10752,
-6656,6656,6656,6656,6656,6656,10752,10752,
-10752,10752,10752,10752,10752,10752,10752,10752,
-6656,6656,6656,6656,6656,6656,6656,6656,
-10752,10752,10752,10752,10752,10752,10752,10752,
-10752,10752,10752,10752,10752,10752,10752,10752,
-10752,10752,10752,10752,6656,6656,6656,6656,
-10752,10752,10752,10752,10752,10752,10752,10752,
-10752,10752,6656,6656,6656,6656,6656,6656,
-6656,6656,0,0,0,0,0,0,
+605,606,607,608,609,610,611,612,
+613,614,615,616,617,618,619,620,
+621,622,623,624,625,626,627,628,
+629,630,1,631,0,0,0,0,
+632,633,634,635,636,637,638,639,
+640,641,642,643,644,645,646,647,
+648,649,650,651,652,653,654,655,
+656,657,658,659,660,661,662,663,
+664,665,666,667,668,669,670,671,
+672,673,674,675,676,677,678,679,
+680,681,682,683,684,685,686,687,
+688,689,690,691,692,693,694,695,
+696,697,698,699,700,701,702,703,
+704,705,706,707,708,709,710,711,
+712,713,714,715,716,717,718,719,
+720,721,0,0,0,0,0,0,
 /* Block: 50 */
-6656,6656,10752,10752,10752,10752,10752,10752,
-6656,6656,10752,10752,10752,10752,10752,10752,
-6656,6656,10752,10752,10752,10752,0,0,
-6656,6656,10752,10752,10752,10752,0,0,
-6656,6656,10752,10752,10752,10752,10752,10752,
-6656,6656,10752,10752,10752,10752,10752,10752,
-6656,6656,10752,10752,10752,10752,10752,10752,
-6656,6656,10752,10752,10752,10752,10752,10752,
-6656,6656,10752,10752,10752,10752,0,0,
-6656,6656,10752,10752,10752,10752,0,0,
-6656,6656,10752,10752,10752,10752,10752,10752,
-0,6656,0,10752,0,10752,0,10752,
-6656,6656,10752,10752,10752,10752,10752,10752,
-6656,6656,10752,10752,10752,10752,10752,10752,
-6656,7936,6656,7936,6656,7936,6656,7936,
-6656,7936,6656,7936,6656,7936,0,0,
+722,723,724,725,726,727,728,729,
+730,731,732,733,734,735,736,737,
+738,739,740,741,742,743,0,0,
+744,745,746,747,748,749,0,0,
+750,751,752,753,754,755,756,757,
+758,759,760,761,762,763,764,765,
+766,767,768,769,770,771,772,773,
+774,775,776,777,778,779,780,781,
+782,783,784,785,786,787,0,0,
+788,789,790,791,792,793,0,0,
+794,795,796,797,798,799,800,801,
+0,802,0,803,0,804,0,805,
+806,807,808,809,810,811,812,813,
+814,815,816,817,818,819,820,821,
+822,823,824,825,826,827,828,829,
+830,831,832,833,834,835,0,0,
 /* Block: 51 */
-10752,10752,14848,14848,14848,14848,14848,14848,
-10752,10752,14848,14848,14848,14848,14848,14848,
-10752,10752,14848,14848,14848,14848,14848,14848,
-10752,10752,14848,14848,14848,14848,14848,14848,
-10752,10752,14848,14848,14848,14848,14848,14848,
-10752,10752,14848,14848,14848,14848,14848,14848,
-6656,6656,10752,6656,10752,0,6656,10752,
-6656,6656,6656,7936,6656,7168,3840,7168,
-7168,11776,10752,6656,10752,0,6656,10752,
-6656,7936,6656,7936,6656,11776,11776,11776,
-6656,6656,10752,12032,0,0,6656,10752,
-6656,6656,6656,7936,0,11776,11776,11776,
-6656,6656,10752,12032,6656,6656,6656,10752,
-6656,6656,6656,7936,6656,11776,12032,3840,
-0,0,10752,6656,10752,0,6656,10752,
-6656,7936,6656,7936,6656,7936,7168,0,
+836,837,838,839,840,841,842,843,
+844,845,846,847,848,849,850,851,
+852,853,854,855,856,857,858,859,
+860,861,862,863,864,865,866,867,
+868,869,870,871,872,873,874,875,
+876,877,878,879,880,881,882,883,
+884,885,886,887,888,0,889,890,
+891,892,893,894,895,2,896,2,
+2,897,898,899,900,0,901,902,
+903,904,905,906,907,908,909,910,
+911,912,913,914,0,0,915,916,
+917,918,919,920,0,921,922,923,
+924,925,926,927,928,929,930,931,
+932,933,934,935,936,937,938,939,
+0,0,940,941,942,0,943,944,
+945,946,947,948,949,950,2,0,
 /* Block: 52 */
-3840,3840,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,0,0,0,0,0,
-0,3072,0,0,0,0,0,7168,
-0,0,0,0,0,0,0,0,
-0,0,0,0,3072,3072,3072,0,
-0,0,0,0,0,0,0,3072,
-0,0,0,3072,3072,0,3072,3072,
-0,0,0,0,3072,0,7168,0,
-0,0,0,0,0,0,0,3072,
-3072,3072,0,0,0,0,0,0,
-0,0,0,0,0,0,0,3072,
-0,0,0,0,0,0,0,3072,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-3072,3072,0,0,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
+951,952,1,1,1,1,1,1,
+1,1,1,0,0,0,0,0,
+0,1,0,0,0,0,0,2,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1,1,1,0,
+0,0,0,0,0,0,0,1,
+0,0,0,1,1,0,1,1,
+0,0,0,0,1,0,2,0,
+0,0,0,0,0,0,0,1,
+1,1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,1,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+1,1,0,0,1,1,1,1,
+1,1,1,1,1,1,1,1,
 /* Block: 53 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,0,0,0,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,0,0,
 0,0,0,0,0,0,0,0,
-3072,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16614,16614,16385,16385,16614,16614,16614,16614,
-16385,16385,16385,16614,16614,0,0,0,
-0,16614,0,0,0,16385,16385,16614,
-16604,16614,16385,16385,16604,16604,16604,16604,
-16614,0,0,0,0,0,0,0,
+256,256,263,263,256,256,256,256,
+263,263,263,256,256,0,0,0,
+0,256,0,0,0,263,263,256,
+258,256,263,263,258,258,258,258,
+256,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 54 */
-3072,3072,3072,3072,0,3072,3072,3072,
-0,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,0,3072,3072,0,
-0,3072,3072,3072,3072,3072,0,0,
-3072,3072,3072,0,3072,0,3840,0,
-3072,0,3840,7936,3072,3072,0,3072,
-3072,3072,0,3072,3072,3072,3072,3072,
-3072,3072,0,3072,3072,3072,3072,3072,
-3072,0,0,0,0,3072,3072,3072,
-3072,3072,0,0,0,0,0,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
+1,1,1,1,0,1,1,1,
+0,1,1,1,1,1,1,1,
+1,1,1,1,0,1,1,0,
+0,1,1,1,1,1,0,0,
+1,1,1,0,1,0,953,0,
+1,0,954,955,1,1,0,1,
+1,1,0,1,1,1,1,1,
+1,1,0,1,1,1,1,1,
+1,0,0,0,0,1,1,1,
+1,1,0,0,0,0,0,0,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
 /* Block: 55 */
 0,0,0,0,0,0,0,0,
-0,3072,0,0,0,0,0,0,
+0,1,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,6656,6656,0,0,0,0,
+0,0,956,957,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,6656,0,
+0,0,0,0,0,0,958,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,6656,6656,6656,
+0,0,0,0,0,959,960,961,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2048,37 +2050,37 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 56 */
-0,0,0,0,6656,0,0,0,
-0,6656,0,0,6656,0,0,0,
+0,0,0,0,962,0,0,0,
+0,963,0,0,964,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,6656,0,6656,0,
-0,0,0,0,3072,3072,0,3072,
-3072,0,0,0,0,0,0,0,
+0,0,0,0,965,0,966,0,
+0,0,0,0,1,1,0,1,
+1,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,6656,0,0,6656,0,0,6656,
-0,6656,0,0,0,0,0,0,
+0,967,0,0,968,0,0,969,
+0,970,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-6656,0,6656,0,0,0,0,0,
-0,0,0,0,0,6656,6656,6656,
-6656,6656,0,0,6656,6656,0,0,
-6656,6656,0,0,0,0,0,0,
+971,0,972,0,0,0,0,0,
+0,0,0,0,0,973,974,975,
+976,977,0,0,978,979,0,0,
+980,981,0,0,0,0,0,0,
 /* Block: 57 */
-6656,6656,0,0,6656,6656,0,0,
-6656,6656,0,0,0,0,0,0,
+982,983,0,0,984,985,0,0,
+986,987,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,6656,6656,6656,6656,
+0,0,0,0,988,989,990,991,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-6656,6656,6656,6656,0,0,0,0,
-0,0,6656,6656,6656,6656,0,0,
+992,993,994,995,0,0,0,0,
+0,0,996,997,998,999,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 58 */
@@ -2087,7 +2089,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,3840,3840,0,0,0,0,0,
+0,1000,1001,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2111,30 +2113,30 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
 /* Block: 60 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,0,0,0,0,0,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 61 */
 0,0,0,0,0,0,0,0,
-0,0,0,0,3072,0,0,0,
+0,0,0,0,1,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2147,7 +2149,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,3072,3072,3072,0,
+0,0,0,0,1,1,1,0,
 0,0,0,0,0,0,0,0,
 /* Block: 62 */
 0,0,0,0,0,0,0,0,
@@ -2161,7 +2163,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,7936,0,0,0,
+0,0,0,0,1002,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2182,7 +2184,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,3072,3072,0,0,
+0,0,0,0,1,1,0,0,
 /* Block: 64 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2197,8 +2199,8 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,16614,
-16614,16614,0,0,0,0,0,0,
+0,0,0,0,0,0,0,256,
+256,256,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 65 */
 0,0,0,0,0,0,0,0,
@@ -2214,9 +2216,9 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,3072,
+0,0,0,0,0,0,0,1,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,16393,
+0,0,0,0,0,0,0,390,
 /* Block: 66 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2230,15 +2232,15 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16614,16614,16614,16614,16614,16614,16614,16614,
-16614,16614,16614,16614,16614,16614,16614,16614,
-16614,16614,16614,16614,16614,16614,16614,16614,
-16614,16614,16614,16614,16614,16614,16614,16614,
+256,256,256,256,256,256,256,256,
+256,256,256,256,256,256,256,256,
+256,256,256,256,256,256,256,256,
+256,256,256,256,256,256,256,256,
 /* Block: 67 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,3072,
+0,0,0,0,0,0,0,1,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2249,76 +2251,76 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,3072,0,0,0,0,
+0,0,0,1,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 68 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
 /* Block: 69 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,0,0,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 70 */
-3072,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,16602,16612,16616,16606,16608,16608,
-0,0,0,0,0,0,3072,0,
-3072,3072,3072,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,6656,0,6656,0,
-6656,0,6656,0,6656,0,6656,0,
-6656,0,6656,0,6656,0,6656,0,
-6656,0,6656,0,0,6656,0,6656,
-0,6656,0,0,0,0,0,0,
-6656,6656,0,6656,6656,0,6656,6656,
-0,6656,6656,0,6656,6656,0,0,
+0,0,476,351,257,350,1003,1003,
+0,0,0,0,0,0,1,0,
+1,1,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1004,0,1005,0,
+1006,0,1007,0,1008,0,1009,0,
+1010,0,1011,0,1012,0,1013,0,
+1014,0,1015,0,0,1016,0,1017,
+0,1018,0,0,0,0,0,0,
+1019,1020,0,1021,1022,0,1023,1024,
+0,1025,1026,0,1027,1028,0,0,
 /* Block: 71 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,6656,0,0,0,
-0,17672,17672,7168,7168,0,6656,3072,
+0,0,0,0,1029,0,0,0,
+0,1030,1030,2,2,0,1031,1,
 0,0,0,0,0,0,0,0,
-0,0,0,0,6656,0,6656,0,
-6656,0,6656,0,6656,0,6656,0,
-6656,0,6656,0,6656,0,6656,0,
-6656,0,6656,0,0,6656,0,6656,
-0,6656,0,0,0,0,0,0,
-6656,6656,0,6656,6656,0,6656,6656,
-0,6656,6656,0,6656,6656,0,0,
+0,0,0,0,1032,0,1033,0,
+1034,0,1035,0,1036,0,1037,0,
+1038,0,1039,0,1040,0,1041,0,
+1042,0,1043,0,0,1044,0,1045,
+0,1046,0,0,0,0,0,0,
+1047,1048,0,1049,1050,0,1051,1052,
+0,1053,1054,0,1055,1056,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,6656,0,0,6656,
-6656,6656,6656,0,0,0,6656,3072,
+0,0,0,0,1057,0,0,1058,
+1059,1060,1061,0,0,0,1062,1,
 /* Block: 72 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2326,21 +2328,21 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
+0,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
 /* Block: 73 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,0,
-0,0,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0,
+0,0,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2354,39 +2356,39 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 74 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-0,0,0,0,0,0,0,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,0,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+0,0,0,0,0,0,0,0,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0,
 /* Block: 75 */
-3072,3072,3072,3072,7168,3072,3072,7168,
-3072,3072,3072,3072,3072,3072,3072,3072,
-7168,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,7168,3072,
-3072,7168,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,7168,3072,3072,3072,3072,3072,
-3072,3072,3072,7168,3072,3072,3072,3072,
-7168,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,7168,3072,3072,7168,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
+1,1,1,1,2,1,1,2,
+1,1,1,1,1,1,1,1,
+2,1,1,1,1,1,1,1,
+1,1,1,1,1,1,2,1,
+1,2,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,2,1,1,1,1,1,
+1,1,1,2,1,1,1,1,
+2,1,1,1,1,1,1,1,
+1,1,1,2,1,1,2,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
 /* Block: 76 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2401,14 +2403,14 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,16614,
-0,0,0,0,16614,16614,16614,16614,
-16614,16614,16614,16614,16614,16614,0,0,
+0,0,0,0,0,0,0,256,
+0,0,0,0,256,256,256,256,
+256,256,256,256,256,256,0,0,
 /* Block: 77 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,3072,3072,16614,16614,
+0,0,0,0,1,1,256,256,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2419,7 +2421,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16614,16614,0,0,0,0,0,0,
+256,256,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 78 */
 0,0,0,0,0,0,0,0,
@@ -2436,7 +2438,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-3072,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 79 */
 0,0,0,0,0,0,0,0,
@@ -2453,15 +2455,15 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,3072,3072,3072,0,0,0,
-3072,3072,0,0,0,0,0,0,
+0,0,1,1,1,0,0,0,
+1,1,0,0,0,0,0,0,
 /* Block: 80 */
-0,0,0,0,0,0,16393,0,
+0,0,0,0,0,0,390,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16393,0,0,0,
+0,0,0,0,390,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2481,13 +2483,13 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16393,0,0,0,
+0,0,0,0,390,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16614,16614,16614,16614,16614,16614,16614,16614,
-16614,16614,16614,16614,16614,16614,16614,16614,
-16614,16614,0,0,0,0,0,0,
+256,256,256,256,256,256,256,256,
+256,256,256,256,256,256,256,256,
+256,256,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 82 */
 0,0,0,0,0,0,0,0,
@@ -2495,12 +2497,12 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,16604,16604,16604,0,0,
+0,0,0,258,258,258,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,16393,0,0,0,0,
+0,0,0,390,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2513,9 +2515,9 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,16391,0,0,0,0,
+0,0,0,399,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16393,0,0,0,0,0,0,0,
+390,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2530,15 +2532,15 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16614,0,16614,16614,16604,0,0,16614,
-16614,0,0,0,0,0,16614,16614,
-0,16614,0,0,0,0,0,0,
+256,0,256,256,258,0,0,256,
+256,0,0,0,0,0,256,256,
+0,256,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,16393,0,
+0,0,0,0,0,0,390,0,
 0,0,0,0,0,0,0,0,
 /* Block: 85 */
 0,0,0,0,0,0,0,0,
@@ -2552,9 +2554,9 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,3072,3072,3072,3072,
+0,0,0,0,1,1,1,1,
 0,0,0,0,0,0,0,0,
-0,3072,0,0,0,0,0,0,
+0,1,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 86 */
@@ -2571,32 +2573,32 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,16393,0,0,
+0,0,0,0,0,390,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 87 */
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
 /* Block: 88 */
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,2560,2560,2560,2560,
-2560,2560,2560,2560,0,0,0,0,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,1063,1063,1063,1063,
+1063,1063,1063,1063,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2609,243 +2611,243 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 89 */
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
+1064,1065,1066,1067,1068,1069,1070,1071,
+1072,1073,1074,1075,1076,1077,1078,1079,
+1080,1081,1082,1083,1084,1085,1086,1087,
+1088,1089,1090,1091,1092,1093,1094,1095,
+1096,1097,1098,1099,1100,1101,1102,1103,
+1104,1105,1106,1107,1108,1109,1110,1111,
+1112,1113,1114,1115,1116,1117,1118,1119,
+1120,1121,1122,1123,1124,1125,1126,1127,
+1128,1129,1130,1131,1132,1133,1134,1135,
+1136,1137,1138,1139,1140,1141,1142,1143,
+1144,1145,1146,1147,1148,1149,1150,1151,
+1152,1153,1154,1155,1156,1157,1158,1159,
+1160,1161,1162,1163,1164,1165,1166,1167,
+1168,1169,1170,1171,1172,1173,1174,1175,
+1176,1177,1178,1179,1180,1181,1182,1183,
+1184,1185,1186,1187,1188,1189,1190,1191,
 /* Block: 90 */
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,0,0,
-3840,0,3840,0,0,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,0,
-3840,0,3840,0,0,3840,3840,0,
-0,0,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,0,0,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
+1192,1193,1194,1195,1196,1197,1198,1199,
+1200,1201,1202,1203,1204,1205,1206,1207,
+1208,1209,1210,1211,1212,1213,1214,1215,
+1216,1217,1218,1219,1220,1221,1222,1223,
+1224,1225,1226,1227,1228,1229,1230,1231,
+1232,1233,1234,1235,1236,1237,1238,1239,
+1240,1241,1242,1243,1244,1245,1246,1247,
+1248,1249,1250,1251,1252,1253,1254,1255,
+1256,1257,1258,1259,1260,1261,1262,1263,
+1264,1265,1266,1267,1268,1269,1270,1271,
+1272,1273,1274,1275,1276,1277,1278,1279,
+1280,1281,1282,1283,1284,1285,1286,1287,
+1288,1289,1290,1291,1292,1293,1294,1295,
+1296,1297,1298,1299,1300,1301,1302,1303,
+1304,1305,1306,1307,1308,1309,1310,1311,
+1312,1313,1314,1315,1316,1317,1318,1319,
 /* Block: 91 */
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,0,0,0,0,0,0,
+1320,1321,1322,1323,1324,1325,1326,1327,
+1328,1329,1330,1331,1332,1333,0,0,
+1334,0,1335,0,0,1336,1337,1338,
+1339,1340,1341,1342,1343,1344,1345,0,
+1346,0,1347,0,0,1348,1349,0,
+0,0,1350,1351,1352,1353,1354,1355,
+1356,1357,1358,1359,1360,1361,1362,1363,
+1364,1365,1366,1367,1368,1369,1370,1371,
+1372,1373,1374,1375,1376,1377,1378,1379,
+1380,1381,1382,1383,1384,1385,1386,1387,
+1388,1389,1390,1391,1392,1393,1394,1395,
+1396,1397,1398,1399,1400,1401,1402,1403,
+1404,1405,1406,1407,1408,1409,1410,1411,
+1412,1413,1414,1415,1416,1417,0,0,
+1418,1419,1420,1421,1422,1423,1424,1425,
+1426,1427,1428,1429,1430,1431,1432,1433,
+/* Block: 92 */
+1434,1435,1436,1437,1438,1439,1440,1441,
+1442,1443,1444,1445,1446,1447,1448,1449,
+1450,1451,1452,1453,1454,1455,1456,1457,
+1458,1459,1460,1461,1462,1463,1464,1465,
+1466,1467,1468,1469,1470,1471,1472,1473,
+1474,1475,1476,1477,1478,1479,1480,1481,
+1482,1483,1484,1485,1486,1487,1488,1489,
+1490,1491,1492,1493,1494,1495,1496,1497,
+1498,1499,1500,1501,1502,1503,1504,1505,
+1506,1507,1508,1509,1510,1511,1512,1513,
+1514,1515,1516,1517,1518,1519,1520,1521,
+1522,1523,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 92 */
-3072,3072,3072,3072,3072,3072,3072,0,
-0,0,0,0,0,0,0,0,
-0,0,0,3072,3072,3072,3072,3072,
-0,0,0,0,0,7936,16410,7936,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,7936,7936,12032,12032,7936,7936,
-7936,7936,7936,7936,7936,7936,7936,0,
-7936,7936,7936,7936,7936,0,7936,0,
-7936,7936,0,7936,7936,0,7936,7936,
-7936,7936,7936,7936,7936,7936,7936,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
 /* Block: 93 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,7168,7168,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-7168,7168,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
+1,1,1,1,1,1,1,0,
+0,0,0,0,0,0,0,0,
+0,0,0,1,1,1,1,1,
+0,0,0,0,0,1524,1525,1526,
+1,1,1,1,1,1,1,1,
+1,1,1527,1528,1529,1530,1531,1532,
+1533,1534,1535,1536,1537,1538,1539,0,
+1540,1541,1542,1543,1544,0,1545,0,
+1546,1547,0,1548,1549,0,1550,1551,
+1552,1553,1554,1555,1556,1557,1558,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
 /* Block: 94 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,7168,7168,7168,11264,11264,
-11264,11264,11264,11264,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,2,2,1,1,
+1,1,1,1,1,1,1,1,
+2,2,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
 /* Block: 95 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-7168,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,7168,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,11264,11264,11264,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,2,2,2,454,454,
+454,454,454,454,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
 /* Block: 96 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,7168,7168,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+2,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,2,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,454,454,454,1,1,1,
+1,1,1,1,1,1,1,1,
 /* Block: 97 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-0,0,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,2,2,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+/* Block: 98 */
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+0,0,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,0,0,0,
-/* Block: 98 */
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,0,0,
+/* Block: 99 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,0,0,0,0,0,0,
-16614,16614,16614,16614,16614,16614,16614,16604,
-16604,16604,16604,16604,16604,16604,16614,16614,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,0,0,3072,
-3072,7168,7168,7168,7168,3072,3072,3072,
-3072,3072,3072,0,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,0,
-3072,3072,3072,3072,0,0,0,0,
-7168,7168,7168,0,7168,0,7168,7168,
-7168,7168,7168,7168,7168,7168,7168,7168,
-/* Block: 99 */
-3072,7168,7168,7168,7168,7168,7168,7168,
-7168,7168,7168,7168,7168,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,7168,7168,7168,
-7168,7168,7168,3072,3072,0,0,0,
+1,1,1,1,1,1,1,1,
+1,1,0,0,0,0,0,0,
+256,256,256,256,256,256,256,258,
+258,258,258,258,258,258,256,256,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,0,1,
+1,2,2,2,2,1,1,1,
+1,1,1,0,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0,
+1,1,1,1,0,0,0,0,
+2,2,2,0,2,0,2,2,
+2,2,2,2,2,2,2,2,
 /* Block: 100 */
-0,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
+1,2,2,2,2,2,2,2,
+2,2,2,2,2,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,2,2,2,
+2,2,2,1,1,0,0,0,
 /* Block: 101 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,19456,19456,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,0,
-0,0,3072,3072,3072,3072,3072,3072,
-0,0,3072,3072,3072,3072,3072,3072,
-0,0,3072,3072,3072,3072,3072,3072,
-0,0,3072,3072,3072,0,0,0,
-3072,3072,3072,7168,3072,3072,3072,0,
-3072,3072,3072,3072,3072,3072,3072,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
+0,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
 /* Block: 102 */
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1559,1559,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0,
+0,0,1,1,1,1,1,1,
+0,0,1,1,1,1,1,1,
+0,0,1,1,1,1,1,1,
+0,0,1,1,1,0,0,0,
+1,1,1,2,1,1,1,0,
+1,1,1,1,1,1,1,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,16604,0,0,
 /* Block: 103 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2859,10 +2861,10 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16604,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,258,0,0,
 /* Block: 104 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2876,19 +2878,11 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+258,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,16614,16614,
-16614,16614,16614,0,0,0,0,0,
 /* Block: 105 */
-0,3072,3072,3072,3072,3072,0,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,0,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2897,15 +2891,23 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 106 */
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,16604,0,16614,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16614,16385,16604,0,0,0,0,16393,
+0,0,0,0,0,0,256,256,
+256,256,256,0,0,0,0,0,
+/* Block: 106 */
+0,1,1,1,1,1,0,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,0,1,1,1,1,1,1,
+1,1,1,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2916,19 +2918,19 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 /* Block: 107 */
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,258,0,256,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+256,263,258,0,0,0,0,390,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,16614,16604,0,
-0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 108 */
@@ -2936,7 +2938,6 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16614,16614,16614,16614,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2945,6 +2946,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,256,258,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2953,8 +2955,9 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,256,256,256,256,
+0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,16614,16614,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2964,26 +2967,24 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,16604,16604,16604,
 /* Block: 110 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,256,256,0,0,0,
+0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,16604,16604,
-16614,16614,16614,16604,16614,16604,16604,16604,
-16604,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,258,258,258,
 /* Block: 111 */
-0,0,16614,16604,16614,16604,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -2992,14 +2993,18 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,258,258,
+256,256,256,258,256,258,258,258,
+258,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 112 */
+0,0,256,258,256,258,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 112 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3008,64 +3013,61 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,16393,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16393,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,16393,
 /* Block: 113 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,6656,0,6656,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,6656,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,16393,17671,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,390,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+390,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,390,
 /* Block: 114 */
-16614,16614,16614,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1280,
-0,0,0,0,0,0,2560,2560,
-0,0,0,16393,16393,0,0,0,
+0,0,1560,0,1561,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,1562,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,390,389,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,16391,0,0,0,0,
-0,0,0,0,0,0,0,0,
-/* Block: 115 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 115 */
+256,256,256,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,400,
+0,0,0,0,0,0,1563,1564,
+0,0,0,390,390,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16393,0,0,0,0,0,0,0,
-0,0,16391,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,399,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 116 */
 0,0,0,0,0,0,0,0,
@@ -3074,10 +3076,10 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,16393,16391,0,
-0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+390,0,0,0,0,0,0,0,
+0,0,399,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3091,6 +3093,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,390,399,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3098,7 +3101,6 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,16391,16393,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 118 */
@@ -3109,31 +3111,31 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,16391,16391,0,1280,0,
 0,0,0,0,0,0,0,0,
-0,0,0,2560,2560,16393,0,0,
-0,0,0,0,0,0,0,1280,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,16614,16614,
-16614,16614,16614,16614,16614,0,0,0,
-16614,16614,16614,16614,16614,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 119 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,399,390,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 119 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,16393,0,0,0,16391,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,16614,0,
 0,0,0,0,0,0,0,0,
+0,0,0,399,399,0,400,0,
 0,0,0,0,0,0,0,0,
+0,0,0,1565,1566,390,0,0,
+0,0,0,0,0,0,0,400,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,256,256,
+256,256,256,256,256,0,0,0,
+256,256,256,256,256,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 120 */
 0,0,0,0,0,0,0,0,
@@ -3142,12 +3144,12 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-1280,0,0,0,0,0,0,0,
-0,0,1280,2560,2560,1280,2560,0,
-0,0,16393,16391,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,390,0,0,0,399,0,
+0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,256,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3158,10 +3160,10 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1280,
 0,0,0,0,0,0,0,0,
-0,0,2560,2560,0,0,0,16393,
-16391,0,0,0,0,0,0,0,
+400,0,0,0,0,0,0,0,
+0,0,400,1567,1568,400,1569,0,
+0,0,390,399,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3175,10 +3177,10 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,400,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,16393,
-0,0,0,0,0,0,0,0,
+0,0,1570,1571,0,0,0,390,
+399,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3193,8 +3195,8 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,16393,16391,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,390,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3209,8 +3211,8 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,16393,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,390,399,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3226,9 +3228,9 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,390,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,16393,16391,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3244,30 +3246,30 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-1280,0,0,0,0,0,0,0,
-2560,0,0,0,0,16393,16393,0,
-0,0,0,16391,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,390,399,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 127 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 127 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+400,0,0,0,0,0,0,0,
+1572,0,0,0,0,390,390,0,
+0,0,0,399,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16393,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3278,26 +3280,26 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16393,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,16393,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+390,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 129 */
 0,0,0,0,0,0,0,0,
+/* Block: 129 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,16393,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,390,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,390,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3309,12 +3311,12 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,390,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,16391,0,16393,16393,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3325,13 +3327,13 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 /* Block: 131 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,16393,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,399,0,390,390,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3342,13 +3344,13 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 /* Block: 132 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,390,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,16393,16393,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3365,13 +3367,13 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,390,390,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16385,16385,16385,16385,16385,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 134 */
 0,0,0,0,0,0,0,0,
@@ -3380,7 +3382,6 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16614,16614,16614,16614,16614,16614,16614,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3389,6 +3390,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+263,263,263,263,263,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 135 */
 0,0,0,0,0,0,0,0,
@@ -3397,6 +3399,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+256,256,256,256,256,256,256,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3405,13 +3408,11 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16390,16390,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 136 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,16385,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3423,11 +3424,13 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+1573,1573,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 137 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,263,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3436,21 +3439,11 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,7936,7936,
-12032,12032,12032,12032,12032,16600,16600,16385,
-16385,16385,0,0,0,16610,16600,16600,
-16600,16600,16600,0,0,0,0,0,
-0,0,0,16604,16604,16604,16604,16604,
-/* Block: 138 */
-16604,16604,16604,0,0,16614,16614,16614,
-16614,16614,16604,16604,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,16614,16614,16614,16614,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,7936,7936,12032,12032,12032,
-12032,0,0,0,0,0,0,0,
+/* Block: 138 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3458,16 +3451,25 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 139 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1574,1575,
+1576,1577,1578,1579,1580,441,441,263,
+263,263,0,0,0,1581,441,441,
+441,441,441,0,0,0,0,0,
+0,0,0,258,258,258,258,258,
+/* Block: 139 */
+258,258,258,0,0,256,256,256,
+256,256,258,258,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,256,256,256,256,0,0,
 0,0,0,0,0,0,0,0,
-0,0,16614,16614,16614,0,0,0,
+0,0,0,1582,1583,1584,1585,1586,
+1587,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3476,115 +3478,15 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 140 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,0,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-/* Block: 141 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,0,3072,3072,
-0,0,3072,0,0,3072,3072,0,
-0,3072,3072,3072,3072,0,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,0,3072,0,3072,3072,3072,
-3072,3072,3072,3072,0,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-/* Block: 142 */
-3072,3072,3072,3072,3072,3072,0,3072,
-3072,3072,3072,0,0,3072,3072,3072,
-3072,3072,3072,3072,3072,0,3072,3072,
-3072,3072,3072,3072,3072,0,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,0,3072,3072,3072,3072,0,
-3072,3072,3072,3072,3072,0,3072,0,
-0,0,3072,3072,3072,3072,3072,3072,
-3072,0,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-/* Block: 143 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,0,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-/* Block: 144 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,0,0,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-/* Block: 145 */
-16614,16614,16614,16614,16614,16614,16614,0,
-16614,16614,16614,16614,16614,16614,16614,16614,
-16614,16614,16614,16614,16614,16614,16614,16614,
-16614,0,0,16614,16614,16614,16614,16614,
-16614,16614,0,16614,16614,0,16614,16614,
-16614,16614,16614,0,0,0,0,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 146 */
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,16614,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,256,256,256,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3592,15 +3494,115 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 141 */
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+/* Block: 142 */
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,0,1,1,
+0,0,1,0,0,1,1,0,
+0,1,1,1,1,0,1,1,
+1,1,1,1,1,1,1,1,
+1,1,0,1,0,1,1,1,
+1,1,1,1,0,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+/* Block: 143 */
+1,1,1,1,1,1,0,1,
+1,1,1,0,0,1,1,1,
+1,1,1,1,1,0,1,1,
+1,1,1,1,1,0,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,0,1,1,1,1,0,
+1,1,1,1,1,0,1,0,
+0,0,1,1,1,1,1,1,
+1,0,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+/* Block: 144 */
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0,0,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+/* Block: 145 */
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,0,0,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+/* Block: 146 */
+256,256,256,256,256,256,256,0,
+256,256,256,256,256,256,256,256,
+256,256,256,256,256,256,256,256,
+256,0,0,256,256,256,256,256,
+256,256,0,256,256,0,256,256,
+256,256,256,0,0,0,0,0,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 147 */
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,256,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,16614,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3608,16 +3610,16 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16614,16614,16614,16614,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 148 */
 0,0,0,0,0,0,0,0,
+/* Block: 148 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,256,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3625,7 +3627,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16616,16616,16604,16614,
+0,0,0,0,256,256,256,256,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 149 */
@@ -3639,10 +3641,10 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-16604,16604,16604,16604,16604,16604,16604,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,257,257,258,256,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 150 */
@@ -3654,40 +3656,15 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,16614,16614,16614,16614,
-16614,16614,16391,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+258,258,258,258,258,258,258,0,
+0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 151 */
-3072,3072,3072,3072,0,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-0,3072,3072,0,3072,0,0,3072,
-0,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,0,3072,3072,3072,3072,
-0,3072,0,3072,0,0,0,0,
-0,0,3072,0,0,0,0,3072,
-0,3072,0,3072,0,3072,3072,3072,
-0,3072,3072,0,3072,0,0,3072,
-0,3072,0,3072,0,3072,0,3072,
-0,3072,3072,0,3072,0,0,3072,
-3072,3072,3072,0,3072,3072,3072,3072,
-3072,3072,3072,0,3072,3072,3072,3072,
-0,3072,3072,3072,3072,0,3072,0,
-/* Block: 152 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,0,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,0,0,0,0,
-0,3072,3072,3072,0,3072,3072,3072,
-3072,3072,0,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3696,33 +3673,69 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,256,256,256,256,
+256,256,399,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 152 */
+1,1,1,1,0,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+0,1,1,0,1,0,0,1,
+0,1,1,1,1,1,1,1,
+1,1,1,0,1,1,1,1,
+0,1,0,1,0,0,0,0,
+0,0,1,0,0,0,0,1,
+0,1,0,1,0,1,1,1,
+0,1,1,0,1,0,0,1,
+0,1,0,1,0,1,0,1,
+0,1,1,0,1,0,0,1,
+1,1,1,0,1,1,1,1,
+1,1,1,0,1,1,1,1,
+0,1,1,1,1,0,1,0,
 /* Block: 153 */
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,0,0,0,0,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
+1,1,1,1,1,1,1,1,
+1,1,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,0,0,0,0,
+0,1,1,1,0,1,1,1,
+1,1,0,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,3072,3072,3072,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 154 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-3072,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 154 */
+1,1,1,1,1,1,1,1,
+1,1,1,0,0,0,0,0,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,0,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,1,1,1,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 155 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3730,28 +3743,32 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 155 */
-3072,3072,3072,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-3072,3072,3072,7168,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,3072,3072,0,0,0,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,0,0,0,0,0,0,0,
-3072,3072,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 156 */
+1,1,1,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+1,1,1,2,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,
+1,1,1,1,0,0,0,0,
+1,1,1,1,1,1,1,1,
+1,0,0,0,0,0,0,0,
+1,1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 157 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3762,13 +3779,83 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-3072,3072,3072,3072,3072,3072,3072,3072,
-3072,3072,0,0,0,0,0,0,
-/* Block: 157 */
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,3840,3840,
-3840,3840,3840,3840,3840,3840,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+1,1,1,1,1,1,1,1,
+1,1,0,0,0,0,0,0,
+/* Block: 158 */
+1588,1589,1590,1591,1592,1593,1594,1595,
+1596,1597,1598,1599,1600,1601,1602,1603,
+1604,1605,1606,1607,1608,1609,1610,1611,
+1612,1613,1614,1615,1616,1617,1618,1619,
+1620,1621,1622,1623,1624,1625,1626,1627,
+1628,1629,1630,1631,1632,1633,1634,1635,
+1636,1637,1638,1639,1640,1641,1642,1643,
+1644,1645,1646,1647,1648,1649,1650,1651,
+1652,1653,1654,1655,1656,1657,1658,1659,
+1660,1661,1662,1663,1664,1665,1666,1667,
+1668,1669,1670,1671,1672,1673,1674,1675,
+1676,1677,1678,1679,1680,1681,1682,1683,
+1684,1685,1686,1687,1688,1689,1690,1691,
+1692,1693,1694,1695,1696,1697,1698,1699,
+1700,1701,1702,1703,1704,1705,1706,1707,
+1708,1709,1710,1711,1712,1713,1714,1715,
+/* Block: 159 */
+1716,1717,1718,1719,1720,1721,1722,1723,
+1724,1725,1726,1727,1728,1729,1730,1731,
+1732,1733,1734,1735,1736,1737,1738,1739,
+1740,1741,1742,1743,1744,1745,1746,1747,
+1748,1749,1750,1751,1752,1753,1754,1755,
+1756,1757,1758,1759,1760,1761,1762,1763,
+1764,1765,1766,1767,1768,1769,1770,1771,
+1772,1773,1774,1775,1776,1777,1778,1779,
+1780,1781,1782,1783,1784,1785,1786,1787,
+1788,1789,1790,1791,1792,1793,1794,1795,
+1796,1797,1798,1799,1800,1801,1802,1803,
+1804,1805,1806,1807,1808,1809,1810,1811,
+1812,1813,1814,1815,1816,1817,1818,1819,
+1820,1821,1822,1823,1824,1825,1826,1827,
+1828,1829,1830,1831,1832,1833,1834,1835,
+1836,1837,1838,1839,1840,1841,1842,1843,
+/* Block: 160 */
+1844,1845,1846,1847,1848,1849,1850,1851,
+1852,1853,1854,1855,1856,1857,1858,1859,
+1860,1861,1862,1863,1864,1865,1866,1867,
+1868,1869,1870,1871,1872,1873,1874,1875,
+1876,1877,1878,1879,1880,1881,1882,1883,
+1884,1885,1886,1887,1888,1889,1890,1891,
+1892,1893,1894,1895,1896,1897,1898,1899,
+1900,1901,1902,1903,1904,1905,1906,1907,
+1908,1909,1910,1911,1912,1913,1914,1915,
+1916,1917,1918,1919,1920,1921,1922,1923,
+1924,1925,1926,1927,1928,1929,1930,1931,
+1932,1933,1934,1935,1936,1937,1938,1939,
+1940,1941,1942,1943,1944,1945,1946,1947,
+1948,1949,1950,1951,1952,1953,1954,1955,
+1956,1957,1958,1959,1960,1961,1962,1963,
+1964,1965,1966,1967,1968,1969,1970,1971,
+/* Block: 161 */
+1972,1973,1974,1975,1976,1977,1978,1979,
+1980,1981,1982,1983,1984,1985,1986,1987,
+1988,1989,1990,1991,1992,1993,1994,1995,
+1996,1997,1998,1999,2000,2001,2002,2003,
+2004,2005,2006,2007,2008,2009,2010,2011,
+2012,2013,2014,2015,2016,2017,2018,2019,
+2020,2021,2022,2023,2024,2025,2026,2027,
+2028,2029,2030,2031,2032,2033,2034,2035,
+2036,2037,2038,2039,2040,2041,2042,2043,
+2044,2045,2046,2047,2048,2049,2050,2051,
+2052,2053,2054,2055,2056,2057,2058,2059,
+2060,2061,2062,2063,2064,2065,2066,2067,
+2068,2069,2070,2071,2072,2073,2074,2075,
+2076,2077,2078,2079,2080,2081,2082,2083,
+2084,2085,2086,2087,2088,2089,2090,2091,
+2092,2093,2094,2095,2096,2097,2098,2099,
+/* Block: 162 */
+2100,2101,2102,2103,2104,2105,2106,2107,
+2108,2109,2110,2111,2112,2113,2114,2115,
+2116,2117,2118,2119,2120,2121,2122,2123,
+2124,2125,2126,2127,2128,2129,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3782,20 +3869,293 @@ uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc, 20224) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0};
 
-uaix_const_data uaix_data_array(unsigned char, stage1_decomp_nfd, 8704) = {
-0,1,2,3,4,0,5,6,
-7,8,0,0,9,10,0,0,
-0,0,11,12,13,0,14,15,
-16,17,18,19,0,0,20,21,
-22,0,0,0,0,0,0,0,
+uaix_const_data uaix_data_array(type_codept, stage3_ccc_qc_decomp, 2130) = {
+0,3072,7168,72192,268800,465408,662016,858624,
+1055232,1251840,1448448,1645056,1841664,2038272,2234880,2431488,
+2628096,2824704,3021312,3217920,3414528,3611136,3807744,4004352,
+4200960,4397568,4594176,4790784,4987392,5184000,5380608,5577216,
+5773824,5970432,6167040,6363648,6560256,6756864,6953472,7150080,
+7346688,7543296,7739904,7936512,8133120,8329728,8526336,8722944,
+8919552,9116160,9312768,9509376,9705984,9902592,10099200,10295808,
+10492416,10689024,10885632,11082240,11278848,11475456,11672064,11868672,
+12065280,12261888,12458496,12655104,12851712,13048320,13244928,13441536,
+13638144,13834752,14031360,14227968,14424576,14621184,14817792,15014400,
+15211008,15407616,15604224,15800832,15997440,16194048,16390656,16587264,
+16783872,16980480,17177088,17373696,17570304,17766912,17963520,18160128,
+18356736,18553344,18749952,18946560,19143168,19339776,19536384,19732992,
+19929600,20126208,20322816,20519424,20716032,20912640,21109248,21305856,
+21502464,21699072,21895680,22092288,22288896,22485504,22682112,22878720,
+23075328,23271936,23468544,23665152,23861760,24058368,24254976,24451584,
+24648192,24844800,25041408,25238016,25434624,25631232,25827840,26024448,
+26221056,26417664,26614272,26810880,27007488,27204096,27400704,27597312,
+27793920,27990528,28187136,28383744,28580352,28776960,28973568,29170176,
+29366784,29563392,29760000,29956608,30153216,30349824,30546432,30743040,
+30939648,31136256,31332864,31529472,31726080,31922688,32119296,32315904,
+32512512,32709120,32905728,33102336,33298944,33495552,33692160,33888768,
+34089472,34351616,34613760,34875904,35138048,35400192,35662336,35924480,
+36186624,36448768,36710912,36973056,37231104,37427712,37624320,37820928,
+38017536,38214144,38410752,38607360,38808064,39070208,39328256,39524864,
+39721472,39918080,40114688,40311296,40507904,40708608,40970752,41228800,
+41425408,41622016,41818624,42015232,42211840,42408448,42605056,42801664,
+42998272,43194880,43391488,43588096,43784704,43981312,44177920,44374528,
+44571136,44767744,44964352,45160960,45357568,45554176,45750784,45947392,
+46144000,46340608,46537216,46733824,46930432,47127040,47323648,47520256,
+47716864,47913472,48110080,48306688,48503296,48704000,48966144,49228288,
+49490432,49748480,49945088,50145792,50407936,50665984,50862592,17894,
+16614,16616,16604,17880,16586,17884,17866,16385,
+17665,51072998,51204070,51335142,51482598,17904,16617,16618,
+51646208,51777280,51916288,52107776,52301568,52435456,52632064,52828672,
+53025280,53221888,53418496,53619200,53877248,54073856,54270464,54467072,
+54663680,54860288,55060992,55319040,55515648,55712256,55908864,56105472,
+56303104,56499712,56695296,56891904,57088512,57285120,57481728,57678336,
+57874944,58071552,58268160,58464768,58661376,58857984,59054592,59251200,
+59447808,59644416,59841024,60037632,60234240,60430848,60627456,60824064,
+61020672,61217280,61413888,61610496,61807104,62003712,62200320,62396928,
+62593536,62790144,62986752,63183360,63379968,63576576,63773184,63969792,
+64166400,64363008,64559616,64756224,64952832,65149440,65346048,65542656,
+65739264,65935872,66132480,66329088,66525696,66722304,16606,16612,
+16394,16395,16396,16397,16398,16399,16400,16401,
+16402,16403,16404,16405,16406,16407,16408,16409,
+16414,16415,16416,66918912,67115520,67312128,67508736,67705344,
+16411,16412,16413,16417,16418,16419,67901952,68098560,
+68295168,16420,68491776,68688384,68884992,17671,16393,69082880,
+69279488,69476096,69672704,69869312,70065920,70262528,70459136,16391,
+1280,70650368,70846976,71048960,71245568,71442176,71638784,71835392,
+72032000,72228608,72425216,72621824,72813056,73009664,73206272,73408256,
+73604864,73796096,73992704,74189312,74385920,74586624,16468,17755,
+74779136,74975744,75172352,75368960,75565568,75827712,76024320,76220928,
+17673,76421632,76614144,76814848,77072896,16487,16491,16502,
+16506,16600,77270784,77467392,77664000,77860608,78057216,78253824,
+16513,16514,78483200,16516,78679808,78847744,11264,79044352,
+79269632,79433472,79630080,79826688,80023296,80219904,80416512,80611840,
+80808448,81005056,81201664,81398272,81594880,81791488,81988096,82184704,
+82381312,82577920,82774528,16598,16602,82975232,83171840,83368448,
+83565056,83761664,83958272,84154880,84351488,84552192,84814336,85072384,
+85268992,85465600,85662208,85858816,86055424,86252032,86448640,86645248,
+86841856,87042560,87304704,87566848,87828992,88087040,88283648,88480256,
+88676864,88877568,89139712,89397760,89594368,89790976,89987584,90184192,
+90380800,90577408,90774016,90970624,91167232,91363840,91560448,91757056,
+91953664,92150272,92346880,92547584,92809728,93067776,93264384,93460992,
+93657600,93854208,94050816,94247424,94444032,94644736,94906880,95164928,
+95361536,95558144,95754752,95951360,96147968,96344576,96541184,96737792,
+96934400,97131008,97327616,97524224,97720832,97917440,98114048,98310656,
+98507264,98707968,98970112,99232256,99494400,99756544,100018688,100280832,
+100542976,100801024,100997632,101194240,101390848,101587456,101784064,101980672,
+102177280,102377984,102640128,102898176,103094784,103291392,103488000,103684608,
+103881216,104081920,104344064,104606208,104868352,105130496,105392640,105650688,
+105847296,106043904,106240512,106437120,106633728,106830336,107026944,107223552,
+107420160,107616768,107813376,108009984,108206592,108407296,108669440,108931584,
+109193728,109451776,109648384,109844992,110041600,110238208,110434816,110631424,
+110828032,111024640,111221248,111417856,111614464,111811072,112007680,112204288,
+112400896,112597504,112794112,112990720,113187328,113383936,113580544,113777152,
+113973760,114170368,114366976,114563584,114760192,114956800,115153408,115351040,
+115546624,115743232,115939840,116136448,116337152,116599296,116861440,117123584,
+117385728,117647872,117910016,118172160,118434304,118696448,118958592,119220736,
+119482880,119745024,120007168,120269312,120531456,120793600,121055744,121317888,
+121575936,121772544,121969152,122165760,122362368,122558976,122759680,123021824,
+123283968,123546112,123808256,124070400,124332544,124594688,124856832,125118976,
+125377024,125573632,125770240,125966848,126163456,126360064,126556672,126753280,
+126953984,127216128,127478272,127740416,128002560,128264704,128526848,128788992,
+129051136,129313280,129575424,129837568,130099712,130361856,130624000,130886144,
+131148288,131410432,131672576,131934720,132192768,132389376,132585984,132782592,
+132983296,133245440,133507584,133769728,134031872,134294016,134556160,134818304,
+135080448,135342592,135600640,135797248,135993856,136190464,136387072,136583680,
+136780288,136976896,137173504,137370112,137570816,137832960,138095104,138357248,
+138619392,138881536,139139584,139336192,139536896,139799040,140061184,140323328,
+140585472,140847616,141105664,141302272,141502976,141765120,142027264,142289408,
+142547456,142744064,142944768,143206912,143469056,143731200,143989248,144185856,
+144386560,144648704,144910848,145172992,145435136,145697280,145955328,146151936,
+146352640,146614784,146876928,147139072,147401216,147663360,147921408,148118016,
+148318720,148580864,148843008,149105152,149367296,149629440,149887488,150084096,
+150284800,150546944,150809088,151071232,151333376,151595520,151853568,152050176,
+152250880,152513024,152775168,153037312,153295360,153491968,153692672,153954816,
+154216960,154479104,154737152,154933760,155134464,155396608,155658752,155920896,
+156183040,156445184,156703232,156903936,157166080,157428224,157686272,157882880,
+158083584,158345728,158607872,158870016,159132160,159394304,159652352,159848960,
+160049664,160311808,160573952,160836096,161098240,161360384,161618432,161816320,
+162011648,162209536,162404864,162602752,162798080,162995968,163191296,163389184,
+163584512,163782400,163977728,164175616,164375040,164637184,164903424,165231104,
+165558784,165886464,166214144,166541824,166865408,167127552,167393792,167721472,
+168049152,168376832,168704512,169032192,169355776,169617920,169884160,170211840,
+170539520,170867200,171194880,171522560,171846144,172108288,172374528,172702208,
+173029888,173357568,173685248,174012928,174336512,174598656,174864896,175192576,
+175520256,175847936,176175616,176503296,176826880,177089024,177355264,177682944,
+178010624,178338304,178665984,178993664,179313152,179509760,179710464,179968512,
+180169216,180427264,180627968,180886016,181082624,181279232,181477120,181672448,
+181866240,182005248,182200832,182458880,182659584,182917632,183118336,183376384,
+183574272,183769600,183967488,184162816,184364544,184561152,184757760,184949248,
+185145856,185346560,185609984,185866752,186067456,186325504,186522112,186718720,
+186916608,187117056,187313664,187510272,187701760,187898368,188099072,188362496,
+188619264,188815872,189012480,189213184,189471232,189667840,189864448,190062336,
+190257664,190459392,190656256,190844672,190982656,191240704,191441408,191699456,
+191900160,192158208,192356096,192551424,192749312,192944640,193142528,193269504,
+193400576,193531648,193662720,193797888,193993216,194189824,194386432,194583040,
+194779648,194976256,195172864,195369472,195566080,195762688,195959296,196155904,
+196352512,196549120,196745728,196942336,197138944,197335552,197532160,197728768,
+197925376,198121984,198318592,198515200,198711808,198908416,199105024,199301632,
+199498240,199694848,199891456,200088064,200284672,200481280,200677888,200874496,
+201071104,201267712,201464320,201660928,201857536,202054144,202250752,202447360,
+202641152,202772224,202907392,16608,203102720,203299328,203495936,203692544,
+203889152,204085760,204282368,204478976,204675584,204872192,205068800,205265408,
+205462016,205658624,205855232,206051840,206248448,206445056,206641664,206838272,
+207034880,207231488,207428096,207624704,207821312,208017920,17672,208214528,
+208411136,208607744,208804352,209000960,209197568,209394176,209590784,209787392,
+209984000,210180608,210377216,210573824,210770432,210967040,211163648,211360256,
+211556864,211753472,211950080,212146688,212343296,212539904,212736512,212933120,
+213129728,213326336,213522944,213719552,213916160,214112768,214309376,2560,
+214503168,214634240,214765312,214896384,215027456,215158528,215289600,215420672,
+215551744,215682816,215813888,215944960,216076032,216207104,216338176,216469248,
+216600320,216731392,216862464,216993536,217124608,217255680,217386752,217517824,
+217648896,217779968,217911040,218042112,218173184,218304256,218435328,218566400,
+218697472,218828544,218959616,219090688,219221760,219352832,219483904,219614976,
+219746048,219877120,220008192,220139264,220270336,220401408,220532480,220663552,
+220794624,220925696,221056768,221187840,221318912,221449984,221581056,221712128,
+221843200,221974272,222105344,222236416,222367488,222498560,222629632,222760704,
+222891776,223022848,223153920,223284992,223416064,223547136,223678208,223809280,
+223940352,224071424,224202496,224333568,224464640,224595712,224726784,224857856,
+224988928,225120000,225251072,225382144,225513216,225644288,225775360,225906432,
+226037504,226168576,226299648,226430720,226561792,226692864,226823936,226955008,
+227086080,227217152,227348224,227479296,227610368,227741440,227872512,228003584,
+228134656,228265728,228396800,228527872,228658944,228790016,228921088,229052160,
+229183232,229314304,229445376,229576448,229707520,229838592,229969664,230100736,
+230231808,230362880,230493952,230625024,230756096,230887168,231018240,231149312,
+231280384,231411456,231542528,231673600,231804672,231935744,232066816,232197888,
+232328960,232460032,232591104,232722176,232853248,232984320,233115392,233246464,
+233377536,233508608,233639680,233770752,233901824,234032896,234163968,234295040,
+234426112,234557184,234688256,234819328,234950400,235081472,235212544,235343616,
+235474688,235605760,235736832,235867904,235998976,236130048,236261120,236392192,
+236523264,236654336,236785408,236916480,237047552,237178624,237309696,237440768,
+237571840,237702912,237833984,237965056,238096128,238227200,238358272,238489344,
+238620416,238751488,238882560,239013632,239144704,239275776,239406848,239537920,
+239668992,239800064,239931136,240062208,240193280,240324352,240455424,240586496,
+240717568,240848640,240979712,241110784,241241856,241372928,241504000,241635072,
+241766144,241897216,242028288,242159360,242290432,242421504,242552576,242683648,
+242814720,242945792,243076864,243207936,243339008,243470080,243601152,243732224,
+243863296,243994368,244125440,244256512,244387584,244518656,244649728,244780800,
+244911872,245042944,245174016,245305088,245436160,245567232,245698304,245829376,
+245960448,246091520,246222592,246353664,246484736,246615808,246746880,246877952,
+247009024,247140096,247271168,247402240,247533312,247664384,247795456,247926528,
+248057600,248188672,248319744,248450816,248581888,248712960,248844032,248975104,
+249106176,249237248,249368320,249499392,249630464,249761536,249892608,250023680,
+250154752,250285824,250416896,250547968,250679040,250810112,250941184,251072256,
+251203328,251334400,251465472,251596544,251727616,251858688,251989760,252120832,
+252251904,252382976,252514048,252645120,252776192,252907264,253038336,253169408,
+253300480,253431552,253562624,253693696,253824768,253955840,254086912,254217984,
+254349056,254480128,254611200,254742272,254873344,255004416,255135488,255266560,
+255397632,255528704,255659776,255790848,255921920,256052992,256184064,256315136,
+256446208,256577280,256708352,256839424,256970496,257101568,257232640,257363712,
+257494784,257625856,257756928,257888000,258019072,258150144,258281216,258412288,
+258543360,258674432,258805504,258936576,259067648,259198720,259329792,259460864,
+259591936,259723008,259854080,259985152,260116224,260247296,260378368,260509440,
+260640512,260771584,260902656,261033728,261164800,261295872,261426944,261558016,
+261689088,261820160,261951232,262082304,262213376,262344448,262475520,262606592,
+262737664,262868736,262999808,263130880,263261952,263393024,263524096,263655168,
+263786240,263917312,264048384,264179456,264310528,264441600,264572672,264703744,
+264834816,264965888,265096960,265228032,265359104,265490176,265621248,265752320,
+265883392,266014464,266145536,266276608,266407680,266538752,266669824,266800896,
+266931968,267063040,267194112,267325184,267456256,267587328,267718400,267849472,
+267980544,268111616,268242688,268373760,268504832,268635904,268766976,268898048,
+269029120,269160192,269291264,269422336,269553408,269684480,269815552,269946624,
+270077696,270208768,270339840,270470912,270601984,270733056,270864128,270995200,
+271126272,271257344,271388416,271519488,271650560,271781632,271912704,272043776,
+272174848,272305920,272436992,272568064,272699136,272830208,272961280,273092352,
+273223424,273354496,273485568,273616640,273747712,273878784,274009856,274140928,
+274272000,274403072,274534144,274665216,274800384,16410,274996992,275193600,
+275390208,275590912,275853056,276111104,276307712,276504320,276700928,276897536,
+277094144,277290752,277487360,277683968,277880576,278077184,278273792,278470400,
+278667008,278863616,279060224,279256832,279453440,279650048,279846656,280043264,
+280239872,280436480,280633088,280829696,281026304,281222912,281419520,19456,
+281614848,281811456,282008064,282200576,282397184,282593792,282790400,282987008,
+283183616,283380224,283576832,283773440,283970048,16390,284172032,284368640,
+284569344,284831488,285093632,285355776,285617920,16610,285875968,286072576,
+286273280,286535424,286797568,287059712,287313664,287444736,287575808,287706880,
+287837952,287969024,288100096,288231168,288362240,288493312,288624384,288755456,
+288886528,289017600,289148672,289279744,289410816,289541888,289672960,289804032,
+289935104,290066176,290197248,290328320,290459392,290590464,290721536,290852608,
+290983680,291114752,291245824,291376896,291507968,291639040,291770112,291901184,
+292032256,292163328,292294400,292425472,292556544,292687616,292818688,292949760,
+293080832,293211904,293342976,293474048,293605120,293736192,293867264,293998336,
+294129408,294260480,294391552,294522624,294653696,294784768,294915840,295046912,
+295177984,295309056,295440128,295571200,295702272,295833344,295964416,296095488,
+296226560,296357632,296488704,296619776,296750848,296881920,297012992,297144064,
+297275136,297406208,297537280,297668352,297799424,297930496,298061568,298192640,
+298323712,298454784,298585856,298716928,298848000,298979072,299110144,299241216,
+299372288,299503360,299634432,299765504,299896576,300027648,300158720,300289792,
+300420864,300551936,300683008,300814080,300945152,301076224,301207296,301338368,
+301469440,301600512,301731584,301862656,301993728,302124800,302255872,302386944,
+302518016,302649088,302780160,302911232,303042304,303173376,303304448,303435520,
+303566592,303697664,303828736,303959808,304090880,304221952,304353024,304484096,
+304615168,304746240,304877312,305008384,305139456,305270528,305401600,305532672,
+305663744,305794816,305925888,306056960,306188032,306319104,306450176,306581248,
+306712320,306843392,306974464,307105536,307236608,307367680,307498752,307629824,
+307760896,307891968,308023040,308154112,308285184,308416256,308547328,308678400,
+308809472,308940544,309071616,309202688,309333760,309464832,309595904,309726976,
+309858048,309989120,310120192,310251264,310382336,310513408,310644480,310775552,
+310906624,311037696,311168768,311299840,311430912,311561984,311693056,311824128,
+311955200,312086272,312217344,312348416,312479488,312610560,312741632,312872704,
+313003776,313134848,313265920,313396992,313528064,313659136,313790208,313921280,
+314052352,314183424,314314496,314445568,314576640,314707712,314838784,314969856,
+315100928,315232000,315363072,315494144,315625216,315756288,315887360,316018432,
+316149504,316280576,316411648,316542720,316673792,316804864,316935936,317067008,
+317198080,317329152,317460224,317591296,317722368,317853440,317984512,318115584,
+318246656,318377728,318508800,318639872,318770944,318902016,319033088,319164160,
+319295232,319426304,319557376,319688448,319819520,319950592,320081664,320212736,
+320343808,320474880,320605952,320737024,320868096,320999168,321130240,321261312,
+321392384,321523456,321654528,321785600,321916672,322047744,322178816,322309888,
+322440960,322572032,322703104,322834176,322965248,323096320,323227392,323358464,
+323489536,323620608,323751680,323882752,324013824,324144896,324275968,324407040,
+324538112,324669184,324800256,324931328,325062400,325193472,325324544,325455616,
+325586688,325717760,325848832,325979904,326110976,326242048,326373120,326504192,
+326635264,326766336,326897408,327028480,327159552,327290624,327421696,327552768,
+327683840,327814912,327945984,328077056,328208128,328339200,328470272,328601344,
+328732416,328863488,328994560,329125632,329256704,329387776,329518848,329649920,
+329780992,329912064,330043136,330174208,330305280,330436352,330567424,330698496,
+330829568,330960640,331091712,331222784,331353856,331484928,331616000,331747072,
+331878144,332009216,332140288,332271360,332402432,332533504,332664576,332795648,
+332926720,333057792,333188864,333319936,333451008,333582080,333713152,333844224,
+333975296,334106368,334237440,334368512,334499584,334630656,334761728,334892800,
+335023872,335154944,335286016,335417088,335548160,335679232,335810304,335941376,
+336072448,336203520,336334592,336465664,336596736,336727808,336858880,336989952,
+337121024,337252096,337383168,337514240,337645312,337776384,337907456,338038528,
+338169600,338300672,338431744,338562816,338693888,338824960,338956032,339087104,
+339218176,339349248,339480320,339611392,339742464,339873536,340004608,340135680,
+340266752,340397824,340528896,340659968,340791040,340922112,341053184,341184256,
+341315328,341446400,341577472,341708544,341839616,341970688,342101760,342232832,
+342363904,342494976,342626048,342757120,342888192,343019264,343150336,343281408,
+343412480,343543552,343674624,343805696,343936768,344067840,344198912,344329984,
+344461056,344592128,344723200,344854272,344985344,345116416,345247488,345378560,
+345509632,345640704,345771776,345902848,346033920,346164992,346296064,346427136,
+346558208,346689280,346820352,346951424,347082496,347213568,347344640,347475712,
+347606784,347737856,347868928,348000000,348131072,348262144,348393216,348524288,
+348655360,348786432,348917504,349048576,349179648,349310720,349441792,349572864,
+349703936,349835008,349966080,350097152,350228224,350359296,350490368,350621440,
+350752512,350883584,351014656,351145728,351276800,351407872,351538944,351670016,
+351801088,351932160,352063232,352194304,352325376,352456448,352587520,352718592,
+352849664,352980736,353111808,353242880,353373952,353505024,353636096,353767168,
+353898240,354029312,354160384,354291456,354422528,354553600,354684672,354815744,
+354946816,355077888,355208960,355340032,355471104,355602176,355733248,355864320,
+355995392,356126464,356257536,356388608,356519680,356650752,356781824,356912896,
+357043968,357175040,357306112,357437184,357568256,357699328,357830400,357961472,
+358092544,358223616};
+
+#else // Without NFKC/NFKD Quick_Check bits
+
+uaix_const_data uaix_data_array(unsigned char, stage1_ccc_qc_decomp, 8704) = {
+0,1,2,3,4,5,6,7,
+8,9,0,10,11,12,13,14,
+15,16,17,18,19,20,21,22,
+23,24,25,26,27,28,29,30,
+31,32,33,34,0,0,35,0,
+0,0,0,0,0,0,36,37,
+0,38,39,0,40,41,42,43,
+44,45,0,46,47,48,49,50,
+51,52,53,54,55,56,57,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,23,0,
-0,0,0,0,24,25,26,27,
-28,0,29,30,31,32,33,0,
+0,0,0,0,0,58,0,0,
+0,59,60,61,0,0,0,0,
+62,63,0,0,0,0,64,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,34,0,0,
 0,0,0,0,0,0,0,0,
-35,36,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3822,6 +4182,19 @@ uaix_const_data uaix_data_array(unsigned char, stage1_decomp_nfd, 8704) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,65,66,0,0,
+67,68,69,70,0,71,0,72,
+73,73,73,73,73,73,73,73,
+73,73,73,73,73,73,73,73,
+73,73,73,73,73,73,73,73,
+73,73,73,73,73,73,73,73,
+73,73,73,73,73,73,73,73,
+73,73,73,73,73,73,73,73,
+73,73,73,73,73,73,73,73,
+73,73,73,73,73,73,73,73,
+73,73,73,73,73,73,73,73,
+73,73,73,73,73,73,73,73,
+73,73,73,73,73,73,73,74,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3830,7 +4203,16 @@ uaix_const_data uaix_data_array(unsigned char, stage1_decomp_nfd, 8704) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,75,76,77,78,79,80,
+81,82,83,0,84,85,0,86,
+0,0,0,87,0,88,89,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,90,91,0,0,
+0,0,92,0,0,93,94,95,
+96,97,98,99,100,101,102,0,
+103,104,0,105,106,107,108,0,
+109,0,110,111,112,113,0,0,
+106,0,114,115,0,0,116,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3845,15 +4227,13 @@ uaix_const_data uaix_data_array(unsigned char, stage1_decomp_nfd, 8704) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,37,38,39,40,41,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,117,118,0,
+0,0,0,0,0,0,0,119,
 0,0,0,0,0,0,0,0,
-0,42,43,0,0,0,44,0,
-0,45,0,46,0,0,0,0,
-0,0,47,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3872,14 +4252,20 @@ uaix_const_data uaix_data_array(unsigned char, stage1_decomp_nfd, 8704) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,120,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,121,122,123,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+124,125,118,0,0,126,0,0,
+0,127,0,0,0,0,0,0,
+0,128,129,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,130,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3899,7 +4285,6 @@ uaix_const_data uaix_data_array(unsigned char, stage1_decomp_nfd, 8704) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,48,49,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3946,6 +4331,7 @@ uaix_const_data uaix_data_array(unsigned char, stage1_decomp_nfd, 8704) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+131,132,133,134,135,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -3973,7 +4359,6 @@ uaix_const_data uaix_data_array(unsigned char, stage1_decomp_nfd, 8704) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-50,51,52,53,54,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -4843,6 +5228,10 @@ uaix_const_data uaix_data_array(unsigned char, stage1_decomp_nfd, 8704) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0};
+
+uaix_const_data uaix_data_array(unsigned short, stage2_ccc_qc_decomp, 17408) = {
+/* Block: 0 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -4859,21 +5248,66 @@ uaix_const_data uaix_data_array(unsigned char, stage1_decomp_nfd, 8704) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 1 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,1,
+0,0,0,0,1,0,0,0,
+1,0,0,0,0,0,0,0,
+2,3,4,5,6,7,0,8,
+9,10,11,12,13,14,15,16,
+0,17,18,19,20,21,22,0,
+0,23,24,25,26,27,0,0,
+28,29,30,31,32,33,0,34,
+35,36,37,38,39,40,41,42,
+0,43,44,45,46,47,48,0,
+0,49,50,51,52,53,0,54,
+/* Block: 2 */
+55,56,57,58,59,60,61,62,
+63,64,65,66,67,68,69,70,
+0,0,71,72,73,74,75,76,
+77,78,79,80,81,82,83,84,
+85,86,87,88,89,90,0,0,
+91,92,93,94,95,96,97,98,
+99,0,0,0,100,101,102,103,
+0,104,105,106,107,108,109,0,
+0,0,0,110,111,112,113,114,
+115,0,0,0,116,117,118,119,
+120,121,0,0,122,123,124,125,
+126,127,128,129,130,131,132,133,
+134,135,136,137,138,139,0,0,
+140,141,142,143,144,145,146,147,
+148,149,150,151,152,153,154,155,
+156,157,158,159,160,161,162,0,
+/* Block: 3 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+163,164,0,0,0,0,0,0,
+0,0,0,0,0,0,0,165,
+166,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,1,1,1,0,
+0,0,0,0,0,167,168,169,
+170,171,172,173,174,175,176,177,
+178,179,180,181,182,0,183,184,
+185,186,187,188,0,0,189,190,
+191,192,193,194,195,196,197,198,
+199,0,0,0,200,201,0,0,
+202,203,204,205,206,207,208,209,
+/* Block: 4 */
+210,211,212,213,214,215,216,217,
+218,219,220,221,222,223,224,225,
+226,227,228,229,230,231,232,233,
+234,235,236,237,0,0,238,239,
+0,0,0,0,0,0,240,241,
+242,243,244,245,246,247,248,249,
+250,251,252,253,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0};
-
-uaix_const_data uaix_data_array(unsigned short, stage2_decomp_nfd, 7040) = {
-/* Block: 0 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -4882,6 +5316,7 @@ uaix_const_data uaix_data_array(unsigned short, stage2_decomp_nfd, 7040) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 5 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -4890,160 +5325,156 @@ uaix_const_data uaix_data_array(unsigned short, stage2_decomp_nfd, 7040) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 1 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+1,1,1,1,1,1,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 6 */
+254,254,254,254,254,255,254,254,
+254,254,254,254,254,255,255,254,
+255,254,255,254,254,256,257,257,
+257,257,256,258,257,257,257,257,
+257,259,259,260,260,260,260,261,
+261,257,257,257,257,260,260,257,
+260,260,257,257,262,262,262,262,
+263,257,257,257,257,255,255,255,
+264,265,254,266,267,268,255,257,
+257,257,255,255,255,257,257,0,
+255,255,255,257,257,257,257,255,
+256,257,257,255,269,270,270,269,
+270,270,269,255,255,255,255,255,
+255,255,255,255,255,255,255,255,
+0,0,0,0,271,0,0,0,
+0,0,1,0,0,0,272,0,
+/* Block: 7 */
+0,0,0,0,1,273,274,275,
+276,277,278,0,279,0,280,281,
+282,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-1,4,7,10,13,16,0,19,
-22,25,28,31,34,37,40,43,
-0,46,49,52,55,58,61,0,
-0,64,67,70,73,76,0,0,
-79,82,85,88,91,94,0,97,
-100,103,106,109,112,115,118,121,
-0,124,127,130,133,136,139,0,
-0,142,145,148,151,154,0,157,
-/* Block: 2 */
-160,163,166,169,172,175,178,181,
-184,187,190,193,196,199,202,205,
-0,0,208,211,214,217,220,223,
-226,229,232,235,238,241,244,247,
-250,253,256,259,262,265,0,0,
-268,271,274,277,280,283,286,289,
-292,0,0,0,295,298,301,304,
-0,307,310,313,316,319,322,0,
-0,0,0,325,328,331,334,337,
-340,0,0,0,343,346,349,352,
-355,358,0,0,361,364,367,370,
-373,376,379,382,385,388,391,394,
-397,400,403,406,409,412,0,0,
-415,418,421,424,427,430,433,436,
-439,442,445,448,451,454,457,460,
-463,466,469,472,475,478,481,0,
-/* Block: 3 */
 0,0,0,0,0,0,0,0,
+0,0,283,284,285,286,287,288,
+289,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,290,291,292,293,294,0,
+0,0,0,295,296,0,0,0,
 0,0,0,0,0,0,0,0,
-484,487,0,0,0,0,0,0,
-0,0,0,0,0,0,0,490,
-493,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,496,499,502,
-505,508,511,514,517,520,524,528,
-532,536,540,544,548,0,552,556,
-560,564,568,571,0,0,574,577,
-580,583,586,589,592,596,600,603,
-606,0,0,0,609,612,0,0,
-615,618,621,625,629,632,635,638,
-/* Block: 4 */
-641,644,647,650,653,656,659,662,
-665,668,671,674,677,680,683,686,
-689,692,695,698,701,704,707,710,
-713,716,719,722,0,0,725,728,
-0,0,0,0,0,0,731,734,
-737,740,743,747,751,755,759,762,
-765,769,773,776,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 8 */
+297,298,0,299,0,0,0,300,
+0,0,0,0,301,302,303,0,
 0,0,0,0,0,0,0,0,
+0,304,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,305,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+306,307,0,308,0,0,0,309,
+0,0,0,0,310,311,312,0,
 0,0,0,0,0,0,0,0,
-/* Block: 5 */
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,313,314,
 0,0,0,0,0,0,0,0,
+/* Block: 9 */
+0,0,0,255,255,255,255,255,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-779,781,0,783,785,0,0,0,
 0,0,0,0,0,0,0,0,
+0,315,316,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+317,318,319,320,0,0,321,322,
+0,0,323,324,325,326,327,328,
+0,0,329,330,331,332,333,334,
+0,0,335,336,337,338,339,340,
+341,342,343,344,345,346,0,0,
+347,348,0,0,0,0,0,0,
+/* Block: 10 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,257,255,255,255,255,257,255,
+255,255,349,257,255,255,255,255,
+255,255,257,257,257,257,257,257,
+255,255,257,255,255,349,350,255,
+351,352,353,354,355,356,357,358,
+359,360,360,361,362,363,0,364,
+0,365,366,0,255,257,0,359,
 0,0,0,0,0,0,0,0,
-0,0,0,0,788,0,0,0,
-0,0,0,0,0,0,790,0,
-/* Block: 6 */
-0,0,0,0,0,792,795,798,
-800,803,806,0,809,0,812,815,
-818,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,822,825,828,831,834,837,
-840,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,844,847,850,853,856,0,
-0,0,0,859,862,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 11 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+255,255,255,255,255,255,255,255,
+367,368,369,0,0,0,0,0,
+0,0,370,371,372,373,374,0,
 0,0,0,0,0,0,0,0,
-/* Block: 7 */
-865,868,0,871,0,0,0,874,
-0,0,0,0,877,880,883,0,
 0,0,0,0,0,0,0,0,
-0,886,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,375,376,377,367,368,
+369,378,379,254,254,260,257,255,
+255,255,255,255,257,255,255,257,
 0,0,0,0,0,0,0,0,
-0,889,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+380,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-892,895,0,898,0,0,0,901,
-0,0,0,0,904,907,910,0,
+/* Block: 12 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,913,916,
 0,0,0,0,0,0,0,0,
-/* Block: 8 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+381,0,382,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,383,0,0,255,255,
+255,255,255,255,255,0,0,255,
+255,255,255,257,255,0,0,255,
+255,0,257,255,255,257,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,919,922,0,0,0,0,0,
+/* Block: 13 */
 0,0,0,0,0,0,0,0,
-925,928,931,934,0,0,937,940,
-0,0,943,946,949,952,955,958,
-0,0,961,964,967,970,973,976,
-0,0,979,982,985,988,991,994,
-997,1000,1003,1006,1009,1012,0,0,
-1015,1018,0,0,0,0,0,0,
-/* Block: 9 */
 0,0,0,0,0,0,0,0,
+0,384,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,1021,1024,1027,1030,1033,0,
+255,257,255,255,257,255,255,257,
+257,257,255,257,257,255,257,255,
+255,255,257,255,257,255,257,255,
+257,255,255,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 14 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 10 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -5052,117 +5483,146 @@ uaix_const_data uaix_data_array(unsigned short, stage2_decomp_nfd, 7040) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-1036,0,1039,0,0,0,0,0,
+0,0,0,255,255,255,255,255,
+255,255,257,255,0,0,0,0,
+0,0,0,0,0,257,0,0,
+/* Block: 15 */
 0,0,0,0,0,0,0,0,
-0,0,0,1042,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,255,
+255,255,0,255,255,255,255,255,
+255,255,255,255,0,255,255,255,
+0,255,255,255,255,255,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 11 */
 0,0,0,0,0,0,0,0,
+0,257,257,257,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,1045,0,0,0,0,0,0,
-0,1048,0,0,1051,0,0,0,
+/* Block: 16 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+255,257,257,257,255,255,255,255,
 0,0,0,0,0,0,0,0,
-1054,1057,1060,1063,1066,1069,1072,1075,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 12 */
+0,0,255,255,255,255,255,257,
+257,257,257,257,255,255,255,255,
+255,255,255,255,255,255,255,255,
+255,255,0,257,255,255,257,255,
+255,257,255,255,255,257,257,257,
+375,376,377,255,255,255,257,255,
+255,257,257,255,255,255,255,255,
+/* Block: 17 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,385,0,0,0,0,0,0,
+0,386,0,0,387,0,0,0,
+0,0,0,0,388,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,389,0,0,
+0,255,257,255,255,0,0,0,
+390,391,392,393,394,395,396,397,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,1078,1081,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,1084,1087,0,1090,
+/* Block: 18 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 13 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,398,0,399,0,
 0,0,0,0,0,0,0,0,
+0,0,0,400,401,389,0,0,
+0,0,0,0,0,0,0,399,
+0,0,0,0,402,403,0,404,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,1093,0,0,1096,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,0,
+/* Block: 19 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,1099,1102,1105,0,0,1108,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,405,0,0,406,0,
+0,0,0,0,398,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 14 */
+0,0,0,0,0,389,0,0,
 0,0,0,0,0,0,0,0,
+0,407,408,409,0,0,410,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 20 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-1111,0,0,1114,1117,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,1120,1123,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,398,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,389,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 15 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,1126,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 21 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,1129,1132,1135,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,398,0,399,0,
 0,0,0,0,0,0,0,0,
+411,0,0,412,413,389,0,0,
+0,0,0,0,0,0,399,399,
+0,0,0,0,414,415,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 16 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 22 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,416,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-1138,0,0,0,0,0,0,0,
+0,0,0,0,0,0,399,0,
 0,0,0,0,0,0,0,0,
+0,0,417,418,419,389,0,0,
+0,0,0,0,0,0,0,399,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 17 */
+/* Block: 23 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -5170,209 +5630,154 @@ uaix_const_data uaix_data_array(unsigned short, stage2_decomp_nfd, 7040) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,398,0,0,0,
 0,0,0,0,0,0,0,0,
-1141,0,0,0,0,0,0,1144,
-1147,0,1150,1153,0,0,0,0,
+420,0,0,0,0,389,0,0,
+0,0,0,0,0,421,422,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 24 */
 0,0,0,0,0,0,0,0,
-/* Block: 18 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,398,0,0,0,
+423,0,399,0,0,0,0,424,
+425,0,426,427,0,389,0,0,
+0,0,0,0,0,399,399,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,1157,1160,1163,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 25 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 19 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,389,389,0,399,0,
 0,0,0,0,0,0,0,0,
+0,0,428,429,430,389,0,0,
+0,0,0,0,0,0,0,399,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 26 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,1166,0,1169,1172,1176,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 20 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,431,0,0,0,0,399,
 0,0,0,0,0,0,0,0,
+0,0,432,0,433,434,435,399,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,1179,0,0,0,0,
-0,0,0,0,0,1182,0,0,
-0,0,1185,0,0,0,0,1188,
-0,0,0,0,1191,0,0,0,
+/* Block: 27 */
 0,0,0,0,0,0,0,0,
-0,1194,0,0,0,0,0,0,
-0,0,0,1197,0,1200,1203,0,
-1206,0,0,0,0,0,0,0,
-/* Block: 21 */
-0,1209,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,1212,0,0,0,0,
-0,0,0,0,0,1215,0,0,
-0,0,1218,0,0,0,0,1221,
-0,0,0,0,1224,0,0,0,
 0,0,0,0,0,0,0,0,
-0,1227,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+436,436,389,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+437,437,437,437,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 22 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 28 */
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1230,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+438,438,389,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+439,439,439,439,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 23 */
-0,0,0,0,0,0,1233,0,
-1236,0,1239,0,1242,0,1245,0,
-0,0,1248,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 29 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,1251,0,1254,0,0,
-1257,1260,0,1263,0,0,0,0,
 0,0,0,0,0,0,0,0,
+257,257,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,257,0,257,
+0,440,0,0,0,0,0,0,
+0,0,0,441,0,0,0,0,
+0,0,0,0,0,442,0,0,
+0,0,443,0,0,0,0,444,
+0,0,0,0,445,0,0,0,
 0,0,0,0,0,0,0,0,
+0,446,0,0,0,0,0,0,
+0,447,448,449,450,451,452,453,
+454,453,448,448,448,448,0,0,
+/* Block: 30 */
+448,455,255,255,389,0,255,255,
 0,0,0,0,0,0,0,0,
+0,0,0,456,0,0,0,0,
+0,0,0,0,0,457,0,0,
+0,0,458,0,0,0,0,459,
+0,0,0,0,460,0,0,0,
 0,0,0,0,0,0,0,0,
+0,461,0,0,0,0,0,0,
+0,0,0,0,0,0,257,0,
 0,0,0,0,0,0,0,0,
-/* Block: 24 */
-1266,1269,1272,1275,1278,1281,1284,1287,
-1290,1294,1298,1301,1304,1307,1310,1313,
-1316,1319,1322,1325,1328,1332,1336,1340,
-1344,1347,1350,1353,1356,1360,1364,1367,
-1370,1373,1376,1379,1382,1385,1388,1391,
-1394,1397,1400,1403,1406,1409,1412,1416,
-1420,1423,1426,1429,1432,1435,1438,1441,
-1444,1448,1452,1455,1458,1461,1464,1467,
-1470,1473,1476,1479,1482,1485,1488,1491,
-1494,1497,1500,1503,1506,1510,1514,1518,
-1522,1526,1530,1534,1538,1541,1544,1547,
-1550,1553,1556,1559,1562,1566,1570,1573,
-1576,1579,1582,1585,1588,1592,1596,1600,
-1604,1608,1612,1615,1618,1621,1624,1627,
-1630,1633,1636,1639,1642,1645,1648,1651,
-1654,1658,1662,1666,1670,1673,1676,1679,
-/* Block: 25 */
-1682,1685,1688,1691,1694,1697,1700,1703,
-1706,1709,1712,1715,1718,1721,1724,1727,
-1730,1733,1736,1739,1742,1745,1748,1751,
-1754,1757,0,1760,0,0,0,0,
-1763,1766,1769,1772,1775,1779,1783,1787,
-1791,1795,1799,1803,1807,1811,1815,1819,
-1823,1827,1831,1835,1839,1843,1847,1851,
-1855,1858,1861,1864,1867,1870,1873,1877,
-1881,1885,1889,1893,1897,1901,1905,1909,
-1913,1916,1919,1922,1925,1928,1931,1934,
-1937,1941,1945,1949,1953,1957,1961,1965,
-1969,1973,1977,1981,1985,1989,1993,1997,
-2001,2005,2009,2013,2017,2020,2023,2026,
-2029,2033,2037,2041,2045,2049,2053,2057,
-2061,2065,2069,2072,2075,2078,2081,2084,
-2087,2090,0,0,0,0,0,0,
-/* Block: 26 */
-2093,2096,2099,2103,2107,2111,2115,2119,
-2123,2126,2129,2133,2137,2141,2145,2149,
-2153,2156,2159,2163,2167,2171,0,0,
-2175,2178,2181,2185,2189,2193,0,0,
-2197,2200,2203,2207,2211,2215,2219,2223,
-2227,2230,2233,2237,2241,2245,2249,2253,
-2257,2260,2263,2267,2271,2275,2279,2283,
-2287,2290,2293,2297,2301,2305,2309,2313,
-2317,2320,2323,2327,2331,2335,0,0,
-2339,2342,2345,2349,2353,2357,0,0,
-2361,2364,2367,2371,2375,2379,2383,2387,
-0,2391,0,2394,0,2398,0,2402,
-2406,2409,2412,2416,2420,2424,2428,2432,
-2436,2439,2442,2446,2450,2454,2458,2462,
-2466,2469,2472,2475,2478,2481,2484,2487,
-2490,2493,2496,2499,2502,2505,0,0,
-/* Block: 27 */
-2508,2512,2516,2521,2526,2531,2536,2541,
-2546,2550,2554,2559,2564,2569,2574,2579,
-2584,2588,2592,2597,2602,2607,2612,2617,
-2622,2626,2630,2635,2640,2645,2650,2655,
-2660,2664,2668,2673,2678,2683,2688,2693,
-2698,2702,2706,2711,2716,2721,2726,2731,
-2736,2739,2742,2746,2749,0,2753,2756,
-2760,2763,2766,2769,2772,0,2775,0,
-0,2777,2780,2784,2787,0,2791,2794,
-2798,2801,2804,2807,2810,2813,2816,2819,
-2822,2825,2828,2832,0,0,2836,2839,
-2843,2846,2849,2852,0,2855,2858,2861,
-2864,2867,2870,2874,2878,2881,2884,2887,
-2891,2894,2897,2900,2903,2906,2909,2912,
-0,0,2914,2918,2921,0,2925,2928,
-2932,2935,2938,2941,2944,2947,0,0,
-/* Block: 28 */
-2949,2951,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 31 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,462,0,
+0,0,0,0,0,0,399,0,
+0,0,0,0,0,0,0,398,
+0,389,389,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 29 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 32 */
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,2953,0,
-0,0,2955,2957,0,0,0,0,
+0,0,0,0,0,257,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -5383,78 +5788,69 @@ uaix_const_data uaix_data_array(unsigned short, stage2_decomp_nfd, 7040) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 30 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,2960,2963,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,2966,0,
+/* Block: 33 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,2969,2972,2975,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 31 */
-0,0,0,0,2978,0,0,0,
-0,2981,0,0,2984,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,2987,0,2990,0,
 0,0,0,0,0,0,0,0,
+0,399,399,399,399,399,399,399,
+399,399,399,399,399,399,399,399,
+399,399,399,399,399,399,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 34 */
 0,0,0,0,0,0,0,0,
-0,2993,0,0,2996,0,0,2999,
-0,3002,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-3005,0,3008,0,0,0,0,0,
-0,0,0,0,0,3011,3014,3017,
-3020,3023,0,0,3026,3029,0,0,
-3032,3035,0,0,0,0,0,0,
-/* Block: 32 */
-3038,3041,0,0,3044,3047,0,0,
-3050,3053,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+399,399,399,399,399,399,399,399,
+399,399,399,399,399,399,399,399,
+399,399,399,399,399,399,399,399,
+399,399,399,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,3056,3059,3062,3065,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-3068,3071,3074,3077,0,0,0,0,
-0,0,3080,3083,3086,3089,0,0,
+/* Block: 35 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 33 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,3092,3094,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,255,255,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 36 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 34 */
+0,0,0,0,389,389,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,389,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -5463,12 +5859,11 @@ uaix_const_data uaix_data_array(unsigned short, stage2_decomp_nfd, 7040) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,3096,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 37 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 35 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -5476,150 +5871,113 @@ uaix_const_data uaix_data_array(unsigned short, stage2_decomp_nfd, 7040) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,389,0,0,0,0,0,
+0,0,0,0,0,255,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 38 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,350,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,3099,0,3102,0,
-3105,0,3108,0,3111,0,3114,0,
-3117,0,3120,0,3123,0,3126,0,
-3129,0,3132,0,0,3135,0,3138,
-0,3141,0,0,0,0,0,0,
-3144,3147,0,3150,3153,0,3156,3159,
-0,3162,3165,0,3168,3171,0,0,
-/* Block: 36 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,3174,0,0,0,
-0,0,0,0,0,0,3177,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,3180,0,3183,0,
-3186,0,3189,0,3192,0,3195,0,
-3198,0,3201,0,3204,0,3207,0,
-3210,0,3213,0,0,3216,0,3219,
-0,3222,0,0,0,0,0,0,
-3225,3228,0,3231,3234,0,3237,3240,
-0,3243,3246,0,3249,3252,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,3255,0,0,3258,
-3261,3264,3267,0,0,0,3270,0,
-/* Block: 37 */
-3273,3275,3277,3279,3281,3283,3285,3287,
-3289,3291,3293,3295,3297,3299,3301,3303,
-3305,3307,3309,3311,3313,3315,3317,3319,
-3321,3323,3325,3327,3329,3331,3333,3335,
-3337,3339,3341,3343,3345,3347,3349,3351,
-3353,3355,3357,3359,3361,3363,3365,3367,
-3369,3371,3373,3375,3377,3379,3381,3383,
-3385,3387,3389,3391,3393,3395,3397,3399,
-3401,3403,3405,3407,3409,3411,3413,3415,
-3417,3419,3421,3423,3425,3427,3429,3431,
-3433,3435,3437,3439,3441,3443,3445,3447,
-3449,3451,3453,3455,3457,3459,3461,3463,
-3465,3467,3469,3471,3473,3475,3477,3479,
-3481,3483,3485,3487,3489,3491,3493,3495,
-3497,3499,3501,3503,3505,3507,3509,3511,
-3513,3515,3517,3519,3521,3523,3525,3527,
-/* Block: 38 */
-3529,3531,3533,3535,3537,3539,3541,3543,
-3545,3547,3549,3551,3553,3555,3557,3559,
-3561,3563,3565,3567,3569,3571,3573,3575,
-3577,3579,3581,3583,3585,3587,3589,3591,
-3593,3595,3597,3599,3601,3603,3605,3607,
-3609,3611,3613,3615,3617,3619,3621,3623,
-3625,3627,3629,3631,3633,3635,3637,3639,
-3641,3643,3645,3647,3649,3651,3653,3655,
-3657,3659,3661,3663,3665,3667,3669,3671,
-3673,3675,3677,3679,3681,3683,3685,3687,
-3689,3691,3693,3695,3697,3699,3701,3703,
-3705,3707,3709,3711,3713,3715,3717,3719,
-3721,3723,3725,3727,3729,3731,3733,3735,
-3737,3739,3741,3743,3745,3747,3749,3751,
-3753,3755,3757,3759,3761,3763,3765,3767,
-3769,3771,3773,3775,3777,3779,3781,3783,
 /* Block: 39 */
-3785,3787,3789,3791,3793,3795,3797,3799,
-3801,3803,3805,3807,3809,3811,0,0,
-3813,0,3815,0,0,3817,3819,3821,
-3823,3825,3827,3829,3831,3833,3835,0,
-3837,0,3839,0,0,3841,3843,0,
-0,0,3845,3847,3849,3851,3853,3855,
-3857,3859,3861,3863,3865,3867,3869,3871,
-3873,3875,3877,3879,3881,3883,3885,3887,
-3889,3891,3893,3895,3897,3899,3901,3903,
-3905,3907,3909,3911,3913,3915,3917,3919,
-3921,3923,3925,3927,3929,3931,3933,3935,
-3937,3939,3941,3943,3945,3947,3949,3951,
-3953,3955,3957,3959,3961,3963,3965,3967,
-3969,3971,3973,3975,3977,3979,0,0,
-3981,3983,3985,3987,3989,3991,3993,3995,
-3997,3999,4001,4003,4005,4007,4009,4011,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,349,255,257,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
 /* Block: 40 */
-4013,4015,4017,4019,4021,4023,4025,4027,
-4029,4031,4033,4035,4037,4039,4041,4043,
-4045,4047,4049,4051,4053,4055,4057,4059,
-4061,4063,4065,4067,4069,4071,4073,4075,
-4077,4079,4081,4083,4085,4087,4089,4091,
-4093,4095,4097,4099,4101,4103,4105,4107,
-4109,4111,4113,4115,4117,4119,4121,4123,
-4125,4127,4129,4131,4133,4135,4137,4139,
-4141,4143,4145,4147,4149,4151,4153,4155,
-4157,4159,4161,4163,4165,4167,4169,4171,
-4173,4175,4177,4179,4181,4183,4185,4187,
-4189,4191,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,255,
+257,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 41 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,4193,0,4196,
 0,0,0,0,0,0,0,0,
-0,0,4199,4202,4205,4209,4213,4216,
-4219,4222,4225,4228,4231,4234,4237,0,
-4240,4243,4246,4249,4252,0,4255,0,
-4258,4261,0,4264,4267,0,4270,4273,
-4276,4279,4282,4285,4288,4291,4294,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+389,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,255,255,
+255,255,255,255,255,0,0,257,
+/* Block: 41 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 42 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,4297,0,4300,0,0,0,
+255,255,255,255,255,257,257,257,
+257,257,257,255,255,257,0,257,
+257,255,255,257,257,255,255,255,
+255,255,257,255,255,255,255,0,
 0,0,0,0,0,0,0,0,
-0,0,0,4303,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 42 */
+0,0,0,0,0,0,463,0,
+464,0,465,0,466,0,467,0,
+0,0,468,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,398,399,0,0,
+0,0,0,469,0,470,0,0,
+471,472,0,473,389,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 43 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,255,257,255,255,255,
+255,255,255,255,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 43 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,4306,4309,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,389,389,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,398,0,
 0,0,0,0,0,0,0,0,
+0,0,389,389,0,0,0,0,
 0,0,0,0,0,0,0,0,
 /* Block: 44 */
 0,0,0,0,0,0,0,0,
@@ -5628,10 +5986,10 @@ uaix_const_data uaix_data_array(unsigned short, stage2_decomp_nfd, 7040) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,398,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,4312,4315,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -5646,25 +6004,109 @@ uaix_const_data uaix_data_array(unsigned short, stage2_decomp_nfd, 7040) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,4318,4321,0,4324,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+255,255,255,0,262,257,257,257,
+257,257,255,255,257,257,257,257,
+255,0,262,262,262,262,262,262,
+262,0,0,0,0,257,0,0,
+0,0,0,0,255,0,0,0,
+255,255,0,0,0,0,0,0,
+/* Block: 46 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 46 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+255,255,257,255,255,255,255,255,
+255,255,257,255,255,270,474,257,
+259,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,256,350,
+350,257,475,255,269,257,255,257,
+/* Block: 47 */
+476,477,478,479,480,481,482,483,
+484,485,486,487,488,489,490,491,
+492,493,494,495,496,497,498,499,
+500,501,502,503,504,505,506,507,
+508,509,510,511,512,513,514,515,
+516,517,518,519,520,521,522,523,
+524,525,526,527,528,529,530,531,
+532,533,534,535,536,537,538,539,
+540,541,542,543,544,545,546,547,
+548,549,550,551,552,553,554,555,
+556,557,558,559,560,561,562,563,
+564,565,566,567,568,569,570,571,
+572,573,574,575,576,577,578,579,
+580,581,582,583,584,585,586,587,
+588,589,590,591,592,593,594,595,
+596,597,598,599,600,601,602,603,
+/* Block: 48 */
+604,605,606,607,608,609,610,611,
+612,613,614,615,616,617,618,619,
+620,621,622,623,624,625,626,627,
+628,629,0,630,0,0,0,0,
+631,632,633,634,635,636,637,638,
+639,640,641,642,643,644,645,646,
+647,648,649,650,651,652,653,654,
+655,656,657,658,659,660,661,662,
+663,664,665,666,667,668,669,670,
+671,672,673,674,675,676,677,678,
+679,680,681,682,683,684,685,686,
+687,688,689,690,691,692,693,694,
+695,696,697,698,699,700,701,702,
+703,704,705,706,707,708,709,710,
+711,712,713,714,715,716,717,718,
+719,720,0,0,0,0,0,0,
+/* Block: 49 */
+721,722,723,724,725,726,727,728,
+729,730,731,732,733,734,735,736,
+737,738,739,740,741,742,0,0,
+743,744,745,746,747,748,0,0,
+749,750,751,752,753,754,755,756,
+757,758,759,760,761,762,763,764,
+765,766,767,768,769,770,771,772,
+773,774,775,776,777,778,779,780,
+781,782,783,784,785,786,0,0,
+787,788,789,790,791,792,0,0,
+793,794,795,796,797,798,799,800,
+0,801,0,802,0,803,0,804,
+805,806,807,808,809,810,811,812,
+813,814,815,816,817,818,819,820,
+821,822,823,824,825,826,827,828,
+829,830,831,832,833,834,0,0,
+/* Block: 50 */
+835,836,837,838,839,840,841,842,
+843,844,845,846,847,848,849,850,
+851,852,853,854,855,856,857,858,
+859,860,861,862,863,864,865,866,
+867,868,869,870,871,872,873,874,
+875,876,877,878,879,880,881,882,
+883,884,885,886,887,0,888,889,
+890,891,892,893,894,1,895,1,
+1,896,897,898,899,0,900,901,
+902,903,904,905,906,907,908,909,
+910,911,912,913,0,0,914,915,
+916,917,918,919,0,920,921,922,
+923,924,925,926,927,928,929,930,
+931,932,933,934,935,936,937,938,
+0,0,939,940,941,0,942,943,
+944,945,946,947,948,949,1,0,
+/* Block: 51 */
+950,951,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,4327,4330,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -5672,25 +6114,31 @@ uaix_const_data uaix_data_array(unsigned short, stage2_decomp_nfd, 7040) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 47 */
 0,0,0,0,0,0,0,0,
+/* Block: 52 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-4333,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+255,255,262,262,255,255,255,255,
+262,262,262,255,255,0,0,0,
+0,255,0,0,0,262,262,255,
+257,255,262,262,257,257,257,257,
+255,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 53 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 48 */
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,952,0,
+0,0,953,954,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
@@ -5701,113 +6149,1671 @@ uaix_const_data uaix_data_array(unsigned short, stage2_decomp_nfd, 7040) = {
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,4336,4339,
-4342,4346,4350,4354,4358,0,0,0,
+/* Block: 54 */
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 49 */
+0,0,955,956,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,957,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,0,958,959,960,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,4362,4365,4368,4372,4376,
-4380,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+/* Block: 55 */
+0,0,0,0,961,0,0,0,
+0,962,0,0,963,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,964,0,965,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-/* Block: 50 */
-4384,4386,4388,4390,4392,4394,4396,4398,
-4400,4402,4404,4406,4408,4410,4412,4414,
-4416,4418,4420,4422,4424,4426,4428,4430,
-4432,4434,4436,4438,4440,4442,4444,4446,
-4448,4450,4452,4454,4456,4458,4460,4462,
-4464,4466,4468,4470,4472,4474,4476,4478,
-4480,4482,4484,4486,4488,4490,4492,4494,
-4496,4498,4500,4502,4504,4506,4508,4510,
-4512,4514,4516,4518,4520,4522,4524,4526,
-4528,4530,4532,4534,4536,4538,4540,4542,
-4544,4546,4548,4550,4552,4554,4556,4558,
-4560,4562,4564,4566,4568,4570,4572,4574,
-4576,4578,4580,4582,4584,4586,4588,4590,
-4592,4594,4596,4598,4600,4602,4604,4606,
-4608,4610,4612,4614,4616,4618,4620,4622,
-4624,4626,4628,4630,4632,4634,4636,4638,
-/* Block: 51 */
-4640,4642,4644,4646,4648,4650,4652,4654,
-4656,4658,4660,4662,4664,4666,4668,4670,
-4672,4674,4676,4678,4680,4682,4684,4686,
-4688,4690,4692,4694,4696,4698,4700,4702,
-4704,4706,4708,4710,4712,4714,4716,4718,
-4720,4722,4724,4726,4728,4730,4732,4734,
-4736,4738,4740,4742,4744,4746,4748,4750,
-4752,4754,4756,4758,4760,4762,4764,4766,
-4768,4770,4772,4774,4776,4778,4780,4782,
-4784,4786,4788,4790,4792,4794,4796,4798,
-4800,4802,4804,4806,4808,4810,4812,4814,
-4816,4818,4820,4822,4824,4826,4828,4830,
-4832,4834,4836,4838,4840,4842,4844,4846,
-4848,4850,4852,4854,4856,4858,4860,4862,
-4864,4866,4868,4870,4872,4874,4876,4878,
-4880,4882,4884,4886,4888,4890,4892,4894,
-/* Block: 52 */
-4896,4898,4900,4902,4904,4906,4908,4910,
-4912,4914,4916,4918,4920,4922,4924,4926,
-4928,4930,4932,4934,4936,4938,4940,4942,
-4944,4946,4948,4950,4952,4954,4956,4958,
-4960,4962,4964,4966,4968,4970,4972,4974,
-4976,4978,4980,4982,4984,4986,4988,4990,
-4992,4994,4996,4998,5000,5002,5004,5006,
-5008,5010,5012,5014,5016,5018,5020,5022,
-5024,5026,5028,5030,5032,5034,5036,5038,
-5040,5042,5044,5046,5048,5050,5052,5054,
-5056,5058,5060,5062,5064,5066,5068,5070,
-5072,5074,5076,5078,5080,5082,5084,5086,
-5088,5090,5092,5094,5096,5098,5100,5102,
-5104,5106,5108,5110,5112,5114,5116,5118,
-5120,5122,5124,5126,5128,5130,5132,5134,
-5136,5138,5140,5142,5144,5146,5148,5150,
-/* Block: 53 */
-5152,5154,5156,5158,5160,5162,5164,5166,
-5168,5170,5172,5174,5176,5178,5180,5182,
-5184,5186,5188,5190,5192,5194,5196,5198,
-5200,5202,5204,5206,5208,5210,5212,5214,
-5216,5218,5220,5222,5224,5226,5228,5230,
-5232,5234,5236,5238,5240,5242,5244,5246,
-5248,5250,5252,5254,5256,5258,5260,5262,
-5264,5266,5268,5270,5272,5274,5276,5278,
-5280,5282,5284,5286,5288,5290,5292,5294,
-5296,5298,5300,5302,5304,5306,5308,5310,
-5312,5314,5316,5318,5320,5322,5324,5326,
-5328,5330,5332,5334,5336,5338,5340,5342,
-5344,5346,5348,5350,5352,5354,5356,5358,
-5360,5362,5364,5366,5368,5370,5372,5374,
-5376,5378,5380,5382,5384,5386,5388,5390,
-5392,5394,5396,5398,5400,5402,5404,5406,
-/* Block: 54 */
-5408,5410,5412,5414,5416,5418,5420,5422,
-5424,5426,5428,5430,5432,5434,5436,5438,
-5440,5442,5444,5446,5448,5450,5452,5454,
-5456,5458,5460,5462,5464,5466,0,0,
 0,0,0,0,0,0,0,0,
+0,966,0,0,967,0,0,968,
+0,969,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+970,0,971,0,0,0,0,0,
+0,0,0,0,0,972,973,974,
+975,976,0,0,977,978,0,0,
+979,980,0,0,0,0,0,0,
+/* Block: 56 */
+981,982,0,0,983,984,0,0,
+985,986,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
+0,0,0,0,987,988,989,990,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
 0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0};
+0,0,0,0,0,0,0,0,
+991,992,993,994,0,0,0,0,
+0,0,995,996,997,998,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 57 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,999,1000,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 58 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1001,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 59 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,255,
+255,255,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 60 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,389,
+/* Block: 61 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,
+/* Block: 62 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,475,350,256,349,1002,1002,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1003,0,1004,0,
+1005,0,1006,0,1007,0,1008,0,
+1009,0,1010,0,1011,0,1012,0,
+1013,0,1014,0,0,1015,0,1016,
+0,1017,0,0,0,0,0,0,
+1018,1019,0,1020,1021,0,1022,1023,
+0,1024,1025,0,1026,1027,0,0,
+/* Block: 63 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1028,0,0,0,
+0,1029,1029,1,1,0,1030,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1031,0,1032,0,
+1033,0,1034,0,1035,0,1036,0,
+1037,0,1038,0,1039,0,1040,0,
+1041,0,1042,0,0,1043,0,1044,
+0,1045,0,0,0,0,0,0,
+1046,1047,0,1048,1049,0,1050,1051,
+0,1052,1053,0,1054,1055,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1056,0,0,1057,
+1058,1059,1060,0,0,0,1061,0,
+/* Block: 64 */
+0,0,0,0,1,0,0,1,
+0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1,0,
+0,1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,1,0,0,0,0,0,
+0,0,0,1,0,0,0,0,
+1,0,0,0,0,0,0,0,
+0,0,0,1,0,0,1,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 65 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,255,
+0,0,0,0,255,255,255,255,
+255,255,255,255,255,255,0,0,
+/* Block: 66 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,255,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+255,255,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 67 */
+0,0,0,0,0,0,389,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,389,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 68 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,389,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,
+255,255,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 69 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,257,257,257,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,389,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 70 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,398,0,0,0,0,
+0,0,0,0,0,0,0,0,
+389,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 71 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+255,0,255,255,257,0,0,255,
+255,0,0,0,0,0,255,255,
+0,255,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,389,0,
+0,0,0,0,0,0,0,0,
+/* Block: 72 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,389,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 73 */
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+/* Block: 74 */
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,1062,1062,1062,1062,
+1062,1062,1062,1062,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 75 */
+1063,1064,1065,1066,1067,1068,1069,1070,
+1071,1072,1073,1074,1075,1076,1077,1078,
+1079,1080,1081,1082,1083,1084,1085,1086,
+1087,1088,1089,1090,1091,1092,1093,1094,
+1095,1096,1097,1098,1099,1100,1101,1102,
+1103,1104,1105,1106,1107,1108,1109,1110,
+1111,1112,1113,1114,1115,1116,1117,1118,
+1119,1120,1121,1122,1123,1124,1125,1126,
+1127,1128,1129,1130,1131,1132,1133,1134,
+1135,1136,1137,1138,1139,1140,1141,1142,
+1143,1144,1145,1146,1147,1148,1149,1150,
+1151,1152,1153,1154,1155,1156,1157,1158,
+1159,1160,1161,1162,1163,1164,1165,1166,
+1167,1168,1169,1170,1171,1172,1173,1174,
+1175,1176,1177,1178,1179,1180,1181,1182,
+1183,1184,1185,1186,1187,1188,1189,1190,
+/* Block: 76 */
+1191,1192,1193,1194,1195,1196,1197,1198,
+1199,1200,1201,1202,1203,1204,1205,1206,
+1207,1208,1209,1210,1211,1212,1213,1214,
+1215,1216,1217,1218,1219,1220,1221,1222,
+1223,1224,1225,1226,1227,1228,1229,1230,
+1231,1232,1233,1234,1235,1236,1237,1238,
+1239,1240,1241,1242,1243,1244,1245,1246,
+1247,1248,1249,1250,1251,1252,1253,1254,
+1255,1256,1257,1258,1259,1260,1261,1262,
+1263,1264,1265,1266,1267,1268,1269,1270,
+1271,1272,1273,1274,1275,1276,1277,1278,
+1279,1280,1281,1282,1283,1284,1285,1286,
+1287,1288,1289,1290,1291,1292,1293,1294,
+1295,1296,1297,1298,1299,1300,1301,1302,
+1303,1304,1305,1306,1307,1308,1309,1310,
+1311,1312,1313,1314,1315,1316,1317,1318,
+/* Block: 77 */
+1319,1320,1321,1322,1323,1324,1325,1326,
+1327,1328,1329,1330,1331,1332,0,0,
+1333,0,1334,0,0,1335,1336,1337,
+1338,1339,1340,1341,1342,1343,1344,0,
+1345,0,1346,0,0,1347,1348,0,
+0,0,1349,1350,1351,1352,1353,1354,
+1355,1356,1357,1358,1359,1360,1361,1362,
+1363,1364,1365,1366,1367,1368,1369,1370,
+1371,1372,1373,1374,1375,1376,1377,1378,
+1379,1380,1381,1382,1383,1384,1385,1386,
+1387,1388,1389,1390,1391,1392,1393,1394,
+1395,1396,1397,1398,1399,1400,1401,1402,
+1403,1404,1405,1406,1407,1408,1409,1410,
+1411,1412,1413,1414,1415,1416,0,0,
+1417,1418,1419,1420,1421,1422,1423,1424,
+1425,1426,1427,1428,1429,1430,1431,1432,
+/* Block: 78 */
+1433,1434,1435,1436,1437,1438,1439,1440,
+1441,1442,1443,1444,1445,1446,1447,1448,
+1449,1450,1451,1452,1453,1454,1455,1456,
+1457,1458,1459,1460,1461,1462,1463,1464,
+1465,1466,1467,1468,1469,1470,1471,1472,
+1473,1474,1475,1476,1477,1478,1479,1480,
+1481,1482,1483,1484,1485,1486,1487,1488,
+1489,1490,1491,1492,1493,1494,1495,1496,
+1497,1498,1499,1500,1501,1502,1503,1504,
+1505,1506,1507,1508,1509,1510,1511,1512,
+1513,1514,1515,1516,1517,1518,1519,1520,
+1521,1522,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 79 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,1523,1524,1525,
+0,0,0,0,0,0,0,0,
+0,0,1526,1527,1528,1529,1530,1531,
+1532,1533,1534,1535,1536,1537,1538,0,
+1539,1540,1541,1542,1543,0,1544,0,
+1545,1546,0,1547,1548,0,1549,1550,
+1551,1552,1553,1554,1555,1556,1557,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 80 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1,1,0,0,
+0,0,0,0,0,0,0,0,
+1,1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 81 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,1,1,1,453,453,
+453,453,453,453,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 82 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,453,453,453,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 83 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,1,1,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 84 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+255,255,255,255,255,255,255,257,
+257,257,257,257,257,257,255,255,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,1,1,1,1,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+1,1,1,0,1,0,1,1,
+1,1,1,1,1,1,1,1,
+/* Block: 85 */
+0,1,1,1,1,1,1,1,
+1,1,1,1,1,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,1,1,1,
+1,1,1,0,0,0,0,0,
+/* Block: 86 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1558,1558,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 87 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,257,0,0,
+/* Block: 88 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+257,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 89 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,255,
+255,255,255,0,0,0,0,0,
+/* Block: 90 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,257,0,255,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+255,262,257,0,0,0,0,389,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 91 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,255,257,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 92 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 93 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,255,255,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,257,257,257,
+/* Block: 94 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,257,257,
+255,255,255,257,255,257,257,257,
+257,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 95 */
+0,0,255,257,255,257,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 96 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,389,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+389,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,389,
+/* Block: 97 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,1559,0,1560,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,1561,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,389,388,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 98 */
+255,255,255,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,399,
+0,0,0,0,0,0,1562,1563,
+0,0,0,389,389,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,398,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 99 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+389,0,0,0,0,0,0,0,
+0,0,398,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 100 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,389,398,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 101 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,398,389,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 102 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,398,398,0,399,0,
+0,0,0,0,0,0,0,0,
+0,0,0,1564,1565,389,0,0,
+0,0,0,0,0,0,0,399,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,255,
+255,255,255,255,255,0,0,0,
+255,255,255,255,255,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 103 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,389,0,0,0,398,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 104 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+399,0,0,0,0,0,0,0,
+0,0,399,1566,1567,399,1568,0,
+0,0,389,398,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 105 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,399,
+0,0,0,0,0,0,0,0,
+0,0,1569,1570,0,0,0,389,
+398,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 106 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,389,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 107 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,389,398,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 108 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,389,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 109 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,389,398,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 110 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+399,0,0,0,0,0,0,0,
+1571,0,0,0,0,389,389,0,
+0,0,0,398,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 111 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+389,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 112 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,389,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,389,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 113 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,389,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 114 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,398,0,389,389,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 115 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,389,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 116 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,389,389,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 117 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+262,262,262,262,262,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 118 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+255,255,255,255,255,255,255,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 119 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+1572,1572,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 120 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,262,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 121 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1573,1574,
+1575,1576,1577,1578,1579,440,440,262,
+262,262,0,0,0,1580,440,440,
+440,440,440,0,0,0,0,0,
+0,0,0,257,257,257,257,257,
+/* Block: 122 */
+257,257,257,0,0,255,255,255,
+255,255,257,257,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,255,255,255,255,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,1581,1582,1583,1584,1585,
+1586,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 123 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,255,255,255,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 124 */
+255,255,255,255,255,255,255,0,
+255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,
+255,0,0,255,255,255,255,255,
+255,255,0,255,255,0,255,255,
+255,255,255,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 125 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,255,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 126 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,255,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 127 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,256,256,257,255,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 128 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+257,257,257,257,257,257,257,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 129 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,255,255,255,255,
+255,255,398,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 130 */
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,1,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+/* Block: 131 */
+1587,1588,1589,1590,1591,1592,1593,1594,
+1595,1596,1597,1598,1599,1600,1601,1602,
+1603,1604,1605,1606,1607,1608,1609,1610,
+1611,1612,1613,1614,1615,1616,1617,1618,
+1619,1620,1621,1622,1623,1624,1625,1626,
+1627,1628,1629,1630,1631,1632,1633,1634,
+1635,1636,1637,1638,1639,1640,1641,1642,
+1643,1644,1645,1646,1647,1648,1649,1650,
+1651,1652,1653,1654,1655,1656,1657,1658,
+1659,1660,1661,1662,1663,1664,1665,1666,
+1667,1668,1669,1670,1671,1672,1673,1674,
+1675,1676,1677,1678,1679,1680,1681,1682,
+1683,1684,1685,1686,1687,1688,1689,1690,
+1691,1692,1693,1694,1695,1696,1697,1698,
+1699,1700,1701,1702,1703,1704,1705,1706,
+1707,1708,1709,1710,1711,1712,1713,1714,
+/* Block: 132 */
+1715,1716,1717,1718,1719,1720,1721,1722,
+1723,1724,1725,1726,1727,1728,1729,1730,
+1731,1732,1733,1734,1735,1736,1737,1738,
+1739,1740,1741,1742,1743,1744,1745,1746,
+1747,1748,1749,1750,1751,1752,1753,1754,
+1755,1756,1757,1758,1759,1760,1761,1762,
+1763,1764,1765,1766,1767,1768,1769,1770,
+1771,1772,1773,1774,1775,1776,1777,1778,
+1779,1780,1781,1782,1783,1784,1785,1786,
+1787,1788,1789,1790,1791,1792,1793,1794,
+1795,1796,1797,1798,1799,1800,1801,1802,
+1803,1804,1805,1806,1807,1808,1809,1810,
+1811,1812,1813,1814,1815,1816,1817,1818,
+1819,1820,1821,1822,1823,1824,1825,1826,
+1827,1828,1829,1830,1831,1832,1833,1834,
+1835,1836,1837,1838,1839,1840,1841,1842,
+/* Block: 133 */
+1843,1844,1845,1846,1847,1848,1849,1850,
+1851,1852,1853,1854,1855,1856,1857,1858,
+1859,1860,1861,1862,1863,1864,1865,1866,
+1867,1868,1869,1870,1871,1872,1873,1874,
+1875,1876,1877,1878,1879,1880,1881,1882,
+1883,1884,1885,1886,1887,1888,1889,1890,
+1891,1892,1893,1894,1895,1896,1897,1898,
+1899,1900,1901,1902,1903,1904,1905,1906,
+1907,1908,1909,1910,1911,1912,1913,1914,
+1915,1916,1917,1918,1919,1920,1921,1922,
+1923,1924,1925,1926,1927,1928,1929,1930,
+1931,1932,1933,1934,1935,1936,1937,1938,
+1939,1940,1941,1942,1943,1944,1945,1946,
+1947,1948,1949,1950,1951,1952,1953,1954,
+1955,1956,1957,1958,1959,1960,1961,1962,
+1963,1964,1965,1966,1967,1968,1969,1970,
+/* Block: 134 */
+1971,1972,1973,1974,1975,1976,1977,1978,
+1979,1980,1981,1982,1983,1984,1985,1986,
+1987,1988,1989,1990,1991,1992,1993,1994,
+1995,1996,1997,1998,1999,2000,2001,2002,
+2003,2004,2005,2006,2007,2008,2009,2010,
+2011,2012,2013,2014,2015,2016,2017,2018,
+2019,2020,2021,2022,2023,2024,2025,2026,
+2027,2028,2029,2030,2031,2032,2033,2034,
+2035,2036,2037,2038,2039,2040,2041,2042,
+2043,2044,2045,2046,2047,2048,2049,2050,
+2051,2052,2053,2054,2055,2056,2057,2058,
+2059,2060,2061,2062,2063,2064,2065,2066,
+2067,2068,2069,2070,2071,2072,2073,2074,
+2075,2076,2077,2078,2079,2080,2081,2082,
+2083,2084,2085,2086,2087,2088,2089,2090,
+2091,2092,2093,2094,2095,2096,2097,2098,
+/* Block: 135 */
+2099,2100,2101,2102,2103,2104,2105,2106,
+2107,2108,2109,2110,2111,2112,2113,2114,
+2115,2116,2117,2118,2119,2120,2121,2122,
+2123,2124,2125,2126,2127,2128,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0};
+
+uaix_const_data uaix_data_array(type_codept, stage3_ccc_qc_decomp, 2129) = {
+0,4096,70144,266752,463360,659968,856576,1053184,
+1249792,1446400,1643008,1839616,2036224,2232832,2429440,2626048,
+2822656,3019264,3215872,3412480,3609088,3805696,4002304,4198912,
+4395520,4592128,4788736,4985344,5181952,5378560,5575168,5771776,
+5968384,6164992,6361600,6558208,6754816,6951424,7148032,7344640,
+7541248,7737856,7934464,8131072,8327680,8524288,8720896,8917504,
+9114112,9310720,9507328,9703936,9900544,10097152,10293760,10490368,
+10686976,10883584,11080192,11276800,11473408,11670016,11866624,12063232,
+12259840,12456448,12653056,12849664,13046272,13242880,13439488,13636096,
+13832704,14029312,14225920,14422528,14619136,14815744,15012352,15208960,
+15405568,15602176,15798784,15995392,16192000,16388608,16585216,16781824,
+16978432,17175040,17371648,17568256,17764864,17961472,18158080,18354688,
+18551296,18747904,18944512,19141120,19337728,19534336,19730944,19927552,
+20124160,20320768,20517376,20713984,20910592,21107200,21303808,21500416,
+21697024,21893632,22090240,22286848,22483456,22680064,22876672,23073280,
+23269888,23466496,23663104,23859712,24056320,24252928,24449536,24646144,
+24842752,25039360,25235968,25432576,25629184,25825792,26022400,26219008,
+26415616,26612224,26808832,27005440,27202048,27398656,27595264,27791872,
+27988480,28185088,28381696,28578304,28774912,28971520,29168128,29364736,
+29561344,29757952,29954560,30151168,30347776,30544384,30740992,30937600,
+31134208,31330816,31527424,31724032,31920640,32117248,32313856,32510464,
+32707072,32903680,33100288,33296896,33493504,33690112,33886720,34087424,
+34349568,34611712,34873856,35136000,35398144,35660288,35922432,36184576,
+36446720,36708864,36971008,37229056,37425664,37622272,37818880,38015488,
+38212096,38408704,38605312,38806016,39068160,39326208,39522816,39719424,
+39916032,40112640,40309248,40505856,40706560,40968704,41226752,41423360,
+41619968,41816576,42013184,42209792,42406400,42603008,42799616,42996224,
+43192832,43389440,43586048,43782656,43979264,44175872,44372480,44569088,
+44765696,44962304,45158912,45355520,45552128,45748736,45945344,46141952,
+46338560,46535168,46731776,46928384,47124992,47321600,47518208,47714816,
+47911424,48108032,48304640,48501248,48701952,48964096,49226240,49488384,
+49746432,49943040,50143744,50405888,50663936,50860544,16870,16614,
+16616,16604,16856,16586,16860,16842,16385,16641,
+51069926,51200998,51332070,51479526,16880,16617,16618,51643136,
+51774208,51913216,52105728,52298496,52433408,52630016,52826624,53023232,
+53219840,53416448,53617152,53875200,54071808,54268416,54465024,54661632,
+54858240,55058944,55316992,55513600,55710208,55906816,56103424,56300032,
+56496640,56693248,56889856,57086464,57283072,57479680,57676288,57872896,
+58069504,58266112,58462720,58659328,58855936,59052544,59249152,59445760,
+59642368,59838976,60035584,60232192,60428800,60625408,60822016,61018624,
+61215232,61411840,61608448,61805056,62001664,62198272,62394880,62591488,
+62788096,62984704,63181312,63377920,63574528,63771136,63967744,64164352,
+64360960,64557568,64754176,64950784,65147392,65344000,65540608,65737216,
+65933824,66130432,66327040,66523648,66720256,16606,16612,16394,
+16395,16396,16397,16398,16399,16400,16401,16402,
+16403,16404,16405,16406,16407,16408,16409,16414,
+16415,16416,66916864,67113472,67310080,67506688,67703296,16411,
+16412,16413,16417,16418,16419,67899904,68096512,68293120,
+16420,68489728,68686336,68882944,16647,16393,69079808,69276416,
+69473024,69669632,69866240,70062848,70259456,70456064,16391,256,
+70648320,70844928,71045888,71242496,71439104,71635712,71832320,72028928,
+72225536,72422144,72618752,72811008,73007616,73204224,73405184,73601792,
+73794048,73990656,74187264,74383872,74584576,16468,16731,74777088,
+74973696,75170304,75366912,75563520,75825664,76022272,76218880,16649,
+76419584,76612096,76812800,77070848,16487,16491,16502,16506,
+16600,77267712,77464320,77660928,77857536,78054144,78250752,16513,
+16514,78480128,16516,78676736,78844672,8192,79041280,79266560,
+79430400,79627008,79823616,80020224,80216832,80413440,80609792,80806400,
+81003008,81199616,81396224,81592832,81789440,81986048,82182656,82379264,
+82575872,82772480,16598,16602,82973184,83169792,83366400,83563008,
+83759616,83956224,84152832,84349440,84550144,84812288,85070336,85266944,
+85463552,85660160,85856768,86053376,86249984,86446592,86643200,86839808,
+87040512,87302656,87564800,87826944,88084992,88281600,88478208,88674816,
+88875520,89137664,89395712,89592320,89788928,89985536,90182144,90378752,
+90575360,90771968,90968576,91165184,91361792,91558400,91755008,91951616,
+92148224,92344832,92545536,92807680,93065728,93262336,93458944,93655552,
+93852160,94048768,94245376,94441984,94642688,94904832,95162880,95359488,
+95556096,95752704,95949312,96145920,96342528,96539136,96735744,96932352,
+97128960,97325568,97522176,97718784,97915392,98112000,98308608,98505216,
+98705920,98968064,99230208,99492352,99754496,100016640,100278784,100540928,
+100798976,100995584,101192192,101388800,101585408,101782016,101978624,102175232,
+102375936,102638080,102896128,103092736,103289344,103485952,103682560,103879168,
+104079872,104342016,104604160,104866304,105128448,105390592,105648640,105845248,
+106041856,106238464,106435072,106631680,106828288,107024896,107221504,107418112,
+107614720,107811328,108007936,108204544,108405248,108667392,108929536,109191680,
+109449728,109646336,109842944,110039552,110236160,110432768,110629376,110825984,
+111022592,111219200,111415808,111612416,111809024,112005632,112202240,112398848,
+112595456,112792064,112988672,113185280,113381888,113578496,113775104,113971712,
+114168320,114364928,114561536,114758144,114954752,115151360,115347968,115544576,
+115741184,115937792,116134400,116335104,116597248,116859392,117121536,117383680,
+117645824,117907968,118170112,118432256,118694400,118956544,119218688,119480832,
+119742976,120005120,120267264,120529408,120791552,121053696,121315840,121573888,
+121770496,121967104,122163712,122360320,122556928,122757632,123019776,123281920,
+123544064,123806208,124068352,124330496,124592640,124854784,125116928,125374976,
+125571584,125768192,125964800,126161408,126358016,126554624,126751232,126951936,
+127214080,127476224,127738368,128000512,128262656,128524800,128786944,129049088,
+129311232,129573376,129835520,130097664,130359808,130621952,130884096,131146240,
+131408384,131670528,131932672,132190720,132387328,132583936,132780544,132981248,
+133243392,133505536,133767680,134029824,134291968,134554112,134816256,135078400,
+135340544,135598592,135795200,135991808,136188416,136385024,136581632,136778240,
+136974848,137171456,137368064,137568768,137830912,138093056,138355200,138617344,
+138879488,139137536,139334144,139534848,139796992,140059136,140321280,140583424,
+140845568,141103616,141300224,141500928,141763072,142025216,142287360,142545408,
+142742016,142942720,143204864,143467008,143729152,143987200,144183808,144384512,
+144646656,144908800,145170944,145433088,145695232,145953280,146149888,146350592,
+146612736,146874880,147137024,147399168,147661312,147919360,148115968,148316672,
+148578816,148840960,149103104,149365248,149627392,149885440,150082048,150282752,
+150544896,150807040,151069184,151331328,151593472,151851520,152048128,152248832,
+152510976,152773120,153035264,153293312,153489920,153690624,153952768,154214912,
+154477056,154735104,154931712,155132416,155394560,155656704,155918848,156180992,
+156443136,156701184,156901888,157164032,157426176,157684224,157880832,158081536,
+158343680,158605824,158867968,159130112,159392256,159650304,159846912,160047616,
+160309760,160571904,160834048,161096192,161358336,161616384,161813248,162009600,
+162206464,162402816,162599680,162796032,162992896,163189248,163386112,163582464,
+163779328,163975680,164172544,164372992,164635136,164901376,165229056,165556736,
+165884416,166212096,166539776,166863360,167125504,167391744,167719424,168047104,
+168374784,168702464,169030144,169353728,169615872,169882112,170209792,170537472,
+170865152,171192832,171520512,171844096,172106240,172372480,172700160,173027840,
+173355520,173683200,174010880,174334464,174596608,174862848,175190528,175518208,
+175845888,176173568,176501248,176824832,177086976,177353216,177680896,178008576,
+178336256,178663936,178991616,179311104,179507712,179708416,179966464,180167168,
+180425216,180625920,180883968,181080576,181277184,181474048,181670400,181863168,
+182002176,182198784,182456832,182657536,182915584,183116288,183374336,183571200,
+183767552,183964416,184160768,184361472,184558080,184754688,184947200,185143808,
+185344512,185606912,185864704,186065408,186323456,186520064,186716672,186913536,
+187113984,187310592,187507200,187699712,187896320,188097024,188359424,188617216,
+188813824,189010432,189211136,189469184,189665792,189862400,190059264,190255616,
+190456320,190653184,190841600,190980608,191238656,191439360,191697408,191898112,
+192156160,192353024,192549376,192746240,192942592,193139456,193266432,193397504,
+193528576,193659648,193794816,193991168,194187776,194384384,194580992,194777600,
+194974208,195170816,195367424,195564032,195760640,195957248,196153856,196350464,
+196547072,196743680,196940288,197136896,197333504,197530112,197726720,197923328,
+198119936,198316544,198513152,198709760,198906368,199102976,199299584,199496192,
+199692800,199889408,200086016,200282624,200479232,200675840,200872448,201069056,
+201265664,201462272,201658880,201855488,202052096,202248704,202445312,202638080,
+202769152,202904320,16608,203100672,203297280,203493888,203690496,203887104,
+204083712,204280320,204476928,204673536,204870144,205066752,205263360,205459968,
+205656576,205853184,206049792,206246400,206443008,206639616,206836224,207032832,
+207229440,207426048,207622656,207819264,208015872,16648,208212480,208409088,
+208605696,208802304,208998912,209195520,209392128,209588736,209785344,209981952,
+210178560,210375168,210571776,210768384,210964992,211161600,211358208,211554816,
+211751424,211948032,212144640,212341248,212537856,212734464,212931072,213127680,
+213324288,213520896,213717504,213914112,214110720,214307328,512,214500096,
+214631168,214762240,214893312,215024384,215155456,215286528,215417600,215548672,
+215679744,215810816,215941888,216072960,216204032,216335104,216466176,216597248,
+216728320,216859392,216990464,217121536,217252608,217383680,217514752,217645824,
+217776896,217907968,218039040,218170112,218301184,218432256,218563328,218694400,
+218825472,218956544,219087616,219218688,219349760,219480832,219611904,219742976,
+219874048,220005120,220136192,220267264,220398336,220529408,220660480,220791552,
+220922624,221053696,221184768,221315840,221446912,221577984,221709056,221840128,
+221971200,222102272,222233344,222364416,222495488,222626560,222757632,222888704,
+223019776,223150848,223281920,223412992,223544064,223675136,223806208,223937280,
+224068352,224199424,224330496,224461568,224592640,224723712,224854784,224985856,
+225116928,225248000,225379072,225510144,225641216,225772288,225903360,226034432,
+226165504,226296576,226427648,226558720,226689792,226820864,226951936,227083008,
+227214080,227345152,227476224,227607296,227738368,227869440,228000512,228131584,
+228262656,228393728,228524800,228655872,228786944,228918016,229049088,229180160,
+229311232,229442304,229573376,229704448,229835520,229966592,230097664,230228736,
+230359808,230490880,230621952,230753024,230884096,231015168,231146240,231277312,
+231408384,231539456,231670528,231801600,231932672,232063744,232194816,232325888,
+232456960,232588032,232719104,232850176,232981248,233112320,233243392,233374464,
+233505536,233636608,233767680,233898752,234029824,234160896,234291968,234423040,
+234554112,234685184,234816256,234947328,235078400,235209472,235340544,235471616,
+235602688,235733760,235864832,235995904,236126976,236258048,236389120,236520192,
+236651264,236782336,236913408,237044480,237175552,237306624,237437696,237568768,
+237699840,237830912,237961984,238093056,238224128,238355200,238486272,238617344,
+238748416,238879488,239010560,239141632,239272704,239403776,239534848,239665920,
+239796992,239928064,240059136,240190208,240321280,240452352,240583424,240714496,
+240845568,240976640,241107712,241238784,241369856,241500928,241632000,241763072,
+241894144,242025216,242156288,242287360,242418432,242549504,242680576,242811648,
+242942720,243073792,243204864,243335936,243467008,243598080,243729152,243860224,
+243991296,244122368,244253440,244384512,244515584,244646656,244777728,244908800,
+245039872,245170944,245302016,245433088,245564160,245695232,245826304,245957376,
+246088448,246219520,246350592,246481664,246612736,246743808,246874880,247005952,
+247137024,247268096,247399168,247530240,247661312,247792384,247923456,248054528,
+248185600,248316672,248447744,248578816,248709888,248840960,248972032,249103104,
+249234176,249365248,249496320,249627392,249758464,249889536,250020608,250151680,
+250282752,250413824,250544896,250675968,250807040,250938112,251069184,251200256,
+251331328,251462400,251593472,251724544,251855616,251986688,252117760,252248832,
+252379904,252510976,252642048,252773120,252904192,253035264,253166336,253297408,
+253428480,253559552,253690624,253821696,253952768,254083840,254214912,254345984,
+254477056,254608128,254739200,254870272,255001344,255132416,255263488,255394560,
+255525632,255656704,255787776,255918848,256049920,256180992,256312064,256443136,
+256574208,256705280,256836352,256967424,257098496,257229568,257360640,257491712,
+257622784,257753856,257884928,258016000,258147072,258278144,258409216,258540288,
+258671360,258802432,258933504,259064576,259195648,259326720,259457792,259588864,
+259719936,259851008,259982080,260113152,260244224,260375296,260506368,260637440,
+260768512,260899584,261030656,261161728,261292800,261423872,261554944,261686016,
+261817088,261948160,262079232,262210304,262341376,262472448,262603520,262734592,
+262865664,262996736,263127808,263258880,263389952,263521024,263652096,263783168,
+263914240,264045312,264176384,264307456,264438528,264569600,264700672,264831744,
+264962816,265093888,265224960,265356032,265487104,265618176,265749248,265880320,
+266011392,266142464,266273536,266404608,266535680,266666752,266797824,266928896,
+267059968,267191040,267322112,267453184,267584256,267715328,267846400,267977472,
+268108544,268239616,268370688,268501760,268632832,268763904,268894976,269026048,
+269157120,269288192,269419264,269550336,269681408,269812480,269943552,270074624,
+270205696,270336768,270467840,270598912,270729984,270861056,270992128,271123200,
+271254272,271385344,271516416,271647488,271778560,271909632,272040704,272171776,
+272302848,272433920,272564992,272696064,272827136,272958208,273089280,273220352,
+273351424,273482496,273613568,273744640,273875712,274006784,274137856,274268928,
+274400000,274531072,274662144,274797312,16410,274993920,275190528,275387136,
+275587840,275849984,276108032,276304640,276501248,276697856,276894464,277091072,
+277287680,277484288,277680896,277877504,278074112,278270720,278467328,278663936,
+278860544,279057152,279253760,279450368,279646976,279843584,280040192,280236800,
+280433408,280630016,280826624,281023232,281219840,281416448,16384,281612800,
+281809408,282006016,282198528,282395136,282591744,282788352,282984960,283181568,
+283378176,283574784,283771392,283968000,16390,284168960,284365568,284566272,
+284828416,285090560,285352704,285614848,16610,285872896,286069504,286270208,
+286532352,286794496,287056640,287310592,287441664,287572736,287703808,287834880,
+287965952,288097024,288228096,288359168,288490240,288621312,288752384,288883456,
+289014528,289145600,289276672,289407744,289538816,289669888,289800960,289932032,
+290063104,290194176,290325248,290456320,290587392,290718464,290849536,290980608,
+291111680,291242752,291373824,291504896,291635968,291767040,291898112,292029184,
+292160256,292291328,292422400,292553472,292684544,292815616,292946688,293077760,
+293208832,293339904,293470976,293602048,293733120,293864192,293995264,294126336,
+294257408,294388480,294519552,294650624,294781696,294912768,295043840,295174912,
+295305984,295437056,295568128,295699200,295830272,295961344,296092416,296223488,
+296354560,296485632,296616704,296747776,296878848,297009920,297140992,297272064,
+297403136,297534208,297665280,297796352,297927424,298058496,298189568,298320640,
+298451712,298582784,298713856,298844928,298976000,299107072,299238144,299369216,
+299500288,299631360,299762432,299893504,300024576,300155648,300286720,300417792,
+300548864,300679936,300811008,300942080,301073152,301204224,301335296,301466368,
+301597440,301728512,301859584,301990656,302121728,302252800,302383872,302514944,
+302646016,302777088,302908160,303039232,303170304,303301376,303432448,303563520,
+303694592,303825664,303956736,304087808,304218880,304349952,304481024,304612096,
+304743168,304874240,305005312,305136384,305267456,305398528,305529600,305660672,
+305791744,305922816,306053888,306184960,306316032,306447104,306578176,306709248,
+306840320,306971392,307102464,307233536,307364608,307495680,307626752,307757824,
+307888896,308019968,308151040,308282112,308413184,308544256,308675328,308806400,
+308937472,309068544,309199616,309330688,309461760,309592832,309723904,309854976,
+309986048,310117120,310248192,310379264,310510336,310641408,310772480,310903552,
+311034624,311165696,311296768,311427840,311558912,311689984,311821056,311952128,
+312083200,312214272,312345344,312476416,312607488,312738560,312869632,313000704,
+313131776,313262848,313393920,313524992,313656064,313787136,313918208,314049280,
+314180352,314311424,314442496,314573568,314704640,314835712,314966784,315097856,
+315228928,315360000,315491072,315622144,315753216,315884288,316015360,316146432,
+316277504,316408576,316539648,316670720,316801792,316932864,317063936,317195008,
+317326080,317457152,317588224,317719296,317850368,317981440,318112512,318243584,
+318374656,318505728,318636800,318767872,318898944,319030016,319161088,319292160,
+319423232,319554304,319685376,319816448,319947520,320078592,320209664,320340736,
+320471808,320602880,320733952,320865024,320996096,321127168,321258240,321389312,
+321520384,321651456,321782528,321913600,322044672,322175744,322306816,322437888,
+322568960,322700032,322831104,322962176,323093248,323224320,323355392,323486464,
+323617536,323748608,323879680,324010752,324141824,324272896,324403968,324535040,
+324666112,324797184,324928256,325059328,325190400,325321472,325452544,325583616,
+325714688,325845760,325976832,326107904,326238976,326370048,326501120,326632192,
+326763264,326894336,327025408,327156480,327287552,327418624,327549696,327680768,
+327811840,327942912,328073984,328205056,328336128,328467200,328598272,328729344,
+328860416,328991488,329122560,329253632,329384704,329515776,329646848,329777920,
+329908992,330040064,330171136,330302208,330433280,330564352,330695424,330826496,
+330957568,331088640,331219712,331350784,331481856,331612928,331744000,331875072,
+332006144,332137216,332268288,332399360,332530432,332661504,332792576,332923648,
+333054720,333185792,333316864,333447936,333579008,333710080,333841152,333972224,
+334103296,334234368,334365440,334496512,334627584,334758656,334889728,335020800,
+335151872,335282944,335414016,335545088,335676160,335807232,335938304,336069376,
+336200448,336331520,336462592,336593664,336724736,336855808,336986880,337117952,
+337249024,337380096,337511168,337642240,337773312,337904384,338035456,338166528,
+338297600,338428672,338559744,338690816,338821888,338952960,339084032,339215104,
+339346176,339477248,339608320,339739392,339870464,340001536,340132608,340263680,
+340394752,340525824,340656896,340787968,340919040,341050112,341181184,341312256,
+341443328,341574400,341705472,341836544,341967616,342098688,342229760,342360832,
+342491904,342622976,342754048,342885120,343016192,343147264,343278336,343409408,
+343540480,343671552,343802624,343933696,344064768,344195840,344326912,344457984,
+344589056,344720128,344851200,344982272,345113344,345244416,345375488,345506560,
+345637632,345768704,345899776,346030848,346161920,346292992,346424064,346555136,
+346686208,346817280,346948352,347079424,347210496,347341568,347472640,347603712,
+347734784,347865856,347996928,348128000,348259072,348390144,348521216,348652288,
+348783360,348914432,349045504,349176576,349307648,349438720,349569792,349700864,
+349831936,349963008,350094080,350225152,350356224,350487296,350618368,350749440,
+350880512,351011584,351142656,351273728,351404800,351535872,351666944,351798016,
+351929088,352060160,352191232,352322304,352453376,352584448,352715520,352846592,
+352977664,353108736,353239808,353370880,353501952,353633024,353764096,353895168,
+354026240,354157312,354288384,354419456,354550528,354681600,354812672,354943744,
+355074816,355205888,355336960,355468032,355599104,355730176,355861248,355992320,
+356123392,356254464,356385536,356516608,356647680,356778752,356909824,357040896,
+357171968,357303040,357434112,357565184,357696256,357827328,357958400,358089472,
+358220544};
+
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
 uaix_const_data uaix_data_array(type_codept, stage3_decomp_nfd, 5468) = {
 0,2,65,768,2,65,769,2,
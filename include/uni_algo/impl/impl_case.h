@@ -1107,6 +1107,323 @@ uaix_static bool impl_case_search_utf16(it_in_utf16 first1, it_end_utf16 last1,
     return false;
 }
 
+// Preprocessed caseless search for the same needle in many strings.
+// The needle is case folded once by impl_case_searcher_fold_utf8/utf16 and prepared by impl_case_searcher_prepare.
+// Then the haystack is case folded only once in a forward pass to a window of the last folded units
+// and Boyer-Moore-Horspool runs over the folded units, so it is O(n) decoding instead of O(n*m)
+// in impl_case_search_utf8/utf16 that decodes and folds the haystack again on every restart.
+// Code units that cannot start a match are skipped without decoding when the window is empty.
+// The result is always the same as the result of impl_case_search_utf8/utf16 with caseless == true:
+// a match starts at the first folded unit of a code point and ends at the last folded unit of a code point.
+
+struct impl_case_searcher
+{
+    size_t size; // Number of folded units in the needle
+    type_codept back; // The last folded unit of the needle
+    size_t shift[256]; // Horspool shift by the low byte of a folded unit
+    bool lead[256]; // ASCII code units and UTF-8 lead code units of code points that can start a match
+    bool skip; // Code units can be skipped by lead
+};
+
+struct impl_case_searcher_unit
+{
+    type_codept c; // Folded unit
+    size_t pos; // Start of the code point in the haystack
+    size_t end; // End of the code point in the haystack
+    bool first; // The first folded unit of the code point
+    bool last; // The last folded unit of the code point
+};
+
+uaix_always_inline
+uaix_static size_t case_searcher_fold(type_codept c, type_codept* const units)
+{
+    // Folded units of the code point the same way as in impl_case_search_utf8: iter_fold + stages_fold
+
+#ifndef UNI_ALGO_DISABLE_FULL_CASE
+    if (stages_special_fold_check(c))
+    {
+        struct case_special_buffer buffer = {{0}}; // tag_can_be_uninitialized
+        const size_t size = stages_special_fold(c, &buffer);
+        for (size_t i = 0; i < size; ++i)
+            units[i] = stages_fold(buffer.cps[i]);
+        return size;
+    }
+#endif
+
+    units[0] = stages_fold(c);
+    return 1;
+}
+
+uaix_always_inline
+uaix_static size_t case_searcher_push(struct impl_case_searcher_unit* const window, size_t mask, size_t head,
+                                      type_codept c, size_t pos, size_t end)
+{
+    type_codept units[impl_max_case_expand] = {0}; // tag_can_be_uninitialized
+    const size_t size = case_searcher_fold(c, units);
+
+    for (size_t i = 0; i < size; ++i, ++head)
+    {
+        struct impl_case_searcher_unit* const u = &window[head & mask];
+        u->c = units[i];
+        u->pos = pos;
+        u->end = end;
+        u->first = (i == 0);
+        u->last = (i == size - 1);
+    }
+
+    return head;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf32>
+#endif
+uaix_always_inline_tmpl
+uaix_static bool case_searcher_match(const struct impl_case_searcher* const s, it_in_utf32 needle,
+                                     const struct impl_case_searcher_unit* const window, size_t mask, size_t k)
+{
+    // Compare the last unit first like Horspool does then the rest of the window at the alignment k
+
+    const struct impl_case_searcher_unit* const u = &window[(k + s->size - 1) & mask];
+
+    if (u->c != s->back || !u->last || !window[k & mask].first)
+        return false;
+
+    it_in_utf32 src = needle;
+    for (size_t i = 0; i < s->size - 1; ++i, ++src)
+    {
+        if (window[(k + i) & mask].c != (type_codept)*src)
+            return false;
+    }
+
+    return true;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf32>
+#endif
+uaix_static void impl_case_searcher_prepare(struct impl_case_searcher* const s, it_in_utf32 needle, size_t size)
+{
+    s->size = size;
+    s->back = 0;
+
+    for (size_t i = 0; i < 256; ++i)
+    {
+        s->shift[i] = size;
+        s->lead[i] = false;
+    }
+    s->skip = false;
+
+    if (size == 0)
+        return;
+
+    const type_codept first = (type_codept)*needle;
+
+    it_in_utf32 src = needle;
+    for (size_t i = 0; i < size - 1; ++i, ++src)
+        s->shift[(type_codept)*src & 0xFF] = size - 1 - i;
+    s->back = (type_codept)*src;
+
+    // U+FFFD can be produced by any ill-formed code unit so nothing can be skipped
+    if (first == 0xFFFD)
+        return;
+
+    // Mark ASCII code units and UTF-8 lead code units of all BMP code points
+    // that can be folded to units that start with the first unit of the needle
+    for (type_codept c = 0; c <= 0xFFFF; ++c)
+    {
+        if (c >= 0xD800 && c <= 0xDFFF)
+            continue;
+
+        type_codept units[impl_max_case_expand] = {0}; // tag_can_be_uninitialized
+        case_searcher_fold(c, units);
+
+        if (units[0] == first)
+        {
+            if (c <= 0x7F)
+                s->lead[c] = true;
+            else if (c <= 0x7FF)
+                s->lead[0xC0 | (c >> 6)] = true;
+            else
+                s->lead[0xE0 | (c >> 12)] = true;
+        }
+    }
+    // Supplementary code points are not checked so 4-byte sequences always can start a match
+    for (size_t i = 0xF0; i <= 0xF4; ++i)
+        s->lead[i] = true;
+
+    s->skip = true;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf32>
+#endif
+uaix_static size_t impl_case_searcher_fold_utf8(it_in_utf8 first, it_end_utf8 last, it_out_utf32 result)
+{
+    // The result must be impl_max_case_expand times the size of the source
+
+    it_in_utf8 src = first;
+    it_out_utf32 dst = result;
+    type_codept c = 0; // tag_can_be_uninitialized
+
+    while (src != last)
+    {
+        src = iter_utf8(src, last, &c, iter_replacement);
+
+        type_codept units[impl_max_case_expand] = {0}; // tag_can_be_uninitialized
+        const size_t size = case_searcher_fold(c, units);
+        for (size_t i = 0; i < size; ++i)
+            *dst++ = (type_char32)units[i];
+    }
+
+    return (size_t)(dst - result);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16, typename it_out_utf32>
+#endif
+uaix_static size_t impl_case_searcher_fold_utf16(it_in_utf16 first, it_end_utf16 last, it_out_utf32 result)
+{
+    // The result must be impl_max_case_expand times the size of the source
+
+    it_in_utf16 src = first;
+    it_out_utf32 dst = result;
+    type_codept c = 0; // tag_can_be_uninitialized
+
+    while (src != last)
+    {
+        src = iter_utf16(src, last, &c, iter_replacement);
+
+        type_codept units[impl_max_case_expand] = {0}; // tag_can_be_uninitialized
+        const size_t size = case_searcher_fold(c, units);
+        for (size_t i = 0; i < size; ++i)
+            *dst++ = (type_char32)units[i];
+    }
+
+    return (size_t)(dst - result);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_in_utf32>
+#endif
+uaix_static bool impl_case_searcher_utf8(const struct impl_case_searcher* const s, it_in_utf32 needle,
+                                         it_in_utf8 first, it_end_utf8 last,
+                                         struct impl_case_searcher_unit* const window, size_t window_size,
+                                         size_t* const pos, size_t* const end)
+{
+    // The needle must not be empty
+    // The window size must be a power of two and at least the needle size + impl_max_case_expand - 1
+
+    const size_t mask = window_size - 1;
+    it_in_utf8 src = first;
+    size_t head = 0; // Number of folded units in the window so far (the next unit)
+    size_t k = 0; // Alignment of the needle in the window
+
+    while (true)
+    {
+        // Nothing is folded at the alignment yet so skip code units that cannot start a match,
+        // ASCII and lead code units are always on a code point boundary in iter_utf8
+        if (k == head && s->skip)
+        {
+            while (src != last && !s->lead[*src & 0xFF])
+                ++src;
+        }
+
+        while (head < k + s->size)
+        {
+            if (src == last)
+                return false;
+
+            type_codept c = 0; // tag_can_be_uninitialized
+            const size_t p = (size_t)(src - first);
+            src = iter_utf8(src, last, &c, iter_replacement);
+            head = case_searcher_push(window, mask, head, c, p, (size_t)(src - first));
+        }
+
+        if (case_searcher_match(s, needle, window, mask, k))
+        {
+            *pos = window[k & mask].pos;
+            *end = window[(k + s->size - 1) & mask].end;
+            return true;
+        }
+
+        k += s->shift[window[(k + s->size - 1) & mask].c & 0xFF];
+    }
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16, typename it_in_utf32>
+#endif
+uaix_static bool impl_case_searcher_utf16(const struct impl_case_searcher* const s, it_in_utf32 needle,
+                                          it_in_utf16 first, it_end_utf16 last,
+                                          struct impl_case_searcher_unit* const window, size_t window_size,
+                                          size_t* const pos, size_t* const end)
+{
+    // The needle must not be empty
+
+    const size_t mask = window_size - 1;
+    it_in_utf16 src = first;
+    size_t head = 0; // Number of folded units in the window so far (the next unit)
+    size_t k = 0; // Alignment of the needle in the window
+
+    while (true)
+    {
+        // The same as in impl_case_searcher_utf8 but only ASCII is skipped
+        if (k == head && s->skip)
+        {
+            while (src != last && (*src & 0xFFFF) <= 0x7F && !s->lead[*src & 0x7F])
+                ++src;
+        }
+
+        while (head < k + s->size)
+        {
+            if (src == last)
+                return false;
+
+            type_codept c = 0; // tag_can_be_uninitialized
+            const size_t p = (size_t)(src - first);
+            src = iter_utf16(src, last, &c, iter_replacement);
+            head = case_searcher_push(window, mask, head, c, p, (size_t)(src - first));
+        }
+
+        if (case_searcher_match(s, needle, window, mask, k))
+        {
+            *pos = window[k & mask].pos;
+            *end = window[(k + s->size - 1) & mask].end;
+            return true;
+        }
+
+        k += s->shift[window[(k + s->size - 1) & mask].c & 0xFF];
+    }
+}
+
+// Multi-pattern caseless search is done in the wrapper, these functions decode the next code point
+// and case fold it to folded units the same way as impl_case_search_utf8/utf16 does.
+// The units must be impl_max_case_expand in size, the number of folded units is written to the size.
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_static it_in_utf8 impl_case_fold_next_utf8(it_in_utf8 first, it_end_utf8 last,
+                                                type_codept* const units, size_t* const size)
+{
+    type_codept c = 0; // tag_can_be_uninitialized
+    it_in_utf8 src = iter_utf8(first, last, &c, iter_replacement);
+    *size = case_searcher_fold(c, units);
+    return src;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16>
+#endif
+uaix_static it_in_utf16 impl_case_fold_next_utf16(it_in_utf16 first, it_end_utf16 last,
+                                                  type_codept* const units, size_t* const size)
+{
+    type_codept c = 0; // tag_can_be_uninitialized
+    it_in_utf16 src = iter_utf16(first, last, &c, iter_replacement);
+    *size = case_searcher_fold(c, units);
+    return src;
+}
+
 #ifdef __cplusplus
 template<typename it_in_utf8, typename it_end_utf8>
 #endif
@@ -1146,16 +1463,39 @@ uaix_static bool impl_case_like_utf8(it_in_utf8 first1, it_end_utf8 last1,
         return false;
 
 #ifndef UNI_ALGO_DISABLE_FULL_CASE
-    while ((src1 != last1 || pair1.count || skip1) && (src2 != last2 || pair2.count))
+    while (src1 != last1 || pair1.count || skip1)
     {
+        if (src2 == last2 && !pair2.count)
+#else
+    while (src1 != last1 || skip1)
+    {
+        if (src2 == last2)
+#endif
+        {
+            // The pattern ended before the string so restart after the last all
+            // Test: "abcabc" "%abc" | "sss" "%ss"
+            if (!multi || src2 == back2)
+                break;
+
+#ifndef UNI_ALGO_DISABLE_FULL_CASE
+            pair1.count = 0;
+#endif
+            skip1 = false;
+            prev_escape = false;
+            src2 = back2;
+            src1 = back1;
+            prev1 = back1;
+            back1 = prev1;
+            continue;
+        }
+
+#ifndef UNI_ALGO_DISABLE_FULL_CASE
         if (skip1)
             skip1 = false;
         else
             src1 = iter_fold_utf8(src1, last1, &c1, &pair1, &buffer1);
         src2 = iter_fold_utf8(src2, last2, &c2, &pair2, &buffer2);
 #else
-    while ((src1 != last1 || skip1) && src2 != last2)
-    {
         if (skip1)
             skip1 = false;
         else
@@ -1225,6 +1565,11 @@ uaix_static bool impl_case_like_utf8(it_in_utf8 first1, it_end_utf8 last1,
 #ifndef UNI_ALGO_DISABLE_FULL_CASE
     // Test: "abc123xyz789" "%abc%xyz%"
     //if ((src1 == last1 && pair1.count == 0) || (first2 == last2 || c2 == all)) // second empty = not match
+    // The string can end in the middle of a code point of the pattern with special case folding
+    // Test: "\uFB01" "%f\u0130%"
+    if (pair2.count)
+        return false;
+
     if ((src1 == last1 && pair1.count == 0) || (first2 != last2 && c2 == all)) // second empty = match
     {
 #else
@@ -1242,6 +1587,238 @@ uaix_static bool impl_case_like_utf8(it_in_utf8 first1, it_end_utf8 last1,
     return false;
 }
 
+// Precompiled pattern for impl_case_like_utf8 with caseless == true for patterns that are used many times.
+// impl_case_like_compile_utf8 case folds the literal of the pattern once and finds the shape of the pattern:
+// "literal", "literal%", "%literal" and "%literal%" (% is all and can be repeated) are matched without backtracking,
+// by comparing the start of the string, the end of the string or by impl_case_searcher_utf8,
+// other patterns (one, escape or all in the middle) are matched by impl_case_like_utf8.
+// The result is always the same as the result of impl_case_like_utf8.
+
+uaix_const int impl_case_like_shape_general  = 0;
+uaix_const int impl_case_like_shape_all      = 1;
+uaix_const int impl_case_like_shape_exact    = 2;
+uaix_const int impl_case_like_shape_prefix   = 3;
+uaix_const int impl_case_like_shape_suffix   = 4;
+uaix_const int impl_case_like_shape_contains = 5;
+
+struct impl_case_like_pattern
+{
+    int shape;
+    size_t size; // Number of folded units in the literal
+    size_t window; // Window size for impl_case_searcher_utf8 if the shape is contains, otherwise 0
+    type_codept all;
+    type_codept one;
+    type_codept escape;
+    struct impl_case_searcher searcher;
+};
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_always_inline_tmpl
+uaix_static it_in_utf8 case_like_next_utf8(it_in_utf8 first, it_end_utf8 last, type_codept* const units, size_t* const size)
+{
+    // ASCII folds to ASCII without special folding so skip the decoding and the tables
+
+    const type_codept c = (type_codept)*first & 0xFF;
+    if (c <= 0x7F)
+    {
+        units[0] = (c >= 'A' && c <= 'Z') ? c + 32 : c;
+        *size = 1;
+        ++first;
+        return first;
+    }
+
+    type_codept cp = 0; // tag_can_be_uninitialized
+    it_in_utf8 src = iter_utf8(first, last, &cp, iter_replacement);
+    *size = case_searcher_fold(cp, units);
+    return src;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf32>
+#endif
+uaix_static size_t impl_case_like_compile_utf8(struct impl_case_like_pattern* const p, it_in_utf8 first, it_end_utf8 last,
+                                               type_codept all, type_codept one, type_codept escape, it_out_utf32 result)
+{
+    // The result must be impl_max_case_expand times the size of the pattern
+    // Then impl_case_like_prepare must be called with the result
+
+    it_in_utf8 src = first;
+    it_out_utf32 dst = result;
+    size_t lead = 0; // Number of all before the literal
+    size_t trail = 0; // Number of all after the literal
+    bool literal = false; // tag_must_be_initialized
+    type_codept c = 0; // tag_can_be_uninitialized
+
+    p->shape = impl_case_like_shape_general;
+    p->size = 0;
+    p->window = 0;
+    p->all = all;
+    p->one = one;
+    p->escape = escape;
+
+    // The same as in impl_case_like_utf8
+    if (all > 0x7F || one > 0x7F)
+        return 0;
+    if (all == escape) all = 0xFFFFFFFF;
+    if (one == escape) one = 0xFFFFFFFF;
+
+    while (src != last)
+    {
+        src = iter_utf8(src, last, &c, iter_replacement);
+
+        if (c == all)
+        {
+            if (literal)
+                ++trail;
+            else
+                ++lead;
+            continue;
+        }
+
+        // All in the middle, one or escape is a general pattern
+        if (trail || c == one || (escape && c == escape))
+            return 0;
+
+        literal = true;
+
+        type_codept units[impl_max_case_expand] = {0}; // tag_can_be_uninitialized
+        const size_t size = case_searcher_fold(c, units);
+        for (size_t i = 0; i < size; ++i)
+        {
+            // impl_case_like_utf8 checks special folding too so be safe
+            if (units[i] == all || units[i] == one || (escape && units[i] == escape))
+                return 0;
+
+            *dst++ = (type_char32)units[i];
+        }
+    }
+
+    p->size = (size_t)(dst - result);
+
+    if (!literal)
+        p->shape = lead ? impl_case_like_shape_all : impl_case_like_shape_exact;
+    else if (!lead)
+        p->shape = trail ? impl_case_like_shape_prefix : impl_case_like_shape_exact;
+    else if (!trail)
+        p->shape = impl_case_like_shape_suffix;
+    else
+    {
+        p->shape = impl_case_like_shape_contains;
+
+        // The same as the window for impl_case_searcher_utf8
+        p->window = 1;
+        while (p->window < p->size + impl_max_case_expand - 1)
+            p->window *= 2;
+    }
+
+    return p->size;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf32>
+#endif
+uaix_static void impl_case_like_prepare(struct impl_case_like_pattern* const p, it_in_utf32 literal)
+{
+    if (p->shape == impl_case_like_shape_contains)
+        impl_case_searcher_prepare(&p->searcher, literal, p->size);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_in_utf32>
+#endif
+uaix_static bool case_like_compare_utf8(it_in_utf8 first, it_end_utf8 last, it_in_utf32 literal, size_t size,
+                                        size_t skip, bool exact)
+{
+    // Skip skip folded units, then compare size folded units with the literal,
+    // the literal must start and end on a code point
+
+    it_in_utf8 src = first;
+    it_in_utf32 lit = literal;
+    size_t i = 0;
+
+    while (i < skip + size)
+    {
+        if (src == last)
+            return false;
+
+        type_codept units[impl_max_case_expand] = {0}; // tag_can_be_uninitialized
+        size_t n = 0;
+        src = case_like_next_utf8(src, last, units, &n);
+
+        if (i < skip)
+        {
+            i += n;
+            if (i > skip) // The literal is in the middle of the code point
+                return false;
+            continue;
+        }
+
+        for (size_t j = 0; j < n; ++j, ++i, ++lit)
+        {
+            if (i >= skip + size || units[j] != (type_codept)*lit)
+                return false;
+        }
+    }
+
+    return !exact || src == last;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_in_utf32>
+#endif
+uaix_static bool impl_case_like_match_utf8(const struct impl_case_like_pattern* const p, it_in_utf32 literal,
+                                           struct impl_case_searcher_unit* const window,
+                                           it_in_utf8 first1, it_end_utf8 last1,
+                                           it_in_utf8 first2, it_end_utf8 last2)
+{
+    // The pattern (first2, last2) and the literal must be the same that were used with impl_case_like_compile_utf8
+    // The window must be p->window in size, it is only used if the shape is contains
+
+    if (p->shape == impl_case_like_shape_all)
+        return true;
+    if (p->shape == impl_case_like_shape_exact)
+        return case_like_compare_utf8(first1, last1, literal, p->size, 0, true);
+    if (p->shape == impl_case_like_shape_prefix)
+        return case_like_compare_utf8(first1, last1, literal, p->size, 0, false);
+    if (p->shape == impl_case_like_shape_suffix)
+    {
+        // Every folded unit is produced by at most 4 code units so the suffix is in the last 4 * size code units,
+        // step back to a code unit that is not a continuation code unit,
+        // ASCII and lead code units are always on a code point boundary in iter_utf8
+        it_in_utf8 src = first1;
+        size_t len = 0;
+        for (; src != last1; ++src)
+            ++len;
+        for (size_t i = 0; i < p->size * 4 && i < len; ++i)
+            --src;
+        while (src != first1 && ((type_codept)*src & 0xC0) == 0x80)
+            --src;
+
+        // Count the folded units to the end then compare the last size units
+        size_t count = 0;
+        for (it_in_utf8 it = src; it != last1;)
+        {
+            type_codept units[impl_max_case_expand] = {0}; // tag_can_be_uninitialized
+            size_t n = 0;
+            it = case_like_next_utf8(it, last1, units, &n);
+            count += n;
+        }
+        if (count < p->size)
+            return false;
+
+        return case_like_compare_utf8(src, last1, literal, p->size, count - p->size, true);
+    }
+    if (p->shape == impl_case_like_shape_contains)
+    {
+        size_t pos = 0, end = 0; // tag_can_be_uninitialized
+        return impl_case_searcher_utf8(&p->searcher, literal, first1, last1, window, p->window, &pos, &end);
+    }
+
+    return impl_case_like_utf8(first1, last1, first2, last2, true, p->all, p->one, p->escape);
+}
+
 #ifndef UNI_ALGO_DISABLE_BREAK_WORD
 
 #ifdef __cplusplus
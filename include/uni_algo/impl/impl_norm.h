@@ -10,6 +10,11 @@
 #ifndef UNI_ALGO_DISABLE_PROP
 #include "impl_prop.h"
 #endif
+// Note that NFKC_Casefold has cross dependency with case module
+// and if it's disabled NFKC_Casefold functions must be disabled too
+#ifndef UNI_ALGO_DISABLE_CASE
+#include "impl_case.h"
+#endif
 
 #include "internal_defines.h"
 #include "internal_stages.h"
@@ -67,6 +72,15 @@ uaix_const size_t impl_x_norm_to_unaccent_utf16 = 3;  // tag_unicode_stable_valu
 // Only Decomposition_Mapping of NFC is Unicode stable value for strings.
 // https://www.unicode.org/policies/stability_policy.html#Property_Value
 
+#ifndef UNI_ALGO_DISABLE_CASE
+#ifndef UNI_ALGO_DISABLE_PROP
+// Modes for search key functions, can be combined
+uaix_const int impl_norm_search_key_casefold = 1 << 0; // Full case folding
+uaix_const int impl_norm_search_key_unaccent = 1 << 1; // Remove Nonspacing Mark
+uaix_const int impl_norm_search_key_compat   = 1 << 2; // NFKC instead of NFC, ignored if NFKC/NFKD is disabled
+#endif
+#endif
+
 // Return values for normalization detection functions
 uaix_const int impl_norm_is_yes                 = 0;
 uaix_const int impl_norm_is_ill_formed          = 8;
@@ -118,11 +132,47 @@ struct norm_multi
  * Only normalization detection functions can be refactored like this at this point.
  */
 
+uaix_always_inline
+uaix_static type_codept stages_ccc_qc(type_codept c)
+{
+    /* ccc_qc_decomp format: ooooooooooooooooPPPPPPPPPPPPPPPP (32-bit)
+     * P - ccc_qc (bit 0 - 15) see the format below
+     * o - offset to decomposed code points in NFD (bit 16 - 31) (0 - no decomposition)
+     *
+     * ccc_qc format: zzyydcbaxxxxxxxx (16-bit)
+     * xxxxxxxx (bit 0 - 7) - Canonical_Combining_Class (0 - 254)
+     * a (bit 8)  - NFC_Quick_Check=No || NFC_Quick_Check=Maybe (0, 1)
+     * b (bit 9)  - NFD_Quick_Check=No (0, 1)
+     * c (bit 10) - NFKC_Quick_Check=No || NFKC_Quick_Check=Maybe (0, 1)
+     * d (bit 11) - NFKD_Quick_Check=No (0, 1)
+     * yy (bit 12, 13) - Trailing non-starters in NFKD (for Stream-Safe Text Process) (0 - 3)
+     * zz (bit 14, 15) - Initial non-starters in NFKD (for Stream-Safe Text Process) (0 - 2)
+     * Note 1: there cannot be both initial and trailing only one of those
+     * Note 2: we merge Maybe and No together just because we need some space for bits
+     * for initial/trailing non-starters, we don't need Maybe in this algorithm anyway
+     * Note 3: NFD decomposition is in the same table because NFC/NFD algorithms always need
+     * CCC and Quick_Check of a code point together with its decomposition, so it is only
+     * one stage1/stage2 lookup per code point instead of two
+     * Note 4: every code point with a decomposition has its own value so stage2 contains
+     * 16-bit indexes to unique 32-bit values in stage3 instead of the values themselves,
+     * otherwise stage2 is two times bigger than separate ccc_qc and NFD tables together
+     */
+
+    return stage3_ccc_qc_decomp[stages(c, stage1_ccc_qc_decomp, stage2_ccc_qc_decomp)];
+}
+
+uaix_always_inline
+uaix_static size_t stages_ccc_qc_decomp_nfd(type_codept ccc_qc)
+{
+    // return offset to decomposed code points in NFD from ccc_qc data
+    return (size_t)(ccc_qc >> 16);
+}
+
 uaix_always_inline
 uaix_static size_t stages_decomp_nfd(type_codept c)
 {
     // return offset to decomposed code points in NFD
-    return stages(c, stage1_decomp_nfd, stage2_decomp_nfd);
+    return stages_ccc_qc_decomp_nfd(stages_ccc_qc(c));
 }
 
 uaix_always_inline
@@ -184,20 +234,7 @@ uaix_static type_codept stages_comp(type_codept c1, type_codept c2)
 uaix_always_inline
 uaix_static unsigned char stages_ccc(type_codept c)
 {
-    /* ccc_qc format: zzyydcbaxxxxxxxx (16-bit)
-     * xxxxxxxx (bit 0 - 7) - Canonical_Combining_Class (0 - 254)
-     * a (bit 8)  - NFC_Quick_Check=No || NFC_Quick_Check=Maybe (0, 1)
-     * b (bit 9)  - NFD_Quick_Check=No (0, 1)
-     * c (bit 10) - NFKC_Quick_Check=No || NFKC_Quick_Check=Maybe (0, 1)
-     * d (bit 11) - NFKD_Quick_Check=No (0, 1)
-     * yy (bit 12, 13) - Trailing non-starters in NFKD (for Stream-Safe Text Process) (0 - 3)
-     * zz (bit 14, 15) - Initial non-starters in NFKD (for Stream-Safe Text Process) (0 - 2)
-     * Note 1: there cannot be both initial and trailing only one of those
-     * Note 2: we merge Maybe and No together just because we need some space for bits
-     * for initial/trailing non-starters, we don't need Maybe in this algorithm anyway
-     */
-
-    const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+    const type_codept ccc_qc = stages_ccc_qc(c);
     return (unsigned char)(ccc_qc & 0xFF);
 }
 
@@ -227,15 +264,15 @@ uaix_static bool stages_qc_yes_ns_impl(type_codept ccc_qc, size_t* const count_n
 {
     // https://unicode.org/reports/tr15/#Stream_Safe_Text_Format
 
-    if (ccc_qc >> 14) // Initial non-starters in NFKD
+    if ((ccc_qc >> 14) & 3) // Initial non-starters in NFKD
     {
-        *count_ns += ccc_qc >> 14;
+        *count_ns += (ccc_qc >> 14) & 3;
         if (*count_ns > impl_max_norm_non_starters)
             return true;
     }
     else
     {
-        *count_ns = ccc_qc >> 12; // Trailing non-starters in NFKD
+        *count_ns = (ccc_qc >> 12) & 3; // Trailing non-starters in NFKD
     }
     return false;
 }
@@ -257,7 +294,7 @@ uaix_static bool stages_qc_yes_ns_nfc(type_codept c, size_t* const count_ns)
 
     if (c >= 0x00A0) // NFKD lower bound
     {
-        const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+        const type_codept ccc_qc = stages_ccc_qc(c);
         if (stages_qc_yes_ns_impl(ccc_qc, count_ns))
             return false;
         return stages_qc_yes_impl(ccc_qc, norm_bit_nfc);
@@ -271,7 +308,7 @@ uaix_static bool stages_qc_yes_ns_nfd(type_codept c, size_t* const count_ns)
 {
     if (c >= 0x00A0) // NFKD lower bound
     {
-        const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+        const type_codept ccc_qc = stages_ccc_qc(c);
         if (stages_qc_yes_ns_impl(ccc_qc, count_ns))
             return false;
         return stages_qc_yes_impl(ccc_qc, norm_bit_nfd);
@@ -287,7 +324,7 @@ uaix_static bool stages_qc_yes_ns_nfkc(type_codept c, size_t* const count_ns)
 {
     if (c >= 0x00A0) // NFKD lower bound
     {
-        const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+        const type_codept ccc_qc = stages_ccc_qc(c);
         if (stages_qc_yes_ns_impl(ccc_qc, count_ns))
             return false;
         return stages_qc_yes_impl(ccc_qc, norm_bit_nfkc);
@@ -301,7 +338,7 @@ uaix_static bool stages_qc_yes_ns_nfkd(type_codept c, size_t* const count_ns)
 {
     if (c >= 0x00A0) // NFKD lower bound
     {
-        const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+        const type_codept ccc_qc = stages_ccc_qc(c);
         if (stages_qc_yes_ns_impl(ccc_qc, count_ns))
             return false;
         return stages_qc_yes_impl(ccc_qc, norm_bit_nfkd);
@@ -315,14 +352,14 @@ uaix_static bool stages_qc_yes_ns_nfkd(type_codept c, size_t* const count_ns)
 uaix_always_inline
 uaix_static bool stages_qc_yes_nfc(type_codept c)
 {
-    const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+    const type_codept ccc_qc = stages_ccc_qc(c);
     return stages_qc_yes_impl(ccc_qc, norm_bit_nfc);
 }
 
 uaix_always_inline
 uaix_static bool stages_qc_yes_nfd(type_codept c)
 {
-    const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+    const type_codept ccc_qc = stages_ccc_qc(c);
     return stages_qc_yes_impl(ccc_qc, norm_bit_nfd);
 }
 
@@ -331,14 +368,14 @@ uaix_static bool stages_qc_yes_nfd(type_codept c)
 uaix_always_inline
 uaix_static bool stages_qc_yes_nfkc(type_codept c)
 {
-    const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+    const type_codept ccc_qc = stages_ccc_qc(c);
     return stages_qc_yes_impl(ccc_qc, norm_bit_nfkc);
 }
 
 uaix_always_inline
 uaix_static bool stages_qc_yes_nfkd(type_codept c)
 {
-    const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+    const type_codept ccc_qc = stages_ccc_qc(c);
     return stages_qc_yes_impl(ccc_qc, norm_bit_nfkd);
 }
 
@@ -367,7 +404,7 @@ uaix_static bool stages_qc_yes_is_nfc(type_codept c, unsigned char* const last_c
 {
     if (c >= 0x0300) // NFC lower bound
     {
-        const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+        const type_codept ccc_qc = stages_ccc_qc(c);
         if (!stages_qc_yes_is_ccc_impl(ccc_qc, last_ccc))
             return false;
         return stages_qc_yes_is_impl(ccc_qc, norm_bit_nfc);
@@ -381,7 +418,7 @@ uaix_static bool stages_qc_yes_is_nfd(type_codept c, unsigned char* const last_c
 {
     if (c >= 0x00C0) // NFD lower bound
     {
-        const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+        const type_codept ccc_qc = stages_ccc_qc(c);
         if (!stages_qc_yes_is_ccc_impl(ccc_qc, last_ccc))
             return false;
         return stages_qc_yes_is_impl(ccc_qc, norm_bit_nfd);
@@ -397,7 +434,7 @@ uaix_static bool stages_qc_yes_is_nfkc(type_codept c, unsigned char* const last_
 {
     if (c >= 0x00A0) // NFKC lower bound
     {
-        const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+        const type_codept ccc_qc = stages_ccc_qc(c);
         if (!stages_qc_yes_is_ccc_impl(ccc_qc, last_ccc))
             return false;
         return stages_qc_yes_is_impl(ccc_qc, norm_bit_nfkc);
@@ -411,7 +448,7 @@ uaix_static bool stages_qc_yes_is_nfkd(type_codept c, unsigned char* const last_
 {
     if (c >= 0x00A0) // NFKD lower bound
     {
-        const type_codept ccc_qc = stages(c, stage1_ccc_qc, stage2_ccc_qc);
+        const type_codept ccc_qc = stages_ccc_qc(c);
         if (!stages_qc_yes_is_ccc_impl(ccc_qc, last_ccc))
             return false;
         return stages_qc_yes_is_impl(ccc_qc, norm_bit_nfkd);
@@ -649,6 +686,19 @@ uaix_static void norm_decomp_count_ns(struct norm_buffer* const buffer, struct n
     }
 }
 
+uaix_always_inline
+uaix_static void norm_decomp_push(type_codept c, type_codept ccc_qc, type_codept bit,
+                                  struct norm_buffer* const buffer, struct norm_multi* const m)
+{
+    // Push a code point with already looked up ccc_qc data so it is not looked up again
+
+    buffer->cps[m->size] = c;
+    buffer->ccc[m->size] = (unsigned char)(ccc_qc & 0xFF);
+    if (stages_qc_yes_impl(ccc_qc, bit))
+        m->last_qc = m->size;
+    ++m->size;
+}
+
 uaix_always_inline
 uaix_static bool norm_decomp_nfc(type_codept c, struct norm_buffer* const buffer, struct norm_multi* const m)
 {
@@ -663,50 +713,35 @@ uaix_static bool norm_decomp_nfc(type_codept c, struct norm_buffer* const buffer
         {
             m->size = 0;
             const size_t number = stages_decomp_nfd_number(offset);
-            for (size_t i = 0; i < number; ++i, ++m->size)
+            for (size_t i = 0; i < number; ++i)
             {
-                buffer->cps[m->size] = stages_decomp_nfd_cp(offset, i);
-                buffer->ccc[m->size] = stages_ccc(buffer->cps[m->size]);
-                if (stages_qc_yes_nfc(buffer->cps[m->size]))
-                    m->last_qc = m->size;
+                const type_codept cp = stages_decomp_nfd_cp(offset, i);
+                norm_decomp_push(cp, stages_ccc_qc(cp), norm_bit_nfc, buffer, m);
             }
         }
     }
 
     // Do not decompose Hanguls like we do in norm_decomp_nfd, LV+T cases are handled in norm_comp
 
+    // CCC, Quick_Check and decomposition are all in the same data so only one lookup here
+    const type_codept ccc_qc = stages_ccc_qc(c);
+    const size_t offset = stages_ccc_qc_decomp_nfd(ccc_qc);
+
     // This additional quick check branch is almost irrelevant but in NFC/NFKC
     // in some cases we can stuck in slow loop a bit longer than needed and
     // we need the check to avoid it. This does not affect behaviour.
     // Test string: "\x005A\x0301\x0179\x0179\x0179\x0179\x0179"
-    if (stages_qc_yes_nfc(c))
+    if (offset == 0 || stages_qc_yes_impl(ccc_qc, norm_bit_nfc))
     {
-        buffer->cps[m->size] = c;
-        buffer->ccc[m->size] = stages_ccc(c);
-        m->last_qc = m->size;
-        ++m->size;
+        norm_decomp_push(c, ccc_qc, norm_bit_nfc, buffer, m);
     }
     else
     {
-        const size_t offset = stages_decomp_nfd(c);
-        if (offset == 0)
-        {
-            buffer->cps[m->size] = c;
-            buffer->ccc[m->size] = stages_ccc(c);
-            if (stages_qc_yes_nfc(c))
-                m->last_qc = m->size;
-            ++m->size;
-        }
-        else
+        const size_t number = stages_decomp_nfd_number(offset);
+        for (size_t i = 0; i < number; ++i)
         {
-            const size_t number = stages_decomp_nfd_number(offset);
-            for (size_t i = 0; i < number; ++i, ++m->size)
-            {
-                buffer->cps[m->size] = stages_decomp_nfd_cp(offset, i);
-                buffer->ccc[m->size] = stages_ccc(buffer->cps[m->size]);
-                if (stages_qc_yes_nfc(buffer->cps[m->size]))
-                    m->last_qc = m->size;
-            }
+            const type_codept cp = stages_decomp_nfd_cp(offset, i);
+            norm_decomp_push(cp, stages_ccc_qc(cp), norm_bit_nfc, buffer, m);
         }
     }
 
@@ -728,24 +763,19 @@ uaix_static bool norm_decomp_nfd(type_codept c, struct norm_buffer* const buffer
     }
     else
     {
-        const size_t offset = stages_decomp_nfd(c);
+        const type_codept ccc_qc = stages_ccc_qc(c);
+        const size_t offset = stages_ccc_qc_decomp_nfd(ccc_qc);
         if (offset == 0)
         {
-            buffer->cps[m->size] = c;
-            buffer->ccc[m->size] = stages_ccc(c);
-            if (stages_qc_yes_nfd(c))
-                m->last_qc = m->size;
-            ++m->size;
+            norm_decomp_push(c, ccc_qc, norm_bit_nfd, buffer, m);
         }
         else
         {
             const size_t number = stages_decomp_nfd_number(offset);
-            for (size_t i = 0; i < number; ++i, ++m->size)
+            for (size_t i = 0; i < number; ++i)
             {
-                buffer->cps[m->size] = stages_decomp_nfd_cp(offset, i);
-                buffer->ccc[m->size] = stages_ccc(buffer->cps[m->size]);
-                if (stages_qc_yes_nfd(buffer->cps[m->size]))
-                    m->last_qc = m->size;
+                const type_codept cp = stages_decomp_nfd_cp(offset, i);
+                norm_decomp_push(cp, stages_ccc_qc(cp), norm_bit_nfd, buffer, m);
             }
         }
     }
@@ -865,17 +895,12 @@ uaix_static bool norm_decomp_unaccent(type_codept c, struct norm_buffer* const b
 
     norm_decomp_count_ns(buffer, m);
 
-    const size_t offset = stages_decomp_nfd(c);
+    const type_codept ccc_qc = stages_ccc_qc(c);
+    const size_t offset = stages_ccc_qc_decomp_nfd(ccc_qc);
     if (offset == 0)
     {
         if (impl_prop_get_gc_prop(impl_prop_get_prop(c)) != impl_General_Category_Mn)
-        {
-            buffer->cps[m->size] = c;
-            buffer->ccc[m->size] = stages_ccc(c);
-            if (stages_qc_yes_nfd(c))
-                m->last_qc = m->size;
-            ++m->size;
-        }
+            norm_decomp_push(c, ccc_qc, norm_bit_nfd, buffer, m);
     }
     else
     {
@@ -884,20 +909,279 @@ uaix_static bool norm_decomp_unaccent(type_codept c, struct norm_buffer* const b
         {
             const type_codept cp = stages_decomp_nfd_cp(offset, i);
             if (impl_prop_get_gc_prop(impl_prop_get_prop(cp)) != impl_General_Category_Mn)
+                norm_decomp_push(cp, stages_ccc_qc(cp), norm_bit_nfd, buffer, m);
+        }
+    }
+
+    return norm_decomp_return(buffer, m);
+}
+
+#endif // UNI_ALGO_DISABLE_PROP
+
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_CASE
+
+uaix_always_inline
+uaix_static bool norm_casefold_ignorable(type_codept c)
+{
+    // Default_Ignorable_Code_Point from DerivedCoreProperties.txt
+    // NFKC_Casefold maps all of them to nothing so do not generate a table for such small number of ranges
+    // tag_unicode_unstable_value
+
+    if (c < 0x00AD)
+        return false;
+    if (c <= 0xFFFF)
+    {
+        return c == 0x00AD || c == 0x034F || c == 0x061C ||
+               (c >= 0x115F && c <= 0x1160) || (c >= 0x17B4 && c <= 0x17B5) ||
+               (c >= 0x180B && c <= 0x180F) || (c >= 0x200B && c <= 0x200F) ||
+               (c >= 0x202A && c <= 0x202E) || (c >= 0x2060 && c <= 0x206F) ||
+               c == 0x3164 || (c >= 0xFE00 && c <= 0xFE0F) || c == 0xFEFF ||
+               c == 0xFFA0 || (c >= 0xFFF0 && c <= 0xFFF8);
+    }
+    return (c >= 0x1BCA0 && c <= 0x1BCA3) || (c >= 0x1D173 && c <= 0x1D17A) ||
+           (c >= 0xE0000 && c <= 0xE0FFF);
+}
+
+uaix_always_inline
+uaix_static bool norm_casefold_qc_yes_ns(type_codept c, type_codept* const fold, size_t* const count_ns)
+{
+    // Fold the code point and check the result with NFKC Quick_Check
+    // Code points with full case folding are always checked with the slow path
+
+#ifndef UNI_ALGO_DISABLE_FULL_CASE
+    if (stages_special_fold_check(c))
+    {
+        stages_qc_yes_ns_nfkc(c, count_ns);
+        return false;
+    }
+#endif
+
+    *fold = stages_fold(c);
+    return stages_qc_yes_ns_nfkc(*fold, count_ns) && !norm_casefold_ignorable(*fold);
+}
+
+uaix_always_inline
+uaix_static void norm_casefold_push(type_codept c, struct norm_buffer* const buffer, struct norm_multi* const m)
+{
+    // Fold the code point that is already decomposed to NFKD and put it to the buffer
+    // Case folding of a decomposed code point never needs to be decomposed again
+
+    if (norm_casefold_ignorable(c))
+        return;
+
+#ifndef UNI_ALGO_DISABLE_FULL_CASE
+    if (stages_special_fold_check(c))
+    {
+        struct case_special_buffer special = {{0}}; // tag_can_be_uninitialized
+        const size_t number = stages_special_fold(c, &special);
+        for (size_t i = 0; i < number; ++i, ++m->size)
+        {
+            buffer->cps[m->size] = special.cps[i];
+            buffer->ccc[m->size] = stages_ccc(special.cps[i]);
+            if (stages_qc_yes_nfkc(special.cps[i]))
+                m->last_qc = m->size;
+        }
+        return;
+    }
+#endif
+
+    const type_codept fold = stages_fold(c);
+    buffer->cps[m->size] = fold;
+    buffer->ccc[m->size] = stages_ccc(fold);
+    if (stages_qc_yes_nfkc(fold))
+        m->last_qc = m->size;
+    ++m->size;
+}
+
+uaix_always_inline
+uaix_static bool norm_decomp_nfkc_casefold(type_codept c, struct norm_buffer* const buffer, struct norm_multi* const m)
+{
+    // The same as norm_decomp_nfkc but folds every decomposed code point
+    // and skips Default_Ignorable_Code_Point
+    // The full algorithm is: NFKD -> Case_Folding -> remove Default_Ignorable_Code_Point -> NFKC
+    // It is the same as toNFKC_Casefold from Unicode Standard Chapter 3.13
+
+    norm_decomp_count_ns(buffer, m);
+
+    // The first code point is already folded in fast loop
+    if (m->size == 1)
+    {
+        const size_t offset = stages_decomp_nfkd(buffer->cps[0]);
+        if (offset)
+        {
+            m->size = 0;
+            const size_t number = stages_decomp_nfkd_number(offset);
+            for (size_t i = 0; i < number; ++i)
+                norm_casefold_push(stages_decomp_nfkd_cp(offset, i), buffer, m);
+        }
+    }
+
+    const size_t offset = stages_decomp_nfkd(c);
+    if (offset == 0)
+        norm_casefold_push(c, buffer, m);
+    else
+    {
+        const size_t number = stages_decomp_nfkd_number(offset);
+        for (size_t i = 0; i < number; ++i)
+            norm_casefold_push(stages_decomp_nfkd_cp(offset, i), buffer, m);
+    }
+
+    return norm_decomp_return(buffer, m);
+}
+
+#endif // UNI_ALGO_DISABLE_CASE
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+#ifndef UNI_ALGO_DISABLE_CASE
+#ifndef UNI_ALGO_DISABLE_PROP
+
+uaix_always_inline
+uaix_static bool norm_key_is_mark(type_codept c, int mode)
+{
+    // Nonspacing Mark starts from U+0300 so avoid the lookup in properties for lower code points
+    return (mode & impl_norm_search_key_unaccent) && c >= 0x0300 &&
+           impl_prop_get_gc_prop(impl_prop_get_prop(c)) == impl_General_Category_Mn;
+}
+
+uaix_always_inline
+uaix_static bool norm_key_qc_yes_ns(type_codept c, type_codept* const fold, size_t* const count_ns, int mode)
+{
+    // Fold the code point and check the result with Quick_Check of the final form,
+    // when unaccent the code point also must not decompose so accents cannot hide in it
+    // and must not be Nonspacing Mark itself, it is checked before folding because U+0345 folds to a letter
+    // Code points with full case folding are always checked with the slow path
+
+    bool special = false;
+    *fold = c;
+    if (mode & impl_norm_search_key_casefold)
+    {
+#ifndef UNI_ALGO_DISABLE_FULL_CASE
+        special = stages_special_fold_check(c);
+        if (!special)
+#endif
+            *fold = stages_fold(c);
+    }
+
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+    if (mode & impl_norm_search_key_compat)
+    {
+        if (!stages_qc_yes_ns_nfkc(*fold, count_ns) || special)
+            return false;
+        if ((mode & impl_norm_search_key_unaccent) && !stages_qc_yes_nfkd(c))
+            return false;
+        return !norm_key_is_mark(c, mode);
+    }
+#endif
+
+    if (!stages_qc_yes_ns_nfc(*fold, count_ns) || special)
+        return false;
+    if ((mode & impl_norm_search_key_unaccent) && !stages_qc_yes_nfd(c))
+        return false;
+    return !norm_key_is_mark(c, mode);
+}
+
+uaix_always_inline
+uaix_static bool norm_key_qc_yes(type_codept c, int mode)
+{
+    if (mode & impl_norm_search_key_compat)
+    {
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+        return stages_qc_yes_nfkc(c);
+#endif
+    }
+    return stages_qc_yes_nfc(c);
+}
+
+uaix_always_inline
+uaix_static void norm_key_push(type_codept c, struct norm_buffer* const buffer, struct norm_multi* const m, int mode)
+{
+    // Put the code point that is already decomposed to the buffer, skip it if it is Nonspacing Mark
+    // and fold it if needed, case folding of a decomposed code point never needs to be decomposed again
+
+    if (norm_key_is_mark(c, mode))
+        return;
+
+    if (mode & impl_norm_search_key_casefold)
+    {
+#ifndef UNI_ALGO_DISABLE_FULL_CASE
+        if (stages_special_fold_check(c))
+        {
+            struct case_special_buffer special = {{0}}; // tag_can_be_uninitialized
+            const size_t number = stages_special_fold(c, &special);
+            for (size_t i = 0; i < number; ++i, ++m->size)
             {
-                buffer->cps[m->size] = cp;
-                buffer->ccc[m->size] = stages_ccc(cp);
-                if (stages_qc_yes_nfd(cp))
+                buffer->cps[m->size] = special.cps[i];
+                buffer->ccc[m->size] = stages_ccc(special.cps[i]);
+                if (norm_key_qc_yes(special.cps[i], mode))
                     m->last_qc = m->size;
-                ++m->size;
             }
+            return;
+        }
+#endif
+        c = stages_fold(c);
+    }
+
+    buffer->cps[m->size] = c;
+    buffer->ccc[m->size] = stages_ccc(c);
+    if (norm_key_qc_yes(c, mode))
+        m->last_qc = m->size;
+    ++m->size;
+}
+
+uaix_always_inline
+uaix_static void norm_key_decomp(type_codept c, struct norm_buffer* const buffer, struct norm_multi* const m, int mode)
+{
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+    if (mode & impl_norm_search_key_compat)
+    {
+        const size_t offset = stages_decomp_nfkd(c);
+        if (offset == 0)
+            norm_key_push(c, buffer, m, mode);
+        else
+        {
+            const size_t number = stages_decomp_nfkd_number(offset);
+            for (size_t i = 0; i < number; ++i)
+                norm_key_push(stages_decomp_nfkd_cp(offset, i), buffer, m, mode);
         }
+        return;
+    }
+#endif
+
+    const size_t offset = stages_decomp_nfd(c);
+    if (offset == 0)
+        norm_key_push(c, buffer, m, mode);
+    else
+    {
+        const size_t number = stages_decomp_nfd_number(offset);
+        for (size_t i = 0; i < number; ++i)
+            norm_key_push(stages_decomp_nfd_cp(offset, i), buffer, m, mode);
+    }
+}
+
+uaix_always_inline
+uaix_static bool norm_decomp_search_key(type_codept c, struct norm_buffer* const buffer, struct norm_multi* const m, int mode)
+{
+    // The same as norm_decomp_nfc/norm_decomp_nfkc but the mode decides what to do with decomposed code points
+    // The full algorithm is: NFD/NFKD -> remove Nonspacing Mark -> Case_Folding -> NFC/NFKC
+
+    norm_decomp_count_ns(buffer, m);
+
+    // The first code point is already folded in fast loop
+    if (m->size == 1)
+    {
+        const type_codept first = buffer->cps[0];
+        m->size = 0;
+        norm_key_decomp(first, buffer, m, mode);
     }
 
+    norm_key_decomp(c, buffer, m, mode);
+
     return norm_decomp_return(buffer, m);
 }
 
 #endif // UNI_ALGO_DISABLE_PROP
+#endif // UNI_ALGO_DISABLE_CASE
 
 uaix_always_inline
 uaix_static void norm_proc_buffer(struct norm_buffer* const buffer, struct norm_multi* const m)
@@ -934,6 +1218,7 @@ uaix_static size_t impl_norm_to_nfc_utf8(it_in_utf8 first, it_end_utf8 last, it_
      * Note that we always need to read 1 code point ahead in the algorithm that supports streams
      * so our fast loop is not that fast, probably it can be optimized a bit more but it's fine. Anyway
      * it's impossible to achieve the same speed of the fast loop as in an algorithm that doesn't support streams.
+     * The only exception is a run of ASCII, it is skipped in the block skip loop inside the fast loop.
      * ifs are written like that to avoid unnecessary jumps so it gives the best performance.
      * __builtin_expect is used because it achieves a better performance in GCC.
      * Other normalization functions are based on this function.
@@ -956,6 +1241,17 @@ uaix_static size_t impl_norm_to_nfc_utf8(it_in_utf8 first, it_end_utf8 last, it_
                     buffer.cps[0] = c;
                     buffer.ccc[0] = 0;
                     m.size = 1;
+                    // Block skip: ASCII has Quick_Check=Yes and no non-starters in all normalization forms
+                    // so a run of ASCII is copied as is without decoding and table lookups, only the last
+                    // code point of the run stays in the buffer because it can be composed with the next one.
+                    // Note that it is not everything below U+0300 because of NFKD lower bound, see stages_qc_yes_ns_nfc.
+                    while (src != last && (*src & 0xFF) <= 0x7F)
+                    {
+                        dst = codepoint_to_utf8(buffer.cps[0], dst);
+                        buffer.cps[0] = (type_codept)(*src & 0xFF);
+                        m.count_ns = 0;
+                        ++src;
+                    }
                     continue; // Fast loop ends here
                 }
             }
@@ -1014,6 +1310,13 @@ uaix_static size_t impl_norm_to_nfd_utf8(it_in_utf8 first, it_end_utf8 last, it_
                     buffer.cps[0] = c;
                     buffer.ccc[0] = 0;
                     m.size = 1;
+                    while (src != last && (*src & 0xFF) <= 0x7F)
+                    {
+                        dst = codepoint_to_utf8(buffer.cps[0], dst);
+                        buffer.cps[0] = (type_codept)(*src & 0xFF);
+                        m.count_ns = 0;
+                        ++src;
+                    }
                     continue;
                 }
             }
@@ -1070,6 +1373,13 @@ uaix_static size_t impl_norm_to_nfkc_utf8(it_in_utf8 first, it_end_utf8 last, it
                     buffer.cps[0] = c;
                     buffer.ccc[0] = 0;
                     m.size = 1;
+                    while (src != last && (*src & 0xFF) <= 0x7F)
+                    {
+                        dst = codepoint_to_utf8(buffer.cps[0], dst);
+                        buffer.cps[0] = (type_codept)(*src & 0xFF);
+                        m.count_ns = 0;
+                        ++src;
+                    }
                     continue;
                 }
             }
@@ -1128,6 +1438,13 @@ uaix_static size_t impl_norm_to_nfkd_utf8(it_in_utf8 first, it_end_utf8 last, it
                     buffer.cps[0] = c;
                     buffer.ccc[0] = 0;
                     m.size = 1;
+                    while (src != last && (*src & 0xFF) <= 0x7F)
+                    {
+                        dst = codepoint_to_utf8(buffer.cps[0], dst);
+                        buffer.cps[0] = (type_codept)(*src & 0xFF);
+                        m.count_ns = 0;
+                        ++src;
+                    }
                     continue;
                 }
             }
@@ -1186,6 +1503,13 @@ uaix_static size_t impl_norm_to_unaccent_utf8(it_in_utf8 first, it_end_utf8 last
                     buffer.cps[0] = c;
                     buffer.ccc[0] = 0;
                     m.size = 1;
+                    while (src != last && (*src & 0xFF) <= 0x7F)
+                    {
+                        dst = codepoint_to_utf8(buffer.cps[0], dst);
+                        buffer.cps[0] = (type_codept)(*src & 0xFF);
+                        m.count_ns = 0;
+                        ++src;
+                    }
                     continue;
                 }
             }
@@ -1214,20 +1538,170 @@ uaix_static size_t impl_norm_to_unaccent_utf8(it_in_utf8 first, it_end_utf8 last
 
 #endif // UNI_ALGO_DISABLE_PROP
 
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_CASE
+
 #ifdef __cplusplus
-template<typename it_in_utf8, typename it_end_utf8>
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
 #endif
-uaix_static int impl_norm_is_nfc_utf8(it_in_utf8 first, it_end_utf8 last)
+uaix_static size_t impl_norm_to_nfkc_casefold_utf8(it_in_utf8 first, it_end_utf8 last, it_out_utf8 result)
 {
+    // The same as impl_norm_to_nfkc_utf8 but folds the code points in the same pass
+
     it_in_utf8 src = first;
+    it_out_utf8 dst = result;
 
     type_codept c = 0; // tag_can_be_uninitialized
-    unsigned char last_ccc = 0; // tag_must_be_initialized
+    type_codept f = 0; // tag_can_be_uninitialized
 
-    while (src != last)
+    struct norm_buffer buffer = {{0}, {0}}; // tag_can_be_uninitialized
+    struct norm_multi m = {0, 0, 0}; // tag_must_be_initialized
+
+    do
     {
-        src = iter_utf8(src, last, &c, iter_error);
-        if (c == iter_error)
+        while (src != last)
+        {
+            src = iter_utf8(src, last, &c, iter_replacement);
+            if (uaix_likely(norm_casefold_qc_yes_ns(c, &f, &m.count_ns)))
+            {
+                if (uaix_likely(m.size == 1))
+                {
+                    dst = codepoint_to_utf8(buffer.cps[0], dst);
+                    m.size = 0;
+                }
+                if (uaix_likely(m.size == 0))
+                {
+                    buffer.cps[0] = f;
+                    buffer.ccc[0] = 0;
+                    m.size = 1;
+                    while (src != last && (*src & 0xFF) <= 0x7F)
+                    {
+                        dst = codepoint_to_utf8(buffer.cps[0], dst);
+                        buffer.cps[0] = (type_codept)(*src & 0xFF);
+                        if (buffer.cps[0] >= 0x0041 && buffer.cps[0] <= 0x005A)
+                            buffer.cps[0] += 0x0020;
+                        m.count_ns = 0;
+                        ++src;
+                    }
+                    continue;
+                }
+            }
+            if (norm_decomp_nfkc_casefold(c, &buffer, &m))
+                break;
+        }
+
+        if (m.last_qc == 0)
+            m.last_qc = m.size;
+
+        norm_order(&buffer, m.last_qc);
+        norm_comp(&buffer, m.last_qc);
+
+        for (size_t i = 0; i < m.last_qc; ++i)
+        {
+            if (buffer.ccc[i] != 255)
+                dst = codepoint_to_utf8(buffer.cps[i], dst);
+        }
+
+        norm_proc_buffer(&buffer, &m);
+    }
+    while (m.size > 0);
+
+    return (size_t)(dst - result);
+}
+
+#endif // UNI_ALGO_DISABLE_CASE
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+#ifndef UNI_ALGO_DISABLE_CASE
+#ifndef UNI_ALGO_DISABLE_PROP
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8, typename it_out_utf8>
+#endif
+uaix_static size_t impl_norm_to_search_key_utf8(it_in_utf8 first, it_end_utf8 last, it_out_utf8 result, int mode)
+{
+    // The same as impl_norm_to_nfc_utf8 but unaccents and folds the code points in the same pass
+
+    it_in_utf8 src = first;
+    it_out_utf8 dst = result;
+
+    type_codept c = 0; // tag_can_be_uninitialized
+    type_codept f = 0; // tag_can_be_uninitialized
+
+    struct norm_buffer buffer = {{0}, {0}}; // tag_can_be_uninitialized
+    struct norm_multi m = {0, 0, 0}; // tag_must_be_initialized
+
+    const type_codept lower = (mode & impl_norm_search_key_casefold) ? 0x0020 : 0;
+
+    do
+    {
+        while (src != last)
+        {
+            src = iter_utf8(src, last, &c, iter_replacement);
+            if (uaix_likely(norm_key_qc_yes_ns(c, &f, &m.count_ns, mode)))
+            {
+                if (uaix_likely(m.size == 1))
+                {
+                    dst = codepoint_to_utf8(buffer.cps[0], dst);
+                    m.size = 0;
+                }
+                if (uaix_likely(m.size == 0))
+                {
+                    buffer.cps[0] = f;
+                    buffer.ccc[0] = 0;
+                    m.size = 1;
+                    while (src != last && (*src & 0xFF) <= 0x7F)
+                    {
+                        dst = codepoint_to_utf8(buffer.cps[0], dst);
+                        buffer.cps[0] = (type_codept)(*src & 0xFF);
+                        if (buffer.cps[0] >= 0x0041 && buffer.cps[0] <= 0x005A)
+                            buffer.cps[0] += lower;
+                        m.count_ns = 0;
+                        ++src;
+                    }
+                    continue;
+                }
+            }
+            if (norm_decomp_search_key(c, &buffer, &m, mode))
+                break;
+        }
+
+        if (m.last_qc == 0)
+            m.last_qc = m.size;
+
+        norm_order(&buffer, m.last_qc);
+        norm_comp(&buffer, m.last_qc);
+
+        for (size_t i = 0; i < m.last_qc; ++i)
+        {
+            if (buffer.ccc[i] != 255)
+                dst = codepoint_to_utf8(buffer.cps[i], dst);
+        }
+
+        norm_proc_buffer(&buffer, &m);
+    }
+    while (m.size > 0);
+
+    return (size_t)(dst - result);
+}
+
+#endif // UNI_ALGO_DISABLE_PROP
+#endif // UNI_ALGO_DISABLE_CASE
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_static int impl_norm_is_nfc_utf8(it_in_utf8 first, it_end_utf8 last)
+{
+    it_in_utf8 src = first;
+
+    type_codept c = 0; // tag_can_be_uninitialized
+    unsigned char last_ccc = 0; // tag_must_be_initialized
+
+    while (src != last)
+    {
+        src = iter_utf8(src, last, &c, iter_error);
+        if (c == iter_error)
             return impl_norm_is_ill_formed;
         if (!stages_qc_yes_is_nfc(c, &last_ccc))
             return norm_is_no_or_maybe;
@@ -1335,6 +1809,14 @@ uaix_static size_t impl_norm_to_nfc_utf16(it_in_utf16 first, it_end_utf16 last,
                     buffer.cps[0] = c;
                     buffer.ccc[0] = 0;
                     m.size = 1;
+                    // Block skip: the same as in impl_norm_to_nfc_utf8 but everything below NFKD lower bound
+                    while (src != last && (*src & 0xFFFF) < 0x00A0)
+                    {
+                        dst = codepoint_to_utf16(buffer.cps[0], dst);
+                        buffer.cps[0] = (type_codept)(*src & 0xFFFF);
+                        m.count_ns = 0;
+                        ++src;
+                    }
                     continue; // Fast loop ends here
                 }
             }
@@ -1391,6 +1873,13 @@ uaix_static size_t impl_norm_to_nfd_utf16(it_in_utf16 first, it_end_utf16 last,
                     buffer.cps[0] = c;
                     buffer.ccc[0] = 0;
                     m.size = 1;
+                    while (src != last && (*src & 0xFFFF) < 0x00A0)
+                    {
+                        dst = codepoint_to_utf16(buffer.cps[0], dst);
+                        buffer.cps[0] = (type_codept)(*src & 0xFFFF);
+                        m.count_ns = 0;
+                        ++src;
+                    }
                     continue;
                 }
             }
@@ -1445,6 +1934,13 @@ uaix_static size_t impl_norm_to_nfkc_utf16(it_in_utf16 first, it_end_utf16 last,
                     buffer.cps[0] = c;
                     buffer.ccc[0] = 0;
                     m.size = 1;
+                    while (src != last && (*src & 0xFFFF) < 0x00A0)
+                    {
+                        dst = codepoint_to_utf16(buffer.cps[0], dst);
+                        buffer.cps[0] = (type_codept)(*src & 0xFFFF);
+                        m.count_ns = 0;
+                        ++src;
+                    }
                     continue;
                 }
             }
@@ -1501,6 +1997,13 @@ uaix_static size_t impl_norm_to_nfkd_utf16(it_in_utf16 first, it_end_utf16 last,
                     buffer.cps[0] = c;
                     buffer.ccc[0] = 0;
                     m.size = 1;
+                    while (src != last && (*src & 0xFFFF) < 0x00A0)
+                    {
+                        dst = codepoint_to_utf16(buffer.cps[0], dst);
+                        buffer.cps[0] = (type_codept)(*src & 0xFFFF);
+                        m.count_ns = 0;
+                        ++src;
+                    }
                     continue;
                 }
             }
@@ -1557,6 +2060,13 @@ uaix_static size_t impl_norm_to_unaccent_utf16(it_in_utf16 first, it_end_utf16 l
                     buffer.cps[0] = c;
                     buffer.ccc[0] = 0;
                     m.size = 1;
+                    while (src != last && (*src & 0xFFFF) < 0x00A0)
+                    {
+                        dst = codepoint_to_utf16(buffer.cps[0], dst);
+                        buffer.cps[0] = (type_codept)(*src & 0xFFFF);
+                        m.count_ns = 0;
+                        ++src;
+                    }
                     continue;
                 }
             }
@@ -1585,6 +2095,156 @@ uaix_static size_t impl_norm_to_unaccent_utf16(it_in_utf16 first, it_end_utf16 l
 
 #endif // UNI_ALGO_DISABLE_PROP
 
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_CASE
+
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16, typename it_out_utf16>
+#endif
+uaix_static size_t impl_norm_to_nfkc_casefold_utf16(it_in_utf16 first, it_end_utf16 last, it_out_utf16 result)
+{
+    // The same as impl_norm_to_nfkc_utf16 but folds the code points in the same pass
+
+    it_in_utf16 src = first;
+    it_out_utf16 dst = result;
+
+    type_codept c = 0; // tag_can_be_uninitialized
+    type_codept f = 0; // tag_can_be_uninitialized
+
+    struct norm_buffer buffer = {{0}, {0}}; // tag_can_be_uninitialized
+    struct norm_multi m = {0, 0, 0}; // tag_must_be_initialized
+
+    do
+    {
+        while (src != last)
+        {
+            src = iter_utf16(src, last, &c, iter_replacement);
+            if (uaix_likely(norm_casefold_qc_yes_ns(c, &f, &m.count_ns)))
+            {
+                if (uaix_likely(m.size == 1))
+                {
+                    dst = codepoint_to_utf16(buffer.cps[0], dst);
+                    m.size = 0;
+                }
+                if (uaix_likely(m.size == 0))
+                {
+                    buffer.cps[0] = f;
+                    buffer.ccc[0] = 0;
+                    m.size = 1;
+                    while (src != last && (*src & 0xFFFF) < 0x00A0)
+                    {
+                        dst = codepoint_to_utf16(buffer.cps[0], dst);
+                        buffer.cps[0] = (type_codept)(*src & 0xFFFF);
+                        if (buffer.cps[0] >= 0x0041 && buffer.cps[0] <= 0x005A)
+                            buffer.cps[0] += 0x0020;
+                        m.count_ns = 0;
+                        ++src;
+                    }
+                    continue;
+                }
+            }
+            if (norm_decomp_nfkc_casefold(c, &buffer, &m))
+                break;
+        }
+
+        if (m.last_qc == 0)
+            m.last_qc = m.size;
+
+        norm_order(&buffer, m.last_qc);
+        norm_comp(&buffer, m.last_qc);
+
+        for (size_t i = 0; i < m.last_qc; ++i)
+        {
+            if (buffer.ccc[i] != 255)
+                dst = codepoint_to_utf16(buffer.cps[i], dst);
+        }
+
+        norm_proc_buffer(&buffer, &m);
+    }
+    while (m.size > 0);
+
+    return (size_t)(dst - result);
+}
+
+#endif // UNI_ALGO_DISABLE_CASE
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+#ifndef UNI_ALGO_DISABLE_CASE
+#ifndef UNI_ALGO_DISABLE_PROP
+
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16, typename it_out_utf16>
+#endif
+uaix_static size_t impl_norm_to_search_key_utf16(it_in_utf16 first, it_end_utf16 last, it_out_utf16 result, int mode)
+{
+    // The same as impl_norm_to_nfc_utf16 but unaccents and folds the code points in the same pass
+
+    it_in_utf16 src = first;
+    it_out_utf16 dst = result;
+
+    type_codept c = 0; // tag_can_be_uninitialized
+    type_codept f = 0; // tag_can_be_uninitialized
+
+    struct norm_buffer buffer = {{0}, {0}}; // tag_can_be_uninitialized
+    struct norm_multi m = {0, 0, 0}; // tag_must_be_initialized
+
+    const type_codept lower = (mode & impl_norm_search_key_casefold) ? 0x0020 : 0;
+
+    do
+    {
+        while (src != last)
+        {
+            src = iter_utf16(src, last, &c, iter_replacement);
+            if (uaix_likely(norm_key_qc_yes_ns(c, &f, &m.count_ns, mode)))
+            {
+                if (uaix_likely(m.size == 1))
+                {
+                    dst = codepoint_to_utf16(buffer.cps[0], dst);
+                    m.size = 0;
+                }
+                if (uaix_likely(m.size == 0))
+                {
+                    buffer.cps[0] = f;
+                    buffer.ccc[0] = 0;
+                    m.size = 1;
+                    while (src != last && (*src & 0xFFFF) < 0x00A0)
+                    {
+                        dst = codepoint_to_utf16(buffer.cps[0], dst);
+                        buffer.cps[0] = (type_codept)(*src & 0xFFFF);
+                        if (buffer.cps[0] >= 0x0041 && buffer.cps[0] <= 0x005A)
+                            buffer.cps[0] += lower;
+                        m.count_ns = 0;
+                        ++src;
+                    }
+                    continue;
+                }
+            }
+            if (norm_decomp_search_key(c, &buffer, &m, mode))
+                break;
+        }
+
+        if (m.last_qc == 0)
+            m.last_qc = m.size;
+
+        norm_order(&buffer, m.last_qc);
+        norm_comp(&buffer, m.last_qc);
+
+        for (size_t i = 0; i < m.last_qc; ++i)
+        {
+            if (buffer.ccc[i] != 255)
+                dst = codepoint_to_utf16(buffer.cps[i], dst);
+        }
+
+        norm_proc_buffer(&buffer, &m);
+    }
+    while (m.size > 0);
+
+    return (size_t)(dst - result);
+}
+
+#endif // UNI_ALGO_DISABLE_PROP
+#endif // UNI_ALGO_DISABLE_CASE
+
 #ifdef __cplusplus
 template<typename it_in_utf16, typename it_end_utf16>
 #endif
@@ -1887,6 +2547,398 @@ uaix_static bool inline_norm_iter_next_decomp(struct impl_norm_iter_state* const
     return true;
 }
 
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_static bool norm_nfd_next_utf8(it_in_utf8* const src, it_end_utf8 last,
+                                      struct impl_norm_iter_state* const s, type_codept* const codepoint)
+{
+    // The same as NFD normalization iterator: fill the buffer until it is ready and get the next code point
+
+    type_codept c = 0; // tag_can_be_uninitialized
+
+    if (!inline_norm_iter_ready(s))
+    {
+        while (*src != last)
+        {
+            *src = iter_utf8(*src, last, &c, iter_replacement);
+            if (inline_norm_iter_nfd(s, c))
+                break;
+        }
+    }
+    return inline_norm_iter_next_decomp(s, codepoint);
+}
+
+// Compares strings as if both of them are normalized to NFD, result in code point order
+// Code points are compared as soon as they are ready so the function stops at the first difference
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_static int impl_norm_compare_nfd_utf8(it_in_utf8 first1, it_end_utf8 last1,
+                                            it_in_utf8 first2, it_end_utf8 last2)
+{
+    it_in_utf8 src1 = first1;
+    it_in_utf8 src2 = first2;
+    it_in_utf8 bound1 = first1;
+    it_in_utf8 bound2 = first2;
+    type_codept c1 = 0; // tag_can_be_uninitialized
+    type_codept c2 = 0; // tag_can_be_uninitialized
+
+    // Optimization for long mostly equal strings: skip the equal code units
+    // and remember the last boundary before the difference, ASCII is always the start of a code point and Quick_Check=Yes starter
+    while (src1 != last1 && src2 != last2 && *src1 == *src2)
+    {
+        if ((*src1 & 0xFF) <= 0x7F)
+        {
+            bound1 = src1;
+            bound2 = src2;
+        }
+        ++src1;
+        ++src2;
+    }
+
+    if (src1 == last1 && src2 == last2)
+        return 0;
+
+    src1 = bound1;
+    src2 = bound2;
+
+    struct impl_norm_iter_state s1 = {0, {0, 0, 0}, {{0}, {0}}}; // tag_must_be_initialized
+    struct impl_norm_iter_state s2 = {0, {0, 0, 0}, {{0}, {0}}}; // tag_must_be_initialized
+
+    bool next1 = norm_nfd_next_utf8(&src1, last1, &s1, &c1);
+    bool next2 = norm_nfd_next_utf8(&src2, last2, &s2, &c2);
+
+    while (next1 && next2)
+    {
+        if (c1 != c2)
+            return (c1 < c2) ? -1 : 1;
+
+        next1 = norm_nfd_next_utf8(&src1, last1, &s1, &c1);
+        next2 = norm_nfd_next_utf8(&src2, last2, &s2, &c2);
+    }
+
+    return next1 - next2;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_static bool norm_search_next_utf8(it_in_utf8* const src, it_end_utf8 last,
+                                       struct impl_norm_iter_state* const s, type_codept* const codepoint, it_in_utf8* const bound)
+{
+    // The same as norm_nfd_next_utf8 but also remembers where the ready buffer ends in the source,
+    // the buffer is ready before the code point that starts the next buffer or at the end of the data
+
+    type_codept c = 0; // tag_can_be_uninitialized
+
+    if (!inline_norm_iter_ready(s))
+    {
+        while (*src != last)
+        {
+            *bound = *src;
+            *src = iter_utf8(*src, last, &c, iter_replacement);
+            if (inline_norm_iter_nfd(s, c))
+                return inline_norm_iter_next_decomp(s, codepoint);
+        }
+        *bound = *src;
+    }
+    return inline_norm_iter_next_decomp(s, codepoint);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_static bool norm_search_match_utf8(it_in_utf8 first1, it_end_utf8 last1,
+                                        it_in_utf8 first2, it_end_utf8 last2,
+                                        struct impl_norm_iter_state* const s, it_in_utf8* const end)
+{
+    // Match the needle from the start of a buffer, the needle must end together with a buffer
+
+    it_in_utf8 src1 = first1;
+    it_in_utf8 src2 = first2;
+    type_codept c1 = 0; // tag_can_be_uninitialized
+    type_codept c2 = 0; // tag_can_be_uninitialized
+
+    impl_norm_iter_state_reset(s);
+
+    while (norm_search_next_utf8(&src1, last1, s, &c1, end))
+    {
+        src2 = iter_utf8(src2, last2, &c2, iter_replacement);
+        if (c1 != c2)
+            return false;
+        if (src2 == last2)
+            return s->pos == 0;
+    }
+    return false;
+}
+
+// Searches for the needle that must be already normalized to NFD in the haystack normalized to NFD on the fly
+// A match always starts and ends on the boundaries of the normalization buffers so it never splits
+// a base and its combining marks or a Hangul syllable, pos and end are positions in the original haystack
+#ifdef __cplusplus
+template<typename it_in_utf8, typename it_end_utf8>
+#endif
+uaix_static bool impl_norm_search_nfd_utf8(it_in_utf8 first1, it_end_utf8 last1,
+                                           it_in_utf8 first2, it_end_utf8 last2,
+                                           size_t* const pos, size_t* const end)
+{
+    it_in_utf8 src = first1;
+    it_in_utf8 bound = first1;
+    it_in_utf8 start = first1;
+    it_in_utf8 found = first1;
+    type_codept c = 0; // tag_can_be_uninitialized
+    type_codept first = 0; // tag_can_be_uninitialized
+    bool begin = true; // tag_must_be_initialized
+    struct impl_norm_iter_state s = {0, {0, 0, 0}, {{0}, {0}}}; // tag_can_be_uninitialized
+    struct impl_norm_iter_state m = {0, {0, 0, 0}, {{0}, {0}}}; // tag_can_be_uninitialized
+
+    if (first2 == last2)
+    {
+        *pos = 0;
+        *end = 0;
+        return true;
+    }
+
+    iter_utf8(first2, last2, &first, iter_replacement);
+
+    while (start != last1)
+    {
+        // Fast loop: ASCII is always the start of a buffer so skip ASCII that is not the first code point
+        // of the needle, step back if the run ends with non-ASCII because the last ASCII can get combining marks
+        it_in_utf8 prev = start;
+        while (start != last1 && (*start & 0xFF) <= 0x7F && (type_codept)(*start & 0xFF) != first)
+        {
+            prev = start;
+            ++start;
+        }
+        if (start != last1 && (*start & 0xFF) > 0x7F)
+            start = prev;
+
+        impl_norm_iter_state_reset(&s);
+        src = start;
+        begin = true;
+
+        // Slow loop: walk the haystack and try to match the needle only from the start of a buffer
+        // that starts with the first code point of the needle, return to the fast loop on ASCII
+        while (norm_search_next_utf8(&src, last1, &s, &c, &bound))
+        {
+            if (begin && c == first && norm_search_match_utf8(start, last1, first2, last2, &m, &found))
+            {
+                *pos = (size_t)(start - first1);
+                *end = (size_t)(found - first1);
+                return true;
+            }
+
+            begin = (s.pos == 0);
+            if (begin)
+            {
+                start = bound;
+                if (start == last1 || (*start & 0xFF) <= 0x7F)
+                    break;
+            }
+        }
+    }
+
+    return false;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16>
+#endif
+uaix_static bool norm_nfd_next_utf16(it_in_utf16* const src, it_end_utf16 last,
+                                      struct impl_norm_iter_state* const s, type_codept* const codepoint)
+{
+    // The same as NFD normalization iterator: fill the buffer until it is ready and get the next code point
+
+    type_codept c = 0; // tag_can_be_uninitialized
+
+    if (!inline_norm_iter_ready(s))
+    {
+        while (*src != last)
+        {
+            *src = iter_utf16(*src, last, &c, iter_replacement);
+            if (inline_norm_iter_nfd(s, c))
+                break;
+        }
+    }
+    return inline_norm_iter_next_decomp(s, codepoint);
+}
+
+// Compares strings as if both of them are normalized to NFD, result in code point order
+// Code points are compared as soon as they are ready so the function stops at the first difference
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16>
+#endif
+uaix_static int impl_norm_compare_nfd_utf16(it_in_utf16 first1, it_end_utf16 last1,
+                                            it_in_utf16 first2, it_end_utf16 last2)
+{
+    it_in_utf16 src1 = first1;
+    it_in_utf16 src2 = first2;
+    it_in_utf16 bound1 = first1;
+    it_in_utf16 bound2 = first2;
+    type_codept c1 = 0; // tag_can_be_uninitialized
+    type_codept c2 = 0; // tag_can_be_uninitialized
+
+    // Optimization for long mostly equal strings: skip the equal code units
+    // and remember the last boundary before the difference, code units below U+00C0 are never surrogates and are Quick_Check=Yes starters
+    while (src1 != last1 && src2 != last2 && *src1 == *src2)
+    {
+        if ((*src1 & 0xFFFF) < 0x00C0)
+        {
+            bound1 = src1;
+            bound2 = src2;
+        }
+        ++src1;
+        ++src2;
+    }
+
+    if (src1 == last1 && src2 == last2)
+        return 0;
+
+    src1 = bound1;
+    src2 = bound2;
+
+    struct impl_norm_iter_state s1 = {0, {0, 0, 0}, {{0}, {0}}}; // tag_must_be_initialized
+    struct impl_norm_iter_state s2 = {0, {0, 0, 0}, {{0}, {0}}}; // tag_must_be_initialized
+
+    bool next1 = norm_nfd_next_utf16(&src1, last1, &s1, &c1);
+    bool next2 = norm_nfd_next_utf16(&src2, last2, &s2, &c2);
+
+    while (next1 && next2)
+    {
+        if (c1 != c2)
+            return (c1 < c2) ? -1 : 1;
+
+        next1 = norm_nfd_next_utf16(&src1, last1, &s1, &c1);
+        next2 = norm_nfd_next_utf16(&src2, last2, &s2, &c2);
+    }
+
+    return next1 - next2;
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16>
+#endif
+uaix_static bool norm_search_next_utf16(it_in_utf16* const src, it_end_utf16 last,
+                                       struct impl_norm_iter_state* const s, type_codept* const codepoint, it_in_utf16* const bound)
+{
+    // The same as norm_nfd_next_utf16 but also remembers where the ready buffer ends in the source,
+    // the buffer is ready before the code point that starts the next buffer or at the end of the data
+
+    type_codept c = 0; // tag_can_be_uninitialized
+
+    if (!inline_norm_iter_ready(s))
+    {
+        while (*src != last)
+        {
+            *bound = *src;
+            *src = iter_utf16(*src, last, &c, iter_replacement);
+            if (inline_norm_iter_nfd(s, c))
+                return inline_norm_iter_next_decomp(s, codepoint);
+        }
+        *bound = *src;
+    }
+    return inline_norm_iter_next_decomp(s, codepoint);
+}
+
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16>
+#endif
+uaix_static bool norm_search_match_utf16(it_in_utf16 first1, it_end_utf16 last1,
+                                        it_in_utf16 first2, it_end_utf16 last2,
+                                        struct impl_norm_iter_state* const s, it_in_utf16* const end)
+{
+    // Match the needle from the start of a buffer, the needle must end together with a buffer
+
+    it_in_utf16 src1 = first1;
+    it_in_utf16 src2 = first2;
+    type_codept c1 = 0; // tag_can_be_uninitialized
+    type_codept c2 = 0; // tag_can_be_uninitialized
+
+    impl_norm_iter_state_reset(s);
+
+    while (norm_search_next_utf16(&src1, last1, s, &c1, end))
+    {
+        src2 = iter_utf16(src2, last2, &c2, iter_replacement);
+        if (c1 != c2)
+            return false;
+        if (src2 == last2)
+            return s->pos == 0;
+    }
+    return false;
+}
+
+// Searches for the needle that must be already normalized to NFD in the haystack normalized to NFD on the fly
+// A match always starts and ends on the boundaries of the normalization buffers so it never splits
+// a base and its combining marks or a Hangul syllable, pos and end are positions in the original haystack
+#ifdef __cplusplus
+template<typename it_in_utf16, typename it_end_utf16>
+#endif
+uaix_static bool impl_norm_search_nfd_utf16(it_in_utf16 first1, it_end_utf16 last1,
+                                           it_in_utf16 first2, it_end_utf16 last2,
+                                           size_t* const pos, size_t* const end)
+{
+    it_in_utf16 src = first1;
+    it_in_utf16 bound = first1;
+    it_in_utf16 start = first1;
+    it_in_utf16 found = first1;
+    type_codept c = 0; // tag_can_be_uninitialized
+    type_codept first = 0; // tag_can_be_uninitialized
+    bool begin = true; // tag_must_be_initialized
+    struct impl_norm_iter_state s = {0, {0, 0, 0}, {{0}, {0}}}; // tag_can_be_uninitialized
+    struct impl_norm_iter_state m = {0, {0, 0, 0}, {{0}, {0}}}; // tag_can_be_uninitialized
+
+    if (first2 == last2)
+    {
+        *pos = 0;
+        *end = 0;
+        return true;
+    }
+
+    iter_utf16(first2, last2, &first, iter_replacement);
+
+    while (start != last1)
+    {
+        // Fast loop: ASCII is always the start of a buffer so skip ASCII that is not the first code point
+        // of the needle, step back if the run ends with non-ASCII because the last ASCII can get combining marks
+        it_in_utf16 prev = start;
+        while (start != last1 && (*start & 0xFFFF) <= 0x7F && (type_codept)(*start & 0xFFFF) != first)
+        {
+            prev = start;
+            ++start;
+        }
+        if (start != last1 && (*start & 0xFFFF) > 0x7F)
+            start = prev;
+
+        impl_norm_iter_state_reset(&s);
+        src = start;
+        begin = true;
+
+        // Slow loop: walk the haystack and try to match the needle only from the start of a buffer
+        // that starts with the first code point of the needle, return to the fast loop on ASCII
+        while (norm_search_next_utf16(&src, last1, &s, &c, &bound))
+        {
+            if (begin && c == first && norm_search_match_utf16(start, last1, first2, last2, &m, &found))
+            {
+                *pos = (size_t)(start - first1);
+                *end = (size_t)(found - first1);
+                return true;
+            }
+
+            begin = (s.pos == 0);
+            if (begin)
+            {
+                start = bound;
+                if (start == last1 || (*start & 0xFFFF) <= 0x7F)
+                    break;
+            }
+        }
+    }
+
+    return false;
+}
+
 // Expose properties for a wrapper
 // Must always be at the end of the file
 
@@ -1897,7 +2949,7 @@ uaix_static type_codept impl_norm_get_prop(type_codept c)
     if (c > 0x10FFFF)
         c = 0xFFFD;
 
-    return stages(c, stage1_ccc_qc, stage2_ccc_qc);
+    return stages_ccc_qc(c) & 0xFFFF;
 }
 
 uaix_always_inline
@@ -1907,6 +2959,23 @@ uaix_static unsigned char impl_norm_get_ccc_prop(type_codept prop)
     return (unsigned char)(prop & 0xFF);
 }
 
+uaix_always_inline
+uaix_static bool impl_norm_is_ns_prop(type_codept prop)
+{
+    // Initial non-starters in NFKD, such code point continues a run of non-starters
+    // even if Canonical_Combining_Class=0, see stages_qc_yes_ns_impl
+    return ((prop >> 14) & 3) ? true : false;
+}
+
+uaix_always_inline
+uaix_static bool impl_norm_count_ns_prop(type_codept prop, size_t* const count_ns)
+{
+    // Counts non-starters the same way as normalization functions do for Stream-Safe Text Process,
+    // returns true if U+034F must be inserted before the code point, the count must be reset
+    // to 0 for code points below NFKD lower bound (U+00A0)
+    return stages_qc_yes_ns_impl(prop, count_ns);
+}
+
 uaix_always_inline
 uaix_static bool impl_norm_is_nfc_qc_yes_prop(type_codept prop)
 {
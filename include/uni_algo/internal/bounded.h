@@ -0,0 +1,140 @@
+/* C++ Standard Library wrapper for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+#ifndef UNI_ALGO_INTERNAL_BOUNDED_H_UAIH
+#define UNI_ALGO_INTERNAL_BOUNDED_H_UAIH
+
+#include <string_view>
+
+#include "../config.h"
+#include "error.h"
+
+namespace una {
+
+// The result of bounded functions: the number of code units of the source that have been consumed
+// and the number of code units that have been written to the destination
+struct bounded_result
+{
+    std::size_t read = 0;
+    std::size_t written = 0;
+};
+
+namespace detail {
+
+// Returns the number of code units at the end that can be the beginning of an incomplete sequence
+template<std::size_t SrcUTF, typename Src>
+uaiw_constexpr std::size_t utf_tail(const Src* s, std::size_t n) noexcept
+{
+    if constexpr (SrcUTF == 8)
+    {
+        for (std::size_t i = 1; i <= 3 && i <= n; ++i)
+        {
+            const char32_t c = static_cast<char32_t>(s[n - i]) & 0xFF;
+            if (c >= 0x80 && c <= 0xBF) // Continuation byte
+                continue;
+            // C0, C1, F5-FF are always ill-formed alone
+            const std::size_t length = (c >= 0xF5) ? 1 : (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : (c >= 0xC2) ? 2 : 1;
+            return (i < length) ? i : 0;
+        }
+        return 0;
+    }
+    else if constexpr (SrcUTF == 16)
+    {
+        const char32_t c = (n > 0) ? (static_cast<char32_t>(s[n - 1]) & 0xFFFF) : 0;
+        return (c >= 0xD800 && c <= 0xDBFF) ? 1 : 0;
+    }
+    else
+    {
+        (void)s;
+        (void)n;
+        return 0;
+    }
+}
+
+// Bounded conversion/normalization: writes as much as fits to a fixed buffer and stops on a boundary.
+// The source is processed in pieces that always fit in the rest of the buffer: a piece is SizeX times
+// smaller than the rest of the buffer and ends on a boundary where the result is the same as if the whole
+// string was processed at once. When such piece is empty (the end of the buffer) the next piece is
+// processed to a buffer on the stack and copied only if it fits. If the next piece is longer than
+// Traits::max_segment (possible only in normalization of text that is not stream-safe or has a lot of
+// starters that are not boundaries) it is left for the next call the same as if it does not fit,
+// so the caller must continue with a buffer of at least SizeX times the piece.
+// Traits must provide:
+// boundary(s, i, n) - the last boundary <= i in s[0, n), 0 if there is no boundary
+// next(s, n) - the first boundary > 0 in s[0, n) or n
+// max_segment - the max size of a piece returned by next() that is processed to a buffer on the stack
+// process(s, n, dst, dst_size, error) - the low-level function, returns the number of code units written
+template<typename Src, typename Dst, size_t SizeX, class Traits>
+uaiw_constexpr bounded_result t_bounded(std::basic_string_view<Src> src, Dst* dst, std::size_t dst_size, std::size_t* error)
+{
+    const Src* s = src.data();
+    const std::size_t n = src.size();
+
+    std::size_t i = 0; // Source position
+    std::size_t o = 0; // Destination position
+    while (i < n)
+    {
+        std::size_t j = n;
+        if ((dst_size - o) / SizeX < n - i)
+            j = i + Traits::boundary(s + i, (dst_size - o) / SizeX, n - i);
+        if (j == i)
+            j = i + Traits::next(s + i, n - i);
+
+        std::size_t written = 0;
+        if (j - i <= (dst_size - o) / SizeX)
+        {
+            written = Traits::process(s + i, j - i, dst + o, dst_size - o, error);
+        }
+        else if (j - i <= Traits::max_segment)
+        {
+            Dst buffer[Traits::max_segment * SizeX] = {};
+            written = Traits::process(s + i, j - i, buffer, Traits::max_segment * SizeX, error);
+            if (written > dst_size - o)
+            {
+                if (error)
+                    *error = impl_npos; // The error will be found again on the next call
+                break;
+            }
+
+            for (std::size_t k = 0; k < written; ++k)
+                dst[o + k] = buffer[k];
+        }
+        else
+        {
+            // The segment is longer than the buffer, stop here the same as if it does not fit
+            // so it will be processed straight to a bigger destination buffer
+            break;
+        }
+
+        o += written;
+        if (error && *error != impl_npos)
+        {
+            *error += i;
+            return bounded_result{*error, o};
+        }
+        i = j;
+    }
+
+    return bounded_result{i, o};
+}
+
+template<typename Src, typename Dst, size_t SizeX, class Traits>
+uaiw_constexpr bounded_result t_bounded(std::basic_string_view<Src> src, Dst* dst, std::size_t dst_size, una::error& error)
+{
+    error.reset();
+
+    std::size_t err = impl_npos;
+
+    const bounded_result result = t_bounded<Src, Dst, SizeX, Traits>(src, dst, dst_size, &err);
+    if (err != impl_npos)
+        error = una::error{una::error::code::ill_formed_utf, err};
+
+    return result;
+}
+
+} // namespace detail
+
+} // namespace una
+
+#endif // UNI_ALGO_INTERNAL_BOUNDED_H_UAIH
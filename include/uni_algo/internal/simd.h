@@ -0,0 +1,1582 @@
+/* C++ Standard Library wrapper for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+#ifndef UNI_ALGO_INTERNAL_SIMD_H_UAIH
+#define UNI_ALGO_INTERNAL_SIMD_H_UAIH
+
+#include "../config.h"
+
+// SIMD fast paths for the wrapper.
+// Low-level is written in a language that cannot use intrinsics so all SIMD code lives here.
+// Every function in this file only does the easy part of the work on contiguous memory
+// and returns how much was done, the rest (including all error handling) is always done by low-level.
+// It means the result of any function that uses this file is always the same as without it.
+// If the platform is not supported or UNI_ALGO_DISABLE_SIMD is defined or in constant evaluation
+// the functions do nothing and return 0.
+
+#ifndef UNI_ALGO_DISABLE_SIMD
+#  if defined(__x86_64__) || defined(_M_X64)
+#    define uaiw_simd_x86
+#  elif defined(__aarch64__) && defined(__ARM_NEON)
+#    define uaiw_simd_neon
+#  endif
+#endif
+
+#if defined(uaiw_simd_x86)
+#  if defined(_MSC_VER) && !defined(__clang__)
+#    include <intrin.h>
+#    define uaiw_simd_target_ssse3
+#    define uaiw_simd_target_avx2
+#  else
+#    include <immintrin.h>
+#    define uaiw_simd_target_ssse3 __attribute__((target("ssse3")))
+#    define uaiw_simd_target_avx2 __attribute__((target("avx2")))
+#  endif
+#elif defined(uaiw_simd_neon)
+#  include <arm_neon.h>
+#  include <cstring> // std::memcpy
+#endif
+
+namespace una::detail::simd {
+
+#if defined(uaiw_simd_x86)
+
+// Runtime dispatch, AVX2 is never used if the OS doesn't save YMM registers
+enum class level : unsigned char {none, ssse3, avx2};
+
+inline level x86_detect() noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4] = {};
+    __cpuid(info, 0);
+    const int max_leaf = info[0];
+    if (max_leaf < 1)
+        return level::none;
+    __cpuid(info, 1);
+    const bool ssse3 = (info[2] & (1 << 9)) != 0;
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (osxsave && avx && max_leaf >= 7 && (_xgetbv(0) & 0x6) == 0x6)
+    {
+        __cpuidex(info, 7, 0);
+        if ((info[1] & (1 << 5)) != 0)
+            return level::avx2;
+    }
+    return ssse3 ? level::ssse3 : level::none;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return level::avx2;
+    if (__builtin_cpu_supports("ssse3"))
+        return level::ssse3;
+    return level::none;
+#endif
+}
+
+inline level x86_level() noexcept
+{
+    static const level lvl = x86_detect();
+    return lvl;
+}
+
+#endif // uaiw_simd_x86
+
+#if defined(uaiw_simd_x86) || defined(uaiw_simd_neon)
+
+// UTF-8 validation by lookup tables, see:
+// John Keiser, Daniel Lemire "Validating UTF-8 In Less Than One Instruction Per Byte"
+// Every error is a bit, a byte is ill-formed if the same bit is set in all 3 tables.
+
+inline constexpr unsigned char utf8_too_short      = 1 << 0; // 11______ 0_______
+                                                             // 11______ 11______
+inline constexpr unsigned char utf8_too_long       = 1 << 1; // 0_______ 10______
+inline constexpr unsigned char utf8_overlong_3     = 1 << 2; // 11100000 100_____
+inline constexpr unsigned char utf8_too_large      = 1 << 3; // 11110100 1001____
+                                                             // 11110100 101_____
+                                                             // 11110101 1001____ and so on
+inline constexpr unsigned char utf8_surrogate      = 1 << 4; // 11101101 101_____
+inline constexpr unsigned char utf8_overlong_2     = 1 << 5; // 1100000_ 10______
+inline constexpr unsigned char utf8_too_large_1000 = 1 << 6; // 11110101 1000____ and so on
+inline constexpr unsigned char utf8_overlong_4     = 1 << 6; // 11110000 1000____
+inline constexpr unsigned char utf8_two_conts      = 1 << 7; // 10______ 10______
+inline constexpr unsigned char utf8_carry = utf8_too_short | utf8_too_long | utf8_two_conts;
+
+// High nibble of the previous byte
+inline constexpr unsigned char utf8_table_byte_1_high[16] = {
+    // 0_______ ________ <ASCII in byte 1>
+    utf8_too_long, utf8_too_long, utf8_too_long, utf8_too_long,
+    utf8_too_long, utf8_too_long, utf8_too_long, utf8_too_long,
+    // 10______ ________ <continuation in byte 1>
+    utf8_two_conts, utf8_two_conts, utf8_two_conts, utf8_two_conts,
+    // 1100____ ________ <two byte lead in byte 1>
+    utf8_too_short | utf8_overlong_2,
+    // 1101____ ________ <two byte lead in byte 1>
+    utf8_too_short,
+    // 1110____ ________ <three byte lead in byte 1>
+    utf8_too_short | utf8_overlong_3 | utf8_surrogate,
+    // 1111____ ________ <four+ byte lead in byte 1>
+    utf8_too_short | utf8_too_large | utf8_too_large_1000 | utf8_overlong_4
+};
+
+// Low nibble of the previous byte
+inline constexpr unsigned char utf8_table_byte_1_low[16] = {
+    // ____0000 ________
+    utf8_carry | utf8_overlong_3 | utf8_overlong_2 | utf8_overlong_4,
+    // ____0001 ________
+    utf8_carry | utf8_overlong_2,
+    // ____001_ ________
+    utf8_carry,
+    utf8_carry,
+    // ____0100 ________
+    utf8_carry | utf8_too_large,
+    // ____0101 ________
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    // ____011_ ________
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    // ____1___ ________
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    // ____1101 ________
+    utf8_carry | utf8_too_large | utf8_too_large_1000 | utf8_surrogate,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000
+};
+
+// High nibble of the current byte
+inline constexpr unsigned char utf8_table_byte_2_high[16] = {
+    // ________ 0_______ <ASCII in byte 2>
+    utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short,
+    utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short,
+    // ________ 1000____
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_overlong_3 | utf8_too_large_1000 | utf8_overlong_4,
+    // ________ 1001____
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_overlong_3 | utf8_too_large,
+    // ________ 101_____
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_surrogate | utf8_too_large,
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_surrogate | utf8_too_large,
+    // ________ 11______
+    utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short
+};
+
+// The last bytes of a block that can start a sequence that is not finished in the block
+inline constexpr unsigned char utf8_table_incomplete[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF
+};
+
+// The functions below stop at the start of a block that contains an error or at the tail
+// so the sequence that crosses the stop point must be given back to low-level.
+// Note that the prefix before the stop point is already validated so it is enough
+// to find the lead byte of the last sequence within 3 bytes back.
+inline std::size_t utf8_last_boundary(const unsigned char* s, std::size_t i) noexcept
+{
+    for (std::size_t j = 1; j <= 3 && j <= i; ++j)
+    {
+        const unsigned char c = s[i - j];
+        if (c < 0x80)
+            return i - j + 1;
+        if (c >= 0xC0)
+            return i - j;
+    }
+    return i;
+}
+
+#endif // defined(uaiw_simd_x86) || defined(uaiw_simd_neon)
+
+#if defined(uaiw_simd_x86)
+
+uaiw_simd_target_ssse3 inline __m128i utf8_check_ssse3(__m128i input, __m128i prev_input) noexcept
+{
+    const __m128i mask_0f = _mm_set1_epi8(0x0F);
+
+    const __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+    const __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+
+    const __m128i byte_1_high = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_table_byte_1_high)),
+        _mm_and_si128(_mm_srli_epi16(prev1, 4), mask_0f));
+    const __m128i byte_1_low = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_table_byte_1_low)),
+        _mm_and_si128(prev1, mask_0f));
+    const __m128i byte_2_high = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_table_byte_2_high)),
+        _mm_and_si128(_mm_srli_epi16(input, 4), mask_0f));
+    const __m128i special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+    // Third and fourth bytes of 3/4-byte sequences must be continuations
+    const __m128i is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80));
+    const __m128i is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80));
+    const __m128i must23_80 = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte),
+                                            _mm_set1_epi8(static_cast<char>(0x80)));
+
+    return _mm_xor_si128(must23_80, special_cases);
+}
+
+uaiw_simd_target_ssse3 inline std::size_t utf8_valid_prefix_ssse3(const unsigned char* s, std::size_t n) noexcept
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i incomplete = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_table_incomplete + 16));
+
+    __m128i prev_input = zero;
+    __m128i prev_incomplete = zero;
+
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+
+        const __m128i error = (_mm_movemask_epi8(input) == 0) ? prev_incomplete
+                                                               : utf8_check_ssse3(input, prev_input);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xFFFF)
+            break;
+
+        prev_incomplete = _mm_subs_epu8(input, incomplete);
+        prev_input = input;
+    }
+
+    return utf8_last_boundary(s, i);
+}
+
+uaiw_simd_target_avx2 inline __m256i utf8_check_avx2(__m256i input, __m256i prev_input) noexcept
+{
+    const __m256i mask_0f = _mm256_set1_epi8(0x0F);
+
+    const __m256i prev = _mm256_permute2x128_si256(prev_input, input, 0x21);
+    const __m256i prev1 = _mm256_alignr_epi8(input, prev, 15);
+    const __m256i prev2 = _mm256_alignr_epi8(input, prev, 14);
+    const __m256i prev3 = _mm256_alignr_epi8(input, prev, 13);
+
+    const __m256i byte_1_high = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_table_byte_1_high))),
+        _mm256_and_si256(_mm256_srli_epi16(prev1, 4), mask_0f));
+    const __m256i byte_1_low = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_table_byte_1_low))),
+        _mm256_and_si256(prev1, mask_0f));
+    const __m256i byte_2_high = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_table_byte_2_high))),
+        _mm256_and_si256(_mm256_srli_epi16(input, 4), mask_0f));
+    const __m256i special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+    const __m256i is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0 - 0x80));
+    const __m256i is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0 - 0x80));
+    const __m256i must23_80 = _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte),
+                                               _mm256_set1_epi8(static_cast<char>(0x80)));
+
+    return _mm256_xor_si256(must23_80, special_cases);
+}
+
+uaiw_simd_target_avx2 inline std::size_t utf8_valid_prefix_avx2(const unsigned char* s, std::size_t n) noexcept
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i incomplete = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(utf8_table_incomplete));
+
+    __m256i prev_input = zero;
+    __m256i prev_incomplete = zero;
+
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+
+        const __m256i error = (_mm256_movemask_epi8(input) == 0) ? prev_incomplete
+                                                                  : utf8_check_avx2(input, prev_input);
+        if (!_mm256_testz_si256(error, error))
+            break;
+
+        prev_incomplete = _mm256_subs_epu8(input, incomplete);
+        prev_input = input;
+    }
+
+    // Do the tail with SSSE3 if possible to not give too much work to low-level
+    if (i + 32 > n && i + 16 <= n && utf8_last_boundary(s, i) == i)
+        return i + utf8_valid_prefix_ssse3(s + i, n - i);
+
+    return utf8_last_boundary(s, i);
+}
+
+#elif defined(uaiw_simd_neon)
+
+inline uint8x16_t utf8_check_neon(uint8x16_t input, uint8x16_t prev_input) noexcept
+{
+    const uint8x16_t mask_0f = vdupq_n_u8(0x0F);
+
+    const uint8x16_t prev1 = vextq_u8(prev_input, input, 15);
+    const uint8x16_t prev2 = vextq_u8(prev_input, input, 14);
+    const uint8x16_t prev3 = vextq_u8(prev_input, input, 13);
+
+    const uint8x16_t byte_1_high = vqtbl1q_u8(vld1q_u8(utf8_table_byte_1_high), vshrq_n_u8(prev1, 4));
+    const uint8x16_t byte_1_low = vqtbl1q_u8(vld1q_u8(utf8_table_byte_1_low), vandq_u8(prev1, mask_0f));
+    const uint8x16_t byte_2_high = vqtbl1q_u8(vld1q_u8(utf8_table_byte_2_high), vshrq_n_u8(input, 4));
+    const uint8x16_t special_cases = vandq_u8(vandq_u8(byte_1_high, byte_1_low), byte_2_high);
+
+    const uint8x16_t is_third_byte = vqsubq_u8(prev2, vdupq_n_u8(0xE0 - 0x80));
+    const uint8x16_t is_fourth_byte = vqsubq_u8(prev3, vdupq_n_u8(0xF0 - 0x80));
+    const uint8x16_t must23_80 = vandq_u8(vorrq_u8(is_third_byte, is_fourth_byte), vdupq_n_u8(0x80));
+
+    return veorq_u8(must23_80, special_cases);
+}
+
+inline std::size_t utf8_valid_prefix_neon(const unsigned char* s, std::size_t n) noexcept
+{
+    const uint8x16_t zero = vdupq_n_u8(0);
+    const uint8x16_t incomplete = vld1q_u8(utf8_table_incomplete + 16);
+
+    uint8x16_t prev_input = zero;
+    uint8x16_t prev_incomplete = zero;
+
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        const uint8x16_t input = vld1q_u8(s + i);
+
+        const uint8x16_t error = (vmaxvq_u8(input) < 0x80) ? prev_incomplete
+                                                            : utf8_check_neon(input, prev_input);
+        if (vmaxvq_u8(error) != 0)
+            break;
+
+        prev_incomplete = vqsubq_u8(input, incomplete);
+        prev_input = input;
+    }
+
+    return utf8_last_boundary(s, i);
+}
+
+#endif
+
+// ASCII widening: copies the ASCII prefix of UTF-8 string to UTF-16/UTF-32 string,
+// stops at the first block that is not ASCII-only so the tail is always done by low-level.
+
+#if defined(uaiw_simd_x86)
+
+// SSE2 is always available on x86-64 so no runtime dispatch is needed here
+template<typename UTFX>
+inline void ascii_widen_store_sse2(__m128i input, UTFX* dst) noexcept
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    const __m128i lo = _mm_unpacklo_epi8(input, zero);
+    const __m128i hi = _mm_unpackhi_epi8(input, zero);
+
+    if constexpr (sizeof(UTFX) == 2)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), hi);
+    }
+    else
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4), _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 12), _mm_unpackhi_epi16(hi, zero));
+    }
+}
+
+template<typename UTFX>
+inline std::size_t ascii_widen_sse2(const unsigned char* s, std::size_t n, UTFX* dst) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        const __m128i input1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        const __m128i input2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 16));
+        if (_mm_movemask_epi8(_mm_or_si128(input1, input2)) != 0)
+            break;
+        ascii_widen_store_sse2(input1, dst + i);
+        ascii_widen_store_sse2(input2, dst + i + 16);
+    }
+    for (; i + 16 <= n; i += 16)
+    {
+        const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        if (_mm_movemask_epi8(input) != 0)
+            break;
+        ascii_widen_store_sse2(input, dst + i);
+    }
+    return i;
+}
+
+inline bool ascii_block_sse2(const unsigned char* s) noexcept
+{
+    return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s))) == 0;
+}
+
+inline std::size_t ascii_prefix_sse2(const unsigned char* s, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        if (!ascii_block_sse2(s + i))
+            break;
+    }
+    return i;
+}
+
+#elif defined(uaiw_simd_neon)
+
+template<typename UTFX>
+inline std::size_t ascii_widen_neon(const unsigned char* s, std::size_t n, UTFX* dst) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        const uint8x16_t input = vld1q_u8(s + i);
+        if (vmaxvq_u8(input) >= 0x80)
+            break;
+
+        const uint16x8_t lo = vmovl_u8(vget_low_u8(input));
+        const uint16x8_t hi = vmovl_high_u8(input);
+
+        // std::memcpy instead of vst1q because of strict aliasing, compilers produce the same store
+        if constexpr (sizeof(UTFX) == 2)
+        {
+            std::memcpy(dst + i, &lo, 16);
+            std::memcpy(dst + i + 8, &hi, 16);
+        }
+        else
+        {
+            const uint32x4_t lo_lo = vmovl_u16(vget_low_u16(lo));
+            const uint32x4_t lo_hi = vmovl_high_u16(lo);
+            const uint32x4_t hi_lo = vmovl_u16(vget_low_u16(hi));
+            const uint32x4_t hi_hi = vmovl_high_u16(hi);
+            std::memcpy(dst + i, &lo_lo, 16);
+            std::memcpy(dst + i + 4, &lo_hi, 16);
+            std::memcpy(dst + i + 8, &hi_lo, 16);
+            std::memcpy(dst + i + 12, &hi_hi, 16);
+        }
+    }
+    return i;
+}
+
+inline bool ascii_block_neon(const unsigned char* s) noexcept
+{
+    return vmaxvq_u8(vld1q_u8(s)) < 0x80;
+}
+
+inline std::size_t ascii_prefix_neon(const unsigned char* s, std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        if (!ascii_block_neon(s + i))
+            break;
+    }
+    return i;
+}
+
+#endif
+
+// Returns the length of the prefix that is valid UTF-8, the prefix always ends on a code point boundary.
+// Note that the prefix can be shorter than the real valid prefix, the caller must always validate the rest.
+inline std::size_t utf8_valid_prefix_bytes(const unsigned char* s, std::size_t n) noexcept
+{
+#if defined(uaiw_simd_x86)
+    if (n < 16)
+        return 0;
+#  ifdef __AVX2__
+    return utf8_valid_prefix_avx2(s, n);
+#  else
+    switch (x86_level())
+    {
+    case level::avx2:
+        return utf8_valid_prefix_avx2(s, n);
+    case level::ssse3:
+        return utf8_valid_prefix_ssse3(s, n);
+    default:
+        return 0;
+    }
+#  endif
+#elif defined(uaiw_simd_neon)
+    if (n < 16)
+        return 0;
+    return utf8_valid_prefix_neon(s, n);
+#else
+    (void)s;
+    (void)n;
+    return 0;
+#endif
+}
+
+// Returns the length of the ASCII prefix that was copied to dst,
+// dst must have enough space for n code units.
+template<typename UTFX>
+inline std::size_t ascii_widen_bytes(const unsigned char* s, std::size_t n, UTFX* dst) noexcept
+{
+#if defined(uaiw_simd_x86)
+    return ascii_widen_sse2(s, n, dst);
+#elif defined(uaiw_simd_neon)
+    return ascii_widen_neon(s, n, dst);
+#else
+    (void)s;
+    (void)n;
+    (void)dst;
+    return 0;
+#endif
+}
+
+// Returns the position of the next block that is ASCII-only and can be widened
+// or n if there is no such block. The first byte is always skipped and the position
+// is always on a code point boundary so low-level can be used on everything before it.
+inline std::size_t ascii_next_bytes(const unsigned char* s, std::size_t n) noexcept
+{
+#if defined(uaiw_simd_x86) || defined(uaiw_simd_neon)
+    for (std::size_t i = 1; i + 16 <= n; ++i)
+    {
+#  if defined(uaiw_simd_x86)
+        if (s[i] < 0x80 && ascii_block_sse2(s + i))
+#  else
+        if (s[i] < 0x80 && ascii_block_neon(s + i))
+#  endif
+            return i;
+    }
+#else
+    (void)s;
+#endif
+    return n;
+}
+
+// Returns the length of the ASCII prefix, the prefix is found by blocks of 16 bytes
+// so it can be shorter than the real ASCII prefix by up to 15 bytes.
+inline std::size_t ascii_prefix_bytes(const unsigned char* s, std::size_t n) noexcept
+{
+#if defined(uaiw_simd_x86)
+    return ascii_prefix_sse2(s, n);
+#elif defined(uaiw_simd_neon)
+    return ascii_prefix_neon(s, n);
+#else
+    (void)s;
+    (void)n;
+    return 0;
+#endif
+}
+
+// ASCII case mapping: bytes in range [lo, hi] get bit 0x20 flipped, that is compare-and-add
+// for 'A'-'Z' -> 'a'-'z' (lowercase and case folding) and compare-and-subtract for the opposite.
+// Stops at the first non-ASCII byte so everything else is always done by low-level.
+
+#if defined(uaiw_simd_x86)
+
+inline __m128i ascii_case_block_sse2(__m128i input, __m128i lo, __m128i hi) noexcept
+{
+    // Signed compare is fine here because the block is already known to be ASCII
+    const __m128i range = _mm_and_si128(_mm_cmpgt_epi8(input, lo), _mm_cmplt_epi8(input, hi));
+    return _mm_xor_si128(input, _mm_and_si128(range, _mm_set1_epi8(0x20)));
+}
+
+inline std::size_t ascii_case_sse2(const unsigned char* s, std::size_t n, unsigned char* dst, char lo, char hi) noexcept
+{
+    const __m128i lo_1 = _mm_set1_epi8(static_cast<char>(lo - 1));
+    const __m128i hi_1 = _mm_set1_epi8(static_cast<char>(hi + 1));
+
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        if (_mm_movemask_epi8(input) != 0)
+            break;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), ascii_case_block_sse2(input, lo_1, hi_1));
+    }
+    return i;
+}
+
+uaiw_simd_target_avx2 inline std::size_t ascii_case_avx2(const unsigned char* s, std::size_t n, unsigned char* dst, char lo, char hi) noexcept
+{
+    const __m256i lo_1 = _mm256_set1_epi8(static_cast<char>(lo - 1));
+    const __m256i hi_1 = _mm256_set1_epi8(static_cast<char>(hi + 1));
+    const __m256i bit = _mm256_set1_epi8(0x20);
+
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        if (_mm256_movemask_epi8(input) != 0)
+            break;
+        const __m256i range = _mm256_and_si256(_mm256_cmpgt_epi8(input, lo_1), _mm256_cmpgt_epi8(hi_1, input));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_xor_si256(input, _mm256_and_si256(range, bit)));
+    }
+
+    // Do the tail or the first half of the non-ASCII block with SSE2
+    return i + ascii_case_sse2(s + i, n - i, dst + i, lo, hi);
+}
+
+#elif defined(uaiw_simd_neon)
+
+inline std::size_t ascii_case_neon(const unsigned char* s, std::size_t n, unsigned char* dst, char lo, char hi) noexcept
+{
+    const uint8x16_t lo_v = vdupq_n_u8(static_cast<unsigned char>(lo));
+    const uint8x16_t hi_v = vdupq_n_u8(static_cast<unsigned char>(hi));
+    const uint8x16_t bit = vdupq_n_u8(0x20);
+
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        const uint8x16_t input = vld1q_u8(s + i);
+        if (vmaxvq_u8(input) >= 0x80)
+            break;
+        const uint8x16_t range = vandq_u8(vcgeq_u8(input, lo_v), vcleq_u8(input, hi_v));
+        vst1q_u8(dst + i, veorq_u8(input, vandq_u8(range, bit)));
+    }
+    return i;
+}
+
+#endif
+
+// Returns the length of the ASCII prefix that was mapped to dst, dst must have enough space for n bytes.
+// Lowercase and case folding are the same for ASCII so only upper is needed.
+inline std::size_t ascii_case_bytes(const unsigned char* s, std::size_t n, unsigned char* dst, bool upper) noexcept
+{
+#if defined(uaiw_simd_x86) || defined(uaiw_simd_neon)
+    const char lo = upper ? 'a' : 'A';
+    const char hi = upper ? 'z' : 'Z';
+
+#  if defined(uaiw_simd_x86)
+#    ifdef __AVX2__
+    std::size_t i = ascii_case_avx2(s, n, dst, lo, hi);
+#    else
+    std::size_t i = (x86_level() == level::avx2) ? ascii_case_avx2(s, n, dst, lo, hi)
+                                                  : ascii_case_sse2(s, n, dst, lo, hi);
+#    endif
+#  else
+    std::size_t i = ascii_case_neon(s, n, dst, lo, hi);
+#  endif
+
+    // The tail and the ASCII part of the block where SIMD stopped
+    for (; i < n && s[i] < 0x80; ++i)
+        dst[i] = (s[i] >= lo && s[i] <= hi) ? static_cast<unsigned char>(s[i] ^ 0x20) : s[i];
+
+    return i;
+#else
+    (void)s;
+    (void)n;
+    (void)dst;
+    (void)upper;
+    return 0;
+#endif
+}
+
+#if defined(uaiw_simd_x86)
+
+// UTF-8 -> UTF-16 transcoder by shuffle tables, see:
+// Daniel Lemire, Wojciech Mula "Transcoding Billions of Unicode Characters per Second with SIMD Instructions"
+// The input is always validated first by the validator above, so the transcoder itself
+// never sees ill-formed UTF-8 and all the errors and U+FFFD replacements are done by low-level.
+// A window of 12 bytes is transcoded at a time: the bitmask of the ends of code points
+// in the window selects one of the shuffles that moves 6 code points of 1-2 bytes
+// to 16-bit lanes or 4 code points of 1-3 bytes to 32-bit lanes. Windows with 4-byte
+// sequences are rare so such code point is just decoded without SIMD.
+
+// The tables are generated by the rules above: the index of every bitmask is
+// 0-63 for 6 code points of 1-2 bytes (1 bit per length), 64-144 for 4 code points
+// of 1-3 bytes (base 3 digit per length), 0xFF for everything else,
+// the high byte is the number of bytes the shuffle consumes.
+// 0x80 in shuffle tables means zero byte.
+
+inline constexpr unsigned short utf8to16_table_index[4096] = {
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0676, 0x00FF, 0x00FF, 0x00FF, 0x0664, 0x00FF, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x0652, 0x00FF, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x077F, 0x00FF, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x076D, 0x00FF, 0x0767, 0x0765, 0x055B, 0x00FF, 0x0761, 0x075F, 0x0549, 0x075D, 0x0543, 0x0541, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x074D, 0x0664, 0x074B, 0x065E, 0x065C, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x064C, 0x064A, 0x0708, 0x00FF, 0x0646, 0x0644, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x0888, 0x00FF, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0868, 0x0664, 0x0866, 0x065E, 0x065C, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x064C, 0x064A, 0x0828, 0x00FF, 0x0646, 0x0644, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x0767, 0x0765, 0x0818, 0x00FF, 0x0761, 0x075F, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x074D, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x098B, 0x0989, 0x0676, 0x00FF, 0x0985, 0x0983, 0x0664, 0x0981, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x097D, 0x0652, 0x097B, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0973, 0x0971, 0x077F, 0x096F, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x096B, 0x076D, 0x0969, 0x0767, 0x0765, 0x0938, 0x00FF, 0x0761, 0x075F, 0x0934, 0x075D, 0x0932, 0x0931, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0963, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x074D, 0x092C, 0x074B, 0x092A, 0x0929, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0926, 0x0925, 0x0708, 0x00FF, 0x0646, 0x0923, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x0959, 0x0888, 0x0957, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0951, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0868, 0x091C, 0x0866, 0x091A, 0x0919, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x0916, 0x0915, 0x0828, 0x00FF, 0x0646, 0x0913, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x090E, 0x090D, 0x0818, 0x00FF, 0x0761, 0x090B, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0907, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0676, 0x00FF, 0x00FF, 0x00FF, 0x0664, 0x00FF, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x0652, 0x00FF, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A8E, 0x0A8C, 0x077F, 0x0A8A, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0A86, 0x076D, 0x0A84, 0x0767, 0x0765, 0x055B, 0x00FF, 0x0761, 0x075F, 0x0549, 0x075D, 0x0543, 0x0541, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A7E, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x074D, 0x0664, 0x074B, 0x065E, 0x065C, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x064C, 0x064A, 0x0708, 0x00FF, 0x0646, 0x0644, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x0A74, 0x0888, 0x0A72, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A6C, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0868, 0x0A3C, 0x0866, 0x0A3A, 0x0A39, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x0A36, 0x0A35, 0x0828, 0x00FF, 0x0646, 0x0A33, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x0A2E, 0x0A2D, 0x0818, 0x00FF, 0x0761, 0x0A2B, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0A27, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A5A, 0x098B, 0x0989, 0x0676, 0x00FF, 0x0985, 0x0983, 0x0664, 0x0981, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x097D, 0x0652, 0x097B, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0973, 0x0971, 0x077F, 0x096F, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x096B, 0x076D, 0x0969, 0x0A1E, 0x0A1D, 0x0938, 0x00FF, 0x0761, 0x0A1B, 0x0934, 0x075D, 0x0932, 0x0931, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0963, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0A17, 0x092C, 0x074B, 0x092A, 0x0929, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0926, 0x0925, 0x0708, 0x00FF, 0x0646, 0x0923, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x0959, 0x0888, 0x0957, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0951, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0A0F, 0x091C, 0x0866, 0x091A, 0x0919, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x0916, 0x0915, 0x0828, 0x00FF, 0x0646, 0x0913, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x090E, 0x090D, 0x0818, 0x00FF, 0x0761, 0x090B, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0907, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0676, 0x00FF, 0x00FF, 0x00FF, 0x0664, 0x00FF, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x0652, 0x00FF, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x077F, 0x00FF, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x076D, 0x00FF, 0x0767, 0x0765, 0x055B, 0x00FF, 0x0761, 0x075F, 0x0549, 0x075D, 0x0543, 0x0541, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x074D, 0x0664, 0x074B, 0x065E, 0x065C, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x064C, 0x064A, 0x0708, 0x00FF, 0x0646, 0x0644, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x0B8F, 0x0888, 0x0B8D, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0B87, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0868, 0x0664, 0x0866, 0x065E, 0x065C, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x064C, 0x064A, 0x0828, 0x00FF, 0x0646, 0x0644, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x0767, 0x0765, 0x0818, 0x00FF, 0x0761, 0x075F, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x074D, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0B75, 0x098B, 0x0989, 0x0676, 0x00FF, 0x0985, 0x0983, 0x0664, 0x0981, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x097D, 0x0652, 0x097B, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0973, 0x0971, 0x077F, 0x096F, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x096B, 0x076D, 0x0969, 0x0B3E, 0x0B3D, 0x0938, 0x00FF, 0x0761, 0x0B3B, 0x0934, 0x075D, 0x0932, 0x0931, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0963, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0B37, 0x092C, 0x074B, 0x092A, 0x0929, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0926, 0x0925, 0x0708, 0x00FF, 0x0646, 0x0923, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x0959, 0x0888, 0x0957, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0951, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0B2F, 0x091C, 0x0866, 0x091A, 0x0919, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x0916, 0x0915, 0x0828, 0x00FF, 0x0646, 0x0913, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x090E, 0x090D, 0x0818, 0x00FF, 0x0761, 0x090B, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0907, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0676, 0x00FF, 0x00FF, 0x00FF, 0x0664, 0x00FF, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x0652, 0x00FF, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A8E, 0x0A8C, 0x077F, 0x0A8A, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0A86, 0x076D, 0x0A84, 0x0767, 0x0765, 0x055B, 0x00FF, 0x0761, 0x075F, 0x0549, 0x075D, 0x0543, 0x0541, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A7E, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x074D, 0x0664, 0x074B, 0x065E, 0x065C, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x064C, 0x064A, 0x0708, 0x00FF, 0x0646, 0x0644, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x0A74, 0x0888, 0x0A72, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A6C, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0B1F, 0x0A3C, 0x0866, 0x0A3A, 0x0A39, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x0A36, 0x0A35, 0x0828, 0x00FF, 0x0646, 0x0A33, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x0A2E, 0x0A2D, 0x0818, 0x00FF, 0x0761, 0x0A2B, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0A27, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A5A, 0x098B, 0x0989, 0x0676, 0x00FF, 0x0985, 0x0983, 0x0664, 0x0981, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x097D, 0x0652, 0x097B, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0973, 0x0971, 0x077F, 0x096F, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x096B, 0x076D, 0x0969, 0x0A1E, 0x0A1D, 0x0938, 0x00FF, 0x0761, 0x0A1B, 0x0934, 0x075D, 0x0932, 0x0931, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0963, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0A17, 0x092C, 0x074B, 0x092A, 0x0929, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0926, 0x0925, 0x0708, 0x00FF, 0x0646, 0x0923, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x0959, 0x0888, 0x0957, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0951, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0A0F, 0x091C, 0x0866, 0x091A, 0x0919, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x0916, 0x0915, 0x0828, 0x00FF, 0x0646, 0x0913, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x090E, 0x090D, 0x0818, 0x00FF, 0x0761, 0x090B, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0907, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0676, 0x00FF, 0x00FF, 0x00FF, 0x0664, 0x00FF, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x0652, 0x00FF, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x077F, 0x00FF, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x076D, 0x00FF, 0x0767, 0x0765, 0x055B, 0x00FF, 0x0761, 0x075F, 0x0549, 0x075D, 0x0543, 0x0541, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x074D, 0x0664, 0x074B, 0x065E, 0x065C, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x064C, 0x064A, 0x0708, 0x00FF, 0x0646, 0x0644, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x0888, 0x00FF, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0868, 0x0664, 0x0866, 0x065E, 0x065C, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x064C, 0x064A, 0x0828, 0x00FF, 0x0646, 0x0644, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x0767, 0x0765, 0x0818, 0x00FF, 0x0761, 0x075F, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x074D, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0C90, 0x098B, 0x0989, 0x0676, 0x00FF, 0x0985, 0x0983, 0x0664, 0x0981, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x097D, 0x0652, 0x097B, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0973, 0x0971, 0x077F, 0x096F, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x096B, 0x076D, 0x0969, 0x0767, 0x0765, 0x0938, 0x00FF, 0x0761, 0x075F, 0x0934, 0x075D, 0x0932, 0x0931, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0963, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x074D, 0x092C, 0x074B, 0x092A, 0x0929, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0926, 0x0925, 0x0708, 0x00FF, 0x0646, 0x0923, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x0959, 0x0888, 0x0957, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0951, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0868, 0x091C, 0x0866, 0x091A, 0x0919, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x0916, 0x0915, 0x0828, 0x00FF, 0x0646, 0x0913, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x090E, 0x090D, 0x0818, 0x00FF, 0x0761, 0x090B, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0907, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0676, 0x00FF, 0x00FF, 0x00FF, 0x0664, 0x00FF, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x0652, 0x00FF, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A8E, 0x0A8C, 0x077F, 0x0A8A, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0A86, 0x076D, 0x0A84, 0x0767, 0x0765, 0x055B, 0x00FF, 0x0761, 0x075F, 0x0549, 0x075D, 0x0543, 0x0541, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A7E, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x074D, 0x0664, 0x074B, 0x065E, 0x065C, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x064C, 0x064A, 0x0708, 0x00FF, 0x0646, 0x0644, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x0A74, 0x0888, 0x0A72, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A6C, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0C3F, 0x0A3C, 0x0866, 0x0A3A, 0x0A39, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x0A36, 0x0A35, 0x0828, 0x00FF, 0x0646, 0x0A33, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x0A2E, 0x0A2D, 0x0818, 0x00FF, 0x0761, 0x0A2B, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0A27, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A5A, 0x098B, 0x0989, 0x0676, 0x00FF, 0x0985, 0x0983, 0x0664, 0x0981, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x097D, 0x0652, 0x097B, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0973, 0x0971, 0x077F, 0x096F, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x096B, 0x076D, 0x0969, 0x0A1E, 0x0A1D, 0x0938, 0x00FF, 0x0761, 0x0A1B, 0x0934, 0x075D, 0x0932, 0x0931, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0963, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0A17, 0x092C, 0x074B, 0x092A, 0x0929, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0926, 0x0925, 0x0708, 0x00FF, 0x0646, 0x0923, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x0959, 0x0888, 0x0957, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0951, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0A0F, 0x091C, 0x0866, 0x091A, 0x0919, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x0916, 0x0915, 0x0828, 0x00FF, 0x0646, 0x0913, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x090E, 0x090D, 0x0818, 0x00FF, 0x0761, 0x090B, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0907, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0676, 0x00FF, 0x00FF, 0x00FF, 0x0664, 0x00FF, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x0652, 0x00FF, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x077F, 0x00FF, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x076D, 0x00FF, 0x0767, 0x0765, 0x055B, 0x00FF, 0x0761, 0x075F, 0x0549, 0x075D, 0x0543, 0x0541, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x074D, 0x0664, 0x074B, 0x065E, 0x065C, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x064C, 0x064A, 0x0708, 0x00FF, 0x0646, 0x0644, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x0B8F, 0x0888, 0x0B8D, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0B87, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0868, 0x0664, 0x0866, 0x065E, 0x065C, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x064C, 0x064A, 0x0828, 0x00FF, 0x0646, 0x0644, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x0767, 0x0765, 0x0818, 0x00FF, 0x0761, 0x075F, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x074D, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0B75, 0x098B, 0x0989, 0x0676, 0x00FF, 0x0985, 0x0983, 0x0664, 0x0981, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x097D, 0x0652, 0x097B, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0973, 0x0971, 0x077F, 0x096F, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x096B, 0x076D, 0x0969, 0x0B3E, 0x0B3D, 0x0938, 0x00FF, 0x0761, 0x0B3B, 0x0934, 0x075D, 0x0932, 0x0931, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0963, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0B37, 0x092C, 0x074B, 0x092A, 0x0929, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0926, 0x0925, 0x0708, 0x00FF, 0x0646, 0x0923, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x0959, 0x0888, 0x0957, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0951, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0B2F, 0x091C, 0x0866, 0x091A, 0x0919, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x0916, 0x0915, 0x0828, 0x00FF, 0x0646, 0x0913, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x090E, 0x090D, 0x0818, 0x00FF, 0x0761, 0x090B, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0907, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0676, 0x00FF, 0x00FF, 0x00FF, 0x0664, 0x00FF, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x0652, 0x00FF, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A8E, 0x0A8C, 0x077F, 0x0A8A, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0A86, 0x076D, 0x0A84, 0x0767, 0x0765, 0x055B, 0x00FF, 0x0761, 0x075F, 0x0549, 0x075D, 0x0543, 0x0541, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A7E, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x074D, 0x0664, 0x074B, 0x065E, 0x065C, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x064C, 0x064A, 0x0708, 0x00FF, 0x0646, 0x0644, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x0A74, 0x0888, 0x0A72, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A6C, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0B1F, 0x0A3C, 0x0866, 0x0A3A, 0x0A39, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x0A36, 0x0A35, 0x0828, 0x00FF, 0x0646, 0x0A33, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x0A2E, 0x0A2D, 0x0818, 0x00FF, 0x0761, 0x0A2B, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0A27, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x055B, 0x00FF, 0x00FF, 0x00FF, 0x0549, 0x00FF, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0A5A, 0x098B, 0x0989, 0x0676, 0x00FF, 0x0985, 0x0983, 0x0664, 0x0981, 0x065E, 0x065C, 0x0440,
+    0x00FF, 0x00FF, 0x097D, 0x0652, 0x097B, 0x064C, 0x064A, 0x055B, 0x00FF, 0x0646, 0x0644, 0x0549, 0x0642, 0x0543, 0x0541, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0973, 0x0971, 0x077F, 0x096F, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x096B, 0x076D, 0x0969, 0x0A1E, 0x0A1D, 0x0938, 0x00FF, 0x0761, 0x0A1B, 0x0934, 0x075D, 0x0932, 0x0931, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0963, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0A17, 0x092C, 0x074B, 0x092A, 0x0929, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0926, 0x0925, 0x0708, 0x00FF, 0x0646, 0x0923, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0440,
+    0x00FF, 0x00FF, 0x0959, 0x0888, 0x0957, 0x0882, 0x0880, 0x055B, 0x00FF, 0x087C, 0x087A, 0x0549, 0x0878, 0x0543, 0x0541, 0x0440,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0951, 0x0870, 0x086E, 0x0676, 0x00FF, 0x086A, 0x0A0F, 0x091C, 0x0866, 0x091A, 0x0919, 0x0830,
+    0x00FF, 0x00FF, 0x0862, 0x0652, 0x0860, 0x0916, 0x0915, 0x0828, 0x00FF, 0x0646, 0x0913, 0x0824, 0x0642, 0x0822, 0x0821, 0x0600,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0858, 0x0856, 0x077F, 0x0854, 0x0779, 0x0777, 0x0440,
+    0x00FF, 0x00FF, 0x0850, 0x076D, 0x084E, 0x090E, 0x090D, 0x0818, 0x00FF, 0x0761, 0x090B, 0x0814, 0x075D, 0x0812, 0x0811, 0x0720,
+    0x00FF, 0x00FF, 0x00FF, 0x00FF, 0x0848, 0x0755, 0x0753, 0x0676, 0x00FF, 0x074F, 0x0907, 0x080C, 0x074B, 0x080A, 0x0809, 0x0710,
+    0x00FF, 0x00FF, 0x0747, 0x0652, 0x0745, 0x0806, 0x0805, 0x0708, 0x00FF, 0x0646, 0x0803, 0x0704, 0x0642, 0x0702, 0x0701, 0x0600
+};
+
+inline constexpr unsigned char utf8to16_table_shuffle[145][16] = {
+    {0x00, 0x80, 0x01, 0x80, 0x02, 0x80, 0x03, 0x80, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x03, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x03, 0x80, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x03, 0x02, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x04, 0x03, 0x05, 0x80, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x04, 0x03, 0x05, 0x80, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x05, 0x04, 0x06, 0x80, 0x07, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x02, 0x80, 0x04, 0x03, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x03, 0x80, 0x05, 0x04, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x03, 0x80, 0x05, 0x04, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x04, 0x80, 0x06, 0x05, 0x07, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x03, 0x02, 0x05, 0x04, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x04, 0x03, 0x06, 0x05, 0x07, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x04, 0x03, 0x06, 0x05, 0x07, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x05, 0x04, 0x07, 0x06, 0x08, 0x80, 0x09, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x02, 0x80, 0x03, 0x80, 0x05, 0x04, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x03, 0x80, 0x04, 0x80, 0x06, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x03, 0x80, 0x04, 0x80, 0x06, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x04, 0x80, 0x05, 0x80, 0x07, 0x06, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x03, 0x02, 0x04, 0x80, 0x06, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x04, 0x03, 0x05, 0x80, 0x07, 0x06, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x04, 0x03, 0x05, 0x80, 0x07, 0x06, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x05, 0x04, 0x06, 0x80, 0x08, 0x07, 0x09, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x02, 0x80, 0x04, 0x03, 0x06, 0x05, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x03, 0x80, 0x05, 0x04, 0x07, 0x06, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x03, 0x80, 0x05, 0x04, 0x07, 0x06, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x04, 0x80, 0x06, 0x05, 0x08, 0x07, 0x09, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x03, 0x02, 0x05, 0x04, 0x07, 0x06, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x04, 0x03, 0x06, 0x05, 0x08, 0x07, 0x09, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x04, 0x03, 0x06, 0x05, 0x08, 0x07, 0x09, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x05, 0x04, 0x07, 0x06, 0x09, 0x08, 0x0A, 0x80, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x02, 0x80, 0x03, 0x80, 0x04, 0x80, 0x06, 0x05, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x03, 0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x06, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x03, 0x80, 0x04, 0x80, 0x05, 0x80, 0x07, 0x06, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x04, 0x80, 0x05, 0x80, 0x06, 0x80, 0x08, 0x07, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x03, 0x02, 0x04, 0x80, 0x05, 0x80, 0x07, 0x06, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x04, 0x03, 0x05, 0x80, 0x06, 0x80, 0x08, 0x07, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x04, 0x03, 0x05, 0x80, 0x06, 0x80, 0x08, 0x07, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x05, 0x04, 0x06, 0x80, 0x07, 0x80, 0x09, 0x08, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x02, 0x80, 0x04, 0x03, 0x05, 0x80, 0x07, 0x06, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x03, 0x80, 0x05, 0x04, 0x06, 0x80, 0x08, 0x07, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x03, 0x80, 0x05, 0x04, 0x06, 0x80, 0x08, 0x07, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x04, 0x80, 0x06, 0x05, 0x07, 0x80, 0x09, 0x08, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x03, 0x02, 0x05, 0x04, 0x06, 0x80, 0x08, 0x07, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x04, 0x03, 0x06, 0x05, 0x07, 0x80, 0x09, 0x08, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x04, 0x03, 0x06, 0x05, 0x07, 0x80, 0x09, 0x08, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x05, 0x04, 0x07, 0x06, 0x08, 0x80, 0x0A, 0x09, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x02, 0x80, 0x03, 0x80, 0x05, 0x04, 0x07, 0x06, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x03, 0x80, 0x04, 0x80, 0x06, 0x05, 0x08, 0x07, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x03, 0x80, 0x04, 0x80, 0x06, 0x05, 0x08, 0x07, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x04, 0x80, 0x05, 0x80, 0x07, 0x06, 0x09, 0x08, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x03, 0x02, 0x04, 0x80, 0x06, 0x05, 0x08, 0x07, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x04, 0x03, 0x05, 0x80, 0x07, 0x06, 0x09, 0x08, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x04, 0x03, 0x05, 0x80, 0x07, 0x06, 0x09, 0x08, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x05, 0x04, 0x06, 0x80, 0x08, 0x07, 0x0A, 0x09, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x02, 0x80, 0x04, 0x03, 0x06, 0x05, 0x08, 0x07, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x03, 0x80, 0x05, 0x04, 0x07, 0x06, 0x09, 0x08, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x03, 0x80, 0x05, 0x04, 0x07, 0x06, 0x09, 0x08, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x04, 0x80, 0x06, 0x05, 0x08, 0x07, 0x0A, 0x09, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x01, 0x80, 0x03, 0x02, 0x05, 0x04, 0x07, 0x06, 0x09, 0x08, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x02, 0x80, 0x04, 0x03, 0x06, 0x05, 0x08, 0x07, 0x0A, 0x09, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x02, 0x01, 0x04, 0x03, 0x06, 0x05, 0x08, 0x07, 0x0A, 0x09, 0x80, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x03, 0x02, 0x05, 0x04, 0x07, 0x06, 0x09, 0x08, 0x0B, 0x0A, 0x80, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x02, 0x01, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x03, 0x02, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x04, 0x03, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x03, 0x02, 0x01, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x04, 0x03, 0x02, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x05, 0x04, 0x03, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x03, 0x02, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x04, 0x03, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x05, 0x04, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x02, 0x01, 0x80, 0x80, 0x04, 0x03, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x03, 0x02, 0x80, 0x80, 0x05, 0x04, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x04, 0x03, 0x80, 0x80, 0x06, 0x05, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x03, 0x02, 0x01, 0x80, 0x05, 0x04, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x04, 0x03, 0x02, 0x80, 0x06, 0x05, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x05, 0x04, 0x03, 0x80, 0x07, 0x06, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x04, 0x03, 0x02, 0x80, 0x05, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x05, 0x04, 0x03, 0x80, 0x06, 0x80, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x06, 0x05, 0x04, 0x80, 0x07, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x02, 0x01, 0x80, 0x80, 0x05, 0x04, 0x03, 0x80, 0x06, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x03, 0x02, 0x80, 0x80, 0x06, 0x05, 0x04, 0x80, 0x07, 0x80, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x04, 0x03, 0x80, 0x80, 0x07, 0x06, 0x05, 0x80, 0x08, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x03, 0x02, 0x01, 0x80, 0x06, 0x05, 0x04, 0x80, 0x07, 0x80, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x04, 0x03, 0x02, 0x80, 0x07, 0x06, 0x05, 0x80, 0x08, 0x80, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x05, 0x04, 0x03, 0x80, 0x08, 0x07, 0x06, 0x80, 0x09, 0x80, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x04, 0x03, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x05, 0x04, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x06, 0x05, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x02, 0x01, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x05, 0x04, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x03, 0x02, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x06, 0x05, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x04, 0x03, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x07, 0x06, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x03, 0x02, 0x01, 0x80, 0x04, 0x80, 0x80, 0x80, 0x06, 0x05, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x04, 0x03, 0x02, 0x80, 0x05, 0x80, 0x80, 0x80, 0x07, 0x06, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x05, 0x04, 0x03, 0x80, 0x06, 0x80, 0x80, 0x80, 0x08, 0x07, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x03, 0x02, 0x80, 0x80, 0x05, 0x04, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x04, 0x03, 0x80, 0x80, 0x06, 0x05, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x05, 0x04, 0x80, 0x80, 0x07, 0x06, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x02, 0x01, 0x80, 0x80, 0x04, 0x03, 0x80, 0x80, 0x06, 0x05, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x03, 0x02, 0x80, 0x80, 0x05, 0x04, 0x80, 0x80, 0x07, 0x06, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x04, 0x03, 0x80, 0x80, 0x06, 0x05, 0x80, 0x80, 0x08, 0x07, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x03, 0x02, 0x01, 0x80, 0x05, 0x04, 0x80, 0x80, 0x07, 0x06, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x04, 0x03, 0x02, 0x80, 0x06, 0x05, 0x80, 0x80, 0x08, 0x07, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x05, 0x04, 0x03, 0x80, 0x07, 0x06, 0x80, 0x80, 0x09, 0x08, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x04, 0x03, 0x02, 0x80, 0x06, 0x05, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x05, 0x04, 0x03, 0x80, 0x07, 0x06, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x06, 0x05, 0x04, 0x80, 0x08, 0x07, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x02, 0x01, 0x80, 0x80, 0x05, 0x04, 0x03, 0x80, 0x07, 0x06, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x03, 0x02, 0x80, 0x80, 0x06, 0x05, 0x04, 0x80, 0x08, 0x07, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x04, 0x03, 0x80, 0x80, 0x07, 0x06, 0x05, 0x80, 0x09, 0x08, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x03, 0x02, 0x01, 0x80, 0x06, 0x05, 0x04, 0x80, 0x08, 0x07, 0x80, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x04, 0x03, 0x02, 0x80, 0x07, 0x06, 0x05, 0x80, 0x09, 0x08, 0x80, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x05, 0x04, 0x03, 0x80, 0x08, 0x07, 0x06, 0x80, 0x0A, 0x09, 0x80, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x05, 0x04, 0x03, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x06, 0x05, 0x04, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x07, 0x06, 0x05, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x02, 0x01, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x06, 0x05, 0x04, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x03, 0x02, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x07, 0x06, 0x05, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x04, 0x03, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x08, 0x07, 0x06, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x03, 0x02, 0x01, 0x80, 0x04, 0x80, 0x80, 0x80, 0x07, 0x06, 0x05, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x04, 0x03, 0x02, 0x80, 0x05, 0x80, 0x80, 0x80, 0x08, 0x07, 0x06, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x05, 0x04, 0x03, 0x80, 0x06, 0x80, 0x80, 0x80, 0x09, 0x08, 0x07, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x03, 0x02, 0x80, 0x80, 0x06, 0x05, 0x04, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x04, 0x03, 0x80, 0x80, 0x07, 0x06, 0x05, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x05, 0x04, 0x80, 0x80, 0x08, 0x07, 0x06, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x02, 0x01, 0x80, 0x80, 0x04, 0x03, 0x80, 0x80, 0x07, 0x06, 0x05, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x03, 0x02, 0x80, 0x80, 0x05, 0x04, 0x80, 0x80, 0x08, 0x07, 0x06, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x04, 0x03, 0x80, 0x80, 0x06, 0x05, 0x80, 0x80, 0x09, 0x08, 0x07, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x03, 0x02, 0x01, 0x80, 0x05, 0x04, 0x80, 0x80, 0x08, 0x07, 0x06, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x04, 0x03, 0x02, 0x80, 0x06, 0x05, 0x80, 0x80, 0x09, 0x08, 0x07, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x05, 0x04, 0x03, 0x80, 0x07, 0x06, 0x80, 0x80, 0x0A, 0x09, 0x08, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x04, 0x03, 0x02, 0x80, 0x07, 0x06, 0x05, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x05, 0x04, 0x03, 0x80, 0x08, 0x07, 0x06, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x03, 0x80, 0x80, 0x80, 0x06, 0x05, 0x04, 0x80, 0x09, 0x08, 0x07, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x02, 0x01, 0x80, 0x80, 0x05, 0x04, 0x03, 0x80, 0x08, 0x07, 0x06, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x03, 0x02, 0x80, 0x80, 0x06, 0x05, 0x04, 0x80, 0x09, 0x08, 0x07, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x04, 0x03, 0x80, 0x80, 0x07, 0x06, 0x05, 0x80, 0x0A, 0x09, 0x08, 0x80},
+    {0x00, 0x80, 0x80, 0x80, 0x03, 0x02, 0x01, 0x80, 0x06, 0x05, 0x04, 0x80, 0x09, 0x08, 0x07, 0x80},
+    {0x01, 0x00, 0x80, 0x80, 0x04, 0x03, 0x02, 0x80, 0x07, 0x06, 0x05, 0x80, 0x0A, 0x09, 0x08, 0x80},
+    {0x02, 0x01, 0x00, 0x80, 0x05, 0x04, 0x03, 0x80, 0x08, 0x07, 0x06, 0x80, 0x0B, 0x0A, 0x09, 0x80}
+};
+
+// Decodes one code point of valid UTF-8
+template<typename UTF16>
+inline std::size_t utf8to16_one(const unsigned char* s, UTF16* dst, std::size_t* written) noexcept
+{
+    const char32_t c = s[0];
+
+    if (c < 0x80)
+    {
+        dst[0] = static_cast<UTF16>(c);
+        *written = 1;
+        return 1;
+    }
+    if (c < 0xE0)
+    {
+        dst[0] = static_cast<UTF16>(((c & 0x1F) << 6) | (s[1] & 0x3Fu));
+        *written = 1;
+        return 2;
+    }
+    if (c < 0xF0)
+    {
+        dst[0] = static_cast<UTF16>(((c & 0x0F) << 12) | ((s[1] & 0x3Fu) << 6) | (s[2] & 0x3Fu));
+        *written = 1;
+        return 3;
+    }
+    const char32_t cp = ((c & 0x07) << 18) | ((s[1] & 0x3Fu) << 12) | ((s[2] & 0x3Fu) << 6) | (s[3] & 0x3Fu);
+    dst[0] = static_cast<UTF16>(0xD7C0 + (cp >> 10));
+    dst[1] = static_cast<UTF16>(0xDC00 + (cp & 0x3FF));
+    *written = 2;
+    return 4;
+}
+
+template<typename UTF16>
+uaiw_simd_target_ssse3 inline std::size_t utf8to16_ssse3(const unsigned char* s, std::size_t n,
+                                                        UTF16* dst, std::size_t dst_size, std::size_t* written) noexcept
+{
+    const __m128i pack_32_to_16 = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+
+    std::size_t i = 0; // Source position
+    std::size_t o = 0; // Destination position
+    while (i + 16 <= n)
+    {
+        // Validate a part that fits in L1 cache and then transcode it
+        const std::size_t valid = utf8_valid_prefix_bytes(s + i, (n - i < 4096) ? n - i : 4096);
+        if (valid == 0)
+            break;
+        const std::size_t end = i + valid;
+
+        // Stores are up to 16 code units so stop before the end of dst
+        while (i + 16 <= end && o + 16 <= dst_size)
+        {
+            const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+
+            if (_mm_movemask_epi8(input) == 0) // ASCII
+            {
+                ascii_widen_store_sse2(input, dst + o);
+                i += 16;
+                o += 16;
+                continue;
+            }
+
+            // Continuation bytes are 0x80-0xBF so they are less than -64 as signed
+            const __m128i cont = _mm_cmplt_epi8(input, _mm_set1_epi8(-64));
+            const unsigned int end_mask = (~static_cast<unsigned int>(_mm_movemask_epi8(cont)) >> 1) & 0xFFF;
+            const unsigned int index = utf8to16_table_index[end_mask] & 0xFFu;
+            const unsigned int consumed = utf8to16_table_index[end_mask] >> 8;
+
+            if (index < 64) // 6 code points of 1-2 bytes
+            {
+                const __m128i perm = _mm_shuffle_epi8(input,
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8to16_table_shuffle[index])));
+                const __m128i ascii = _mm_and_si128(perm, _mm_set1_epi16(0x7F));
+                const __m128i high = _mm_and_si128(perm, _mm_set1_epi16(0x1F00));
+                const __m128i composed = _mm_or_si128(ascii, _mm_srli_epi16(high, 2));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + o), composed);
+                i += consumed;
+                o += 6;
+            }
+            else if (index < 145) // 4 code points of 1-3 bytes
+            {
+                const __m128i perm = _mm_shuffle_epi8(input,
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8to16_table_shuffle[index])));
+                const __m128i ascii = _mm_and_si128(perm, _mm_set1_epi32(0x7F));
+                const __m128i middle = _mm_and_si128(perm, _mm_set1_epi32(0x3F00));
+                const __m128i high = _mm_and_si128(perm, _mm_set1_epi32(0x0F0000));
+                const __m128i composed = _mm_or_si128(_mm_or_si128(ascii, _mm_srli_epi32(middle, 2)),
+                                                      _mm_srli_epi32(high, 4));
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + o), _mm_shuffle_epi8(composed, pack_32_to_16));
+                i += consumed;
+                o += 4;
+            }
+            else // 4-byte sequence
+            {
+                std::size_t w = 0;
+                i += utf8to16_one(s + i, dst + o, &w);
+                o += w;
+            }
+        }
+
+        // The tail of the valid part
+        while (i < end && o + 2 <= dst_size)
+        {
+            std::size_t w = 0;
+            i += utf8to16_one(s + i, dst + o, &w);
+            o += w;
+        }
+        if (i < end)
+            break;
+    }
+
+    *written = o;
+    return i;
+}
+
+inline bool utf8to16_ssse3_available() noexcept
+{
+#ifdef __SSSE3__
+    return true;
+#else
+    return x86_level() != level::none;
+#endif
+}
+
+#endif // uaiw_simd_x86
+
+// Returns the length of the UTF-8 prefix that was transcoded to UTF-16 and the number of
+// code units written, never writes more than dst_size code units.
+// The prefix always ends on a code point boundary and low-level must be used after it.
+template<typename UTF16>
+inline std::size_t utf8to16_bytes(const unsigned char* s, std::size_t n,
+                                  UTF16* dst, std::size_t dst_size, std::size_t* written) noexcept
+{
+#if defined(uaiw_simd_x86)
+    if (utf8to16_ssse3_available())
+        return utf8to16_ssse3(s, n, dst, dst_size, written);
+#endif
+    *written = ascii_widen_bytes(s, (n < dst_size) ? n : dst_size, dst);
+    return *written;
+}
+
+// Returns the position where utf8to16_bytes can be used again after low-level.
+// Low-level must get at least the whole block where the transcoder stopped so skip 2 blocks
+// and find the next code point boundary.
+inline std::size_t utf8to16_next_bytes(const unsigned char* s, std::size_t n) noexcept
+{
+#if defined(uaiw_simd_x86)
+    if (utf8to16_ssse3_available())
+    {
+        for (std::size_t i = 32; i + 16 <= n; ++i)
+        {
+            if ((s[i] & 0xC0) != 0x80)
+                return i;
+        }
+        return n;
+    }
+#endif
+    return ascii_next_bytes(s, n);
+}
+
+// Counting of the result length for the exact size conversion.
+// Only valid parts are counted here, everything else is counted by low-level.
+
+#if defined(uaiw_simd_x86)
+
+// The number of code points in valid UTF-8 and also the number of 4-byte sequences if utf16
+// because they take 2 code units in UTF-16, byte counters are summed up before they can overflow
+inline std::size_t utf8_count_sse2(const unsigned char* s, std::size_t n, bool utf16) noexcept
+{
+    std::size_t count = 0;
+    std::size_t i = 0;
+    while (i + 16 <= n)
+    {
+        __m128i acc = _mm_setzero_si128();
+        for (std::size_t k = 0; k < 127 && i + 16 <= n; ++k, i += 16)
+        {
+            const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+            // Everything except continuation bytes 0x80-0xBF, mask is -1 so subtract it
+            acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(input, _mm_set1_epi8(-65)));
+            if (utf16) // 4-byte leads 0xF0-0xF4
+                acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(_mm_max_epu8(input, _mm_set1_epi8(-16)), input));
+        }
+        const __m128i sum = _mm_sad_epu8(acc, _mm_setzero_si128());
+        count += static_cast<std::size_t>(_mm_cvtsi128_si64(sum)) +
+                 static_cast<std::size_t>(_mm_cvtsi128_si64(_mm_unpackhi_epi64(sum, sum)));
+    }
+    for (; i < n; ++i)
+    {
+        if ((s[i] & 0xC0) != 0x80)
+            ++count;
+        if (utf16 && s[i] >= 0xF0)
+            ++count;
+    }
+    return count;
+}
+
+// The number of UTF-8 code units for UTF-16 blocks of 8 code units without surrogates,
+// every code unit takes 3 bytes minus 1 if it is < 0x800 minus 1 more if it is < 0x80.
+// Returns the length of the counted prefix.
+template<typename UTF16>
+inline std::size_t utf16to8_count_sse2(const UTF16* s, std::size_t n, std::size_t* count) noexcept
+{
+    static_assert(sizeof(UTF16) == sizeof(char16_t));
+
+    std::size_t i = 0;
+    bool surrogate = false;
+    while (!surrogate && i + 8 <= n)
+    {
+        __m128i acc = _mm_setzero_si128();
+        std::size_t k = 0;
+        for (; k < 8192 && i + 8 <= n; ++k, i += 8)
+        {
+            const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+            const __m128i high = _mm_and_si128(input, _mm_set1_epi16(static_cast<short>(0xF800)));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_set1_epi16(static_cast<short>(0xD800)))) != 0)
+            {
+                surrogate = true;
+                break;
+            }
+            const __m128i less_800 = _mm_cmpeq_epi16(high, _mm_setzero_si128());
+            const __m128i less_80 = _mm_cmpeq_epi16(_mm_and_si128(input, _mm_set1_epi16(static_cast<short>(0xFF80))),
+                                                    _mm_setzero_si128());
+            acc = _mm_add_epi16(acc, _mm_add_epi16(less_800, less_80));
+        }
+        // The lanes are negative and fit in 16-bit so sum them up as signed
+        __m128i sum = _mm_madd_epi16(acc, _mm_set1_epi16(1));
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+        *count += k * 24 - static_cast<std::size_t>(-_mm_cvtsi128_si32(sum));
+    }
+    return i;
+}
+
+#elif defined(uaiw_simd_neon)
+
+inline std::size_t utf8_count_neon(const unsigned char* s, std::size_t n, bool utf16) noexcept
+{
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        const uint8x16_t input = vld1q_u8(s + i);
+        // Everything except continuation bytes 0x80-0xBF
+        count += vaddvq_u8(vshrq_n_u8(vcgtq_s8(vreinterpretq_s8_u8(input), vdupq_n_s8(-65)), 7));
+        if (utf16) // 4-byte leads 0xF0-0xF4
+            count += vaddvq_u8(vshrq_n_u8(vcgeq_u8(input, vdupq_n_u8(0xF0)), 7));
+    }
+    for (; i < n; ++i)
+    {
+        if ((s[i] & 0xC0) != 0x80)
+            ++count;
+        if (utf16 && s[i] >= 0xF0)
+            ++count;
+    }
+    return count;
+}
+
+template<typename UTF16>
+inline std::size_t utf16to8_count_neon(const UTF16* s, std::size_t n, std::size_t* count) noexcept
+{
+    static_assert(sizeof(UTF16) == sizeof(char16_t));
+
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        uint16x8_t input;
+        std::memcpy(&input, s + i, 16);
+        const uint16x8_t high = vandq_u16(input, vdupq_n_u16(0xF800));
+        if (vmaxvq_u16(vceqq_u16(high, vdupq_n_u16(0xD800))) != 0)
+            break;
+        const uint16x8_t less_800 = vshrq_n_u16(vceqzq_u16(high), 15);
+        const uint16x8_t less_80 = vshrq_n_u16(vceqzq_u16(vandq_u16(input, vdupq_n_u16(0xFF80))), 15);
+        *count += 24u - vaddvq_u16(vaddq_u16(less_800, less_80));
+    }
+    return i;
+}
+
+#endif
+
+// Returns the length of the valid UTF-8 prefix that was counted and adds to count
+// the number of UTF-16 (if utf16) or UTF-32 code units of its result.
+inline std::size_t utf8_count_bytes(const unsigned char* s, std::size_t n, bool utf16, std::size_t* count) noexcept
+{
+    std::size_t i = 0;
+    while (i + 16 <= n)
+    {
+        const std::size_t valid = utf8_valid_prefix_bytes(s + i, (n - i < 4096) ? n - i : 4096);
+        if (valid == 0)
+            break;
+#if defined(uaiw_simd_x86)
+        *count += utf8_count_sse2(s + i, valid, utf16);
+#elif defined(uaiw_simd_neon)
+        *count += utf8_count_neon(s + i, valid, utf16);
+#else
+        (void)utf16;
+        (void)count;
+#endif
+        i += valid;
+    }
+    return i;
+}
+
+// Returns the position where utf8_count_bytes can be used again after low-level,
+// the same as utf8to16_next_bytes but for the validator.
+inline std::size_t utf8_count_next_bytes(const unsigned char* s, std::size_t n) noexcept
+{
+#if defined(uaiw_simd_x86) || defined(uaiw_simd_neon)
+#  if defined(uaiw_simd_x86)
+    if (!utf8to16_ssse3_available())
+        return n;
+#  endif
+    for (std::size_t i = 32; i + 16 <= n; ++i)
+    {
+        if ((s[i] & 0xC0) != 0x80)
+            return i;
+    }
+#else
+    (void)s;
+#endif
+    return n;
+}
+
+// Returns the length of the UTF-16 prefix that was counted and adds to count
+// the number of UTF-8 code units of its result.
+template<typename UTF16>
+inline std::size_t utf16to8_count(const UTF16* s, std::size_t n, std::size_t* count) noexcept
+{
+#if defined(uaiw_simd_x86)
+    return utf16to8_count_sse2(s, n, count);
+#elif defined(uaiw_simd_neon)
+    return utf16to8_count_neon(s, n, count);
+#else
+    (void)s;
+    (void)n;
+    (void)count;
+    return 0;
+#endif
+}
+
+// Returns the position where utf16to8_count can be used again after low-level.
+// Low-level must get at least the whole block where counting stopped and never split a surrogate pair.
+template<typename UTF16>
+inline std::size_t utf16to8_count_next(const UTF16* s, std::size_t n) noexcept
+{
+#if defined(uaiw_simd_x86) || defined(uaiw_simd_neon)
+    for (std::size_t i = 8; i + 8 <= n; ++i)
+    {
+        if ((static_cast<unsigned int>(s[i]) & 0xFC00u) != 0xDC00u)
+            return i;
+    }
+#else
+    (void)s;
+#endif
+    return n;
+}
+
+template<typename UTF8>
+inline const unsigned char* bytes(const UTF8* s) noexcept
+{
+    static_assert(sizeof(UTF8) == sizeof(char));
+
+    return static_cast<const unsigned char*>(static_cast<const void*>(s));
+}
+
+template<typename UTF8>
+uaiw_constexpr std::size_t utf8_valid_prefix(const UTF8* s, std::size_t n) noexcept
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+#ifdef UNI_ALGO_CONSTEXPR
+    if (std::is_constant_evaluated())
+        return 0;
+#endif
+    if constexpr (sizeof(UTF8) == sizeof(char))
+        return utf8_valid_prefix_bytes(bytes(s), n);
+    else
+        return 0;
+}
+
+template<typename UTF8>
+uaiw_constexpr std::size_t ascii_prefix(const UTF8* s, std::size_t n) noexcept
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+#ifdef UNI_ALGO_CONSTEXPR
+    if (std::is_constant_evaluated())
+        return 0;
+#endif
+    if constexpr (sizeof(UTF8) == sizeof(char))
+        return ascii_prefix_bytes(bytes(s), n);
+    else
+        return 0;
+}
+
+template<typename UTF8>
+uaiw_constexpr std::size_t ascii_case(const UTF8* s, std::size_t n, UTF8* dst, bool upper) noexcept
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+#ifdef UNI_ALGO_CONSTEXPR
+    if (std::is_constant_evaluated())
+        return 0;
+#endif
+    if constexpr (sizeof(UTF8) == sizeof(char))
+        return ascii_case_bytes(bytes(s), n, static_cast<unsigned char*>(static_cast<void*>(dst)), upper);
+    else
+        return 0;
+}
+
+template<typename UTF8, typename UTFX>
+inline constexpr bool utf8to_types = std::is_integral_v<UTF8> && std::is_integral_v<UTFX> &&
+    sizeof(UTF8) == sizeof(char) && (sizeof(UTFX) == sizeof(char16_t) || sizeof(UTFX) == sizeof(char32_t));
+
+// UTF-8 -> UTF-16 uses the transcoder and UTF-8 -> UTF-32 uses only ASCII fast path
+// The fast path never writes more than dst_size code units to dst, so dst can be of the exact size.
+template<typename UTF8, typename UTFX>
+uaiw_constexpr std::size_t utf8to(const UTF8* s, std::size_t n, UTFX* dst, std::size_t dst_size, std::size_t* written) noexcept
+{
+    *written = 0;
+
+#ifdef UNI_ALGO_CONSTEXPR
+    if (std::is_constant_evaluated())
+        return 0;
+#endif
+    if constexpr (utf8to_types<UTF8, UTFX> && sizeof(UTFX) == sizeof(char16_t))
+        return utf8to16_bytes(bytes(s), n, dst, dst_size, written);
+    else if constexpr (utf8to_types<UTF8, UTFX>)
+    {
+        *written = ascii_widen_bytes(bytes(s), (n < dst_size) ? n : dst_size, dst);
+        return *written;
+    }
+    else
+        return 0;
+}
+
+template<typename UTF8, typename UTFX>
+uaiw_constexpr std::size_t utf8to_next(const UTF8* s, std::size_t n) noexcept
+{
+#ifdef UNI_ALGO_CONSTEXPR
+    if (std::is_constant_evaluated())
+        return n;
+#endif
+    if constexpr (utf8to_types<UTF8, UTFX> && sizeof(UTFX) == sizeof(char16_t))
+        return utf8to16_next_bytes(bytes(s), n);
+    else if constexpr (utf8to_types<UTF8, UTFX>)
+        return ascii_next_bytes(bytes(s), n);
+    else
+        return n;
+}
+
+// Counting is used for UTF-8 -> UTF-16/UTF-32 and UTF-16 -> UTF-8
+template<typename Src, typename Dst>
+inline constexpr bool count_types = std::is_integral_v<Src> && std::is_integral_v<Dst> &&
+    ((sizeof(Src) == sizeof(char) && (sizeof(Dst) == sizeof(char16_t) || sizeof(Dst) == sizeof(char32_t))) ||
+     (sizeof(Src) == sizeof(char16_t) && sizeof(Dst) == sizeof(char)));
+
+// Returns the length of the prefix that was counted and adds the length of its result to count
+template<typename Src, typename Dst>
+uaiw_constexpr std::size_t count_prefix(const Src* s, std::size_t n, std::size_t* count) noexcept
+{
+#ifdef UNI_ALGO_CONSTEXPR
+    if (std::is_constant_evaluated())
+        return 0;
+#endif
+    if constexpr (count_types<Src, Dst> && sizeof(Src) == sizeof(char))
+        return utf8_count_bytes(bytes(s), n, sizeof(Dst) == sizeof(char16_t), count);
+    else if constexpr (count_types<Src, Dst>)
+        return utf16to8_count(s, n, count);
+    else
+    {
+        (void)s;
+        (void)n;
+        (void)count;
+        return 0;
+    }
+}
+
+template<typename Src, typename Dst>
+uaiw_constexpr std::size_t count_prefix_next(const Src* s, std::size_t n) noexcept
+{
+#ifdef UNI_ALGO_CONSTEXPR
+    if (std::is_constant_evaluated())
+        return n;
+#endif
+    if constexpr (count_types<Src, Dst> && sizeof(Src) == sizeof(char))
+        return utf8_count_next_bytes(bytes(s), n);
+    else if constexpr (count_types<Src, Dst>)
+        return utf16to8_count_next(s, n);
+    else
+    {
+        (void)s;
+        return n;
+    }
+}
+
+} // namespace una::detail::simd
+
+#endif // UNI_ALGO_INTERNAL_SIMD_H_UAIH
@@ -12,9 +12,13 @@
 #include <string>
 #include <string_view>
 #include <iterator> // std::back_insert_iterator
+#include <vector>
 
 #include "config.h"
 #include "internal/safe_layer.h"
+#include "internal/bounded.h"
+#include "internal/simd.h"
+#include "internal/search.h"
 
 #include "impl/impl_norm.h"
 
@@ -72,6 +76,60 @@ uaiw_constexpr Dst t_norm(const Alloc& alloc, const Src& src)
     return dst;
 }
 
+// Append normalization: the result is appended to an existing string so its capacity is reused,
+// the string is never shrunk. Returns the number of code units appended.
+
+template<typename Dst, typename Src, size_t SizeX,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnNorm)(typename Src::const_iterator, typename Src::const_iterator, typename Dst::iterator)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnNorm)(typename Src::const_pointer, typename Src::const_pointer, typename Dst::pointer)>
+#else // Safe layer
+    size_t(*FnNorm)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, safe::out<typename Dst::pointer>)>
+#endif
+uaiw_constexpr std::size_t t_norm_append(Dst& dst, const Src& src)
+{
+    const std::size_t length = src.size();
+    const std::size_t size = dst.size();
+
+    if (!length)
+        return 0;
+
+    if (length > (dst.max_size() - size) / SizeX) // Overflow protection
+    {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+
+    std::size_t written = 0;
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    dst.resize(size + length * SizeX);
+    written = FnNorm(src.cbegin(), src.cend(), dst.begin() + static_cast<std::ptrdiff_t>(size));
+    dst.resize(size + written);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    dst.resize(size + length * SizeX);
+    written = FnNorm(src.data(), src.data() + src.size(), dst.data() + size);
+    dst.resize(size + written);
+#else // Safe layer
+#  if !defined(__cpp_lib_string_resize_and_overwrite)
+    dst.resize(size + length * SizeX);
+    written = FnNorm(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, safe::out{dst.data() + size, length * SizeX});
+    dst.resize(size + written);
+#  else
+    dst.resize_and_overwrite(size + length * SizeX, [&src, &written, size](Dst::pointer p, std::size_t n) noexcept -> std::size_t {
+        written = FnNorm(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, safe::out{p + size, n - size});
+        return size + written;
+    });
+#  endif
+#endif
+
+    return written;
+}
+
 // For NFKC and NFKD it is ineffective to preallocate a string because max decomposition is 11/18
 // in these forms, so we are using back_inserter for these normalization forms.
 // Our functions are designed to work with most C++ iterators but sometimes proxy iterators are needed.
@@ -144,12 +202,476 @@ uaiw_constexpr Dst t_norm2(const Alloc& alloc, const Src& src)
     return dst;
 }
 
+template<typename Dst, typename Src,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnNorm)(typename Src::const_iterator, typename Src::const_iterator, proxy_it_out<std::back_insert_iterator<Dst>>)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnNorm)(typename Src::const_pointer, typename Src::const_pointer, proxy_it_out<std::back_insert_iterator<Dst>>)>
+#else // Safe layer
+    size_t(*FnNorm)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, proxy_it_out<std::back_insert_iterator<Dst>>)>
+#endif
+uaiw_constexpr std::size_t t_norm2_append(Dst& dst, const Src& src)
+{
+    const std::size_t length = src.size();
+    const std::size_t size = dst.size();
+
+    if (!length)
+        return 0;
+
+    if (length > (dst.max_size() - size) / 3) // Overflow protection
+    {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+
+    dst.reserve(size + length * 3 / 2);
+
+    const proxy_it_out<std::back_insert_iterator<Dst>> it_out{std::back_inserter(dst)};
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    FnNorm(src.cbegin(), src.cend(), it_out);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    FnNorm(src.data(), src.data() + src.size(), it_out);
+#else // Safe layer
+    FnNorm(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, it_out);
+#endif
+
+    return dst.size() - size;
+}
+
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
+#ifndef UNI_ALGO_DISABLE_CASE
+#ifndef UNI_ALGO_DISABLE_PROP
+
+// The same as t_norm2 and t_norm2_append but with a mode, the result can grow a lot with compatibility mode
+
+template<typename Dst, typename Alloc, typename Src,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnNorm)(typename Src::const_iterator, typename Src::const_iterator, proxy_it_out<std::back_insert_iterator<Dst>>, int)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnNorm)(typename Src::const_pointer, typename Src::const_pointer, proxy_it_out<std::back_insert_iterator<Dst>>, int)>
+#else // Safe layer
+    size_t(*FnNorm)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, proxy_it_out<std::back_insert_iterator<Dst>>, int)>
+#endif
+uaiw_constexpr Dst t_norm_mode(const Alloc& alloc, const Src& src, int mode)
+{
+    Dst dst{alloc};
+
+    const std::size_t length = src.size();
+
+    if (length)
+    {
+        if (length > dst.max_size() / 3) // Overflow protection
+        {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+            throw std::bad_alloc();
+#else
+            std::abort();
+#endif
+        }
+
+        dst.reserve(length * 3 / 2);
+
+        const proxy_it_out<std::back_insert_iterator<Dst>> it_out{std::back_inserter(dst)};
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+        FnNorm(src.cbegin(), src.cend(), it_out, mode);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+        FnNorm(src.data(), src.data() + src.size(), it_out, mode);
+#else // Safe layer
+        FnNorm(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, it_out, mode);
+#endif
+
+#ifndef UNI_ALGO_DISABLE_SHRINK_TO_FIT
+        dst.shrink_to_fit();
+#endif
+    }
+
+    return dst;
+}
+
+template<typename Dst, typename Src,
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnNorm)(typename Src::const_iterator, typename Src::const_iterator, proxy_it_out<std::back_insert_iterator<Dst>>, int)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnNorm)(typename Src::const_pointer, typename Src::const_pointer, proxy_it_out<std::back_insert_iterator<Dst>>, int)>
+#else // Safe layer
+    size_t(*FnNorm)(safe::in<typename Src::const_pointer>, safe::end<typename Src::const_pointer>, proxy_it_out<std::back_insert_iterator<Dst>>, int)>
+#endif
+uaiw_constexpr std::size_t t_norm_mode_append(Dst& dst, const Src& src, int mode)
+{
+    const std::size_t length = src.size();
+    const std::size_t size = dst.size();
+
+    if (!length)
+        return 0;
+
+    if (length > (dst.max_size() - size) / 3) // Overflow protection
+    {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || (_HAS_EXCEPTIONS != 0)
+        throw std::bad_alloc();
+#else
+        std::abort();
+#endif
+    }
+
+    dst.reserve(size + length * 3 / 2);
+
+    const proxy_it_out<std::back_insert_iterator<Dst>> it_out{std::back_inserter(dst)};
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    FnNorm(src.cbegin(), src.cend(), it_out, mode);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    FnNorm(src.data(), src.data() + src.size(), it_out, mode);
+#else // Safe layer
+    FnNorm(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, it_out, mode);
+#endif
+
+    return dst.size() - size;
+}
+
+#endif // UNI_ALGO_DISABLE_PROP
+#endif // UNI_ALGO_DISABLE_CASE
+
+// Bounded normalization: see t_bounded in internal/bounded.h, a boundary is before a code point
+// with Canonical_Combining_Class=0 and NFC/NFKC_Quick_Check=Yes, such code point and its decomposition
+// cannot be reordered or composed with anything before it so a string can be split there.
+// Code points with initial non-starters in NFKD (U+FF9E for example) are not boundaries even if they are
+// starters because they don't reset the count of non-starters for Stream-Safe Text Process.
+// The same is used for NFD/NFKD because NFD/NFKD_Quick_Check=No for most of the letters with accents.
+
+template<typename Src, typename Dst, std::size_t SrcUTF, bool(*FnQC)(type_codept),
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    size_t(*FnNorm)(typename std::basic_string_view<Src>::const_iterator, typename std::basic_string_view<Src>::const_iterator, Dst*)>
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    size_t(*FnNorm)(const Src*, const Src*, Dst*)>
+#else // Safe layer
+    size_t(*FnNorm)(safe::in<const Src*>, safe::end<const Src*>, safe::out<Dst*>)>
+#endif
+struct norm_bounded
+{
+    // The max size of a segment returned by next() in Stream-Safe Text Format: a starter and 30 non-starters,
+    // longer segments are possible only in other text (a lot of non-starters or starters that are not boundaries)
+    static constexpr std::size_t max_segment = (SrcUTF == 8 ? 4 : 2) * (1 + impl_max_norm_non_starters);
+
+    // Returns the position after the first code point and checks if a boundary is before it
+    static uaiw_constexpr std::size_t boundary_before(const Src* s, std::size_t n, bool* is_boundary)
+    {
+        type_codept c = 0;
+        const Src* it = s;
+        if constexpr (SrcUTF == 8)
+            it = inline_iter_utf8(s, s + n, &c, impl_iter_replacement);
+        else
+            it = inline_iter_utf16(s, s + n, &c, impl_iter_replacement);
+
+        const type_codept prop = impl_norm_get_prop(c);
+        *is_boundary = impl_norm_get_ccc_prop(prop) == 0 && !impl_norm_is_ns_prop(prop) && FnQC(prop);
+        return static_cast<std::size_t>(it - s);
+    }
+    static uaiw_constexpr std::size_t boundary(const Src* s, std::size_t i, std::size_t n)
+    {
+        // Look back a few code units only, if there is no boundary the next piece is used
+        for (std::size_t p = i; p > 0 && i - p < 32; --p)
+        {
+            bool is_boundary = false;
+            if (utf_tail<SrcUTF>(s, p) == 0)
+                boundary_before(s + p, n - p, &is_boundary);
+            if (is_boundary)
+                return p;
+        }
+        return 0;
+    }
+    static uaiw_constexpr std::size_t next(const Src* s, std::size_t n)
+    {
+        bool is_boundary = false;
+        std::size_t p = boundary_before(s, n, &is_boundary);
+        while (p < n)
+        {
+            const std::size_t size = boundary_before(s + p, n - p, &is_boundary);
+            if (is_boundary)
+                break;
+            p += size;
+        }
+        return p;
+    }
+    // Returns a boundary near i: the last one a few code units before i or the first one after it
+    static uaiw_constexpr std::size_t split(const Src* s, std::size_t n, std::size_t i)
+    {
+        const std::size_t p = boundary(s, i, n);
+        if (p != 0)
+            return p;
+        const std::size_t q = i - utf_tail<SrcUTF>(s, i);
+        return q + next(s + q, n - q);
+    }
+    static uaiw_constexpr std::size_t process(const Src* s, std::size_t n, Dst* dst, std::size_t dst_size, std::size_t* /*error*/)
+    {
+        const std::basic_string_view<Src> src{s, n};
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+        (void)dst_size;
+        return FnNorm(src.cbegin(), src.cend(), dst);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+        (void)dst_size;
+        return FnNorm(src.data(), src.data() + src.size(), dst);
+#else // Safe layer
+        return FnNorm(safe::in{src.data(), src.size()}, safe::end{src.data() + src.size()}, safe::out{dst, dst_size});
+#endif
+    }
+};
+
+// Quick check first normalization: the same check as impl_norm_is_nf*_utf8/16 but it also remembers
+// the last boundary (see above) so it returns the length of the prefix that is already normalized
+// and can be split from the rest, the prefix is the whole source if the source is already normalized.
+// Non-starters are counted the same way as in normalization functions so the prefix also ends before
+// a run of non-starters where U+034F would be inserted by Stream-Safe Text Process, and a code point
+// with initial non-starters in NFKD is never a boundary because it doesn't reset the count.
+// ASCII is skipped by SIMD for UTF-8 because ASCII is normalized in all normalization forms.
+template<typename Src, std::size_t SrcUTF, bool(*FnQC)(type_codept)>
+uaiw_constexpr std::size_t norm_prefix(const Src* s, std::size_t n)
+{
+    std::size_t p = 0;
+    if constexpr (SrcUTF == 8)
+        p = simd::ascii_prefix(s, n);
+
+    // The last skipped ASCII can be composed with the next code point so the boundary is before it
+    std::size_t boundary = p ? p - 1 : 0;
+    unsigned char last_ccc = 0;
+    std::size_t count_ns = 0;
+
+    while (p < n)
+    {
+        type_codept c = 0;
+        const Src* it = s + p;
+        if constexpr (SrcUTF == 8)
+            it = inline_iter_utf8(s + p, s + n, &c, impl_iter_error);
+        else
+            it = inline_iter_utf16(s + p, s + n, &c, impl_iter_error);
+
+        if (c < 0x00A0) // NFKD lower bound, see stages_qc_yes_ns_nfc in low-level
+        {
+            boundary = p;
+            last_ccc = 0;
+            count_ns = 0;
+        }
+        else
+        {
+            if (c == impl_iter_error) // Ill-formed sequences are never normalized
+                return boundary;
+
+            const type_codept prop = impl_norm_get_prop(c);
+            const unsigned char ccc = impl_norm_get_ccc_prop(prop);
+            if (impl_norm_count_ns_prop(prop, &count_ns))
+                return boundary;
+            if ((last_ccc > ccc && ccc != 0) || !FnQC(prop))
+                return boundary;
+            if (ccc == 0 && !impl_norm_is_ns_prop(prop))
+                boundary = p;
+            last_ccc = ccc;
+        }
+        p = static_cast<std::size_t>(it - s);
+    }
+    return n;
+}
+
+// Normalization with an offset map: the normalized prefix found by norm_prefix is copied as is and recorded
+// as one copied span, the rest up to the next boundary (see norm_bounded) is normalized separately and recorded
+// as one changed span, so every span in the map can be normalized on its own with the same result.
+// FnNormAppend is the normal append function fn(std::basic_string_view<Src>, Dst&).
+template<typename Src, std::size_t SrcUTF, bool(*FnQC)(type_codept), class Traits,
+         typename Dst, class Map, class FnNormAppend>
+uaiw_constexpr void t_norm_mapped(std::basic_string_view<Src> source, Dst& dst, Map& map, FnNormAppend fn)
+{
+    map.clear();
+
+    const Src* s = source.data();
+    const std::size_t n = source.size();
+
+    std::size_t p = 0;
+    while (p < n)
+    {
+        const std::size_t prefix = norm_prefix<Src, SrcUTF, FnQC>(s + p, n - p);
+        if (prefix > 0)
+        {
+            dst.append(s + p, prefix);
+            map.append(prefix, prefix, true);
+            p += prefix;
+        }
+        if (p == n)
+            break;
+
+        const std::size_t size = Traits::next(s + p, n - p);
+        const std::size_t dst_size = dst.size();
+        fn(source.substr(p, size), dst);
+        // The span can be the same after normalization when the boundaries of the forms are different
+        const bool copied = dst.size() - dst_size == size &&
+            std::basic_string_view<Src>{dst.data() + dst_size, size} == source.substr(p, size);
+        map.append(size, dst.size() - dst_size, copied);
+        p += size;
+    }
+}
+
+// Streaming normalization: chunks are pushed to the stream and the normalized result is given to a sink
+// as soon as it cannot be changed by the next code points anymore, so only the last unstable segment
+// is held back in the normalization buffer (the same as in normalization views) and memory is bounded.
+// An incomplete sequence at the end of a chunk is carried over to the next chunk the same way as in
+// conv_stream so chunks can be split anywhere and the result is always the same as the result for the whole.
+// UTF is the code unit type for both input and output: UTF-8, UTF-16 or UTF-32 by its size.
+// Ill-formed sequences are replaced with U+FFFD.
+template<typename UTF, bool(*FnNorm)(impl_norm_iter_state*, type_codept), bool(*FnNext)(impl_norm_iter_state*, type_codept*)>
+class norm_stream
+{
+    static_assert(std::is_integral_v<UTF>);
+
+private:
+    static constexpr std::size_t utf = (sizeof(UTF) == sizeof(char)) ? 8 : (sizeof(UTF) == sizeof(char16_t)) ? 16 : 32;
+    static constexpr std::size_t max_carry = (utf == 8) ? 3 : (utf == 16) ? 1 : 0;
+    static constexpr std::size_t max_out = 256; // The result is given to the sink by pieces of this size at most
+
+    impl_norm_iter_state state{};
+    UTF carry[max_carry + 1] = {};
+    std::size_t carry_size = 0;
+    UTF out[max_out] = {};
+    std::size_t out_size = 0;
+
+    template<class Sink>
+    uaiw_constexpr void flush(Sink& sink)
+    {
+        if (out_size)
+        {
+            sink(std::basic_string_view<UTF>{out, out_size});
+            out_size = 0;
+        }
+    }
+    template<class Sink>
+    uaiw_constexpr void emit(type_codept c, Sink& sink)
+    {
+        if (out_size > max_out - 4)
+            flush(sink);
+
+        if constexpr (utf == 8)
+            out_size = static_cast<std::size_t>(codepoint_to_utf8(c, out + out_size) - out);
+        else if constexpr (utf == 16)
+            out_size = static_cast<std::size_t>(codepoint_to_utf16(c, out + out_size) - out);
+        else
+            out[out_size++] = static_cast<UTF>(c);
+    }
+    template<class Sink>
+    uaiw_constexpr void push(const UTF* s, std::size_t n, Sink& sink)
+    {
+        for (const UTF* it = s; it != s + n;)
+        {
+            type_codept c = 0;
+            if constexpr (utf == 8)
+                it = inline_iter_utf8(it, s + n, &c, impl_iter_replacement);
+            else if constexpr (utf == 16)
+                it = inline_iter_utf16(it, s + n, &c, impl_iter_replacement);
+            else
+                c = static_cast<type_codept>(*it++);
+
+            // The buffer is ready when the code point cannot change it anymore, give all of it to the sink
+            if (FnNorm(&state, c))
+            {
+                type_codept codepoint = 0;
+                do
+                {
+                    FnNext(&state, &codepoint);
+                    emit(codepoint, sink);
+                }
+                while (inline_norm_iter_ready(&state));
+            }
+        }
+    }
+
+public:
+    uaiw_constexpr norm_stream() noexcept { impl_norm_iter_state_reset(&state); }
+
+    // Normalizes the chunk and gives the result to the sink: sink(std::basic_string_view<UTF>)
+    // The sink can be called any number of times including zero, the view is valid only inside the call.
+    template<class Sink>
+    uaiw_constexpr void feed(std::basic_string_view<UTF> chunk, Sink&& sink)
+    {
+        // Complete the carried sequence with the first code units of the chunk
+        if constexpr (max_carry > 0)
+        {
+            while (carry_size && !chunk.empty())
+            {
+                carry[carry_size++] = chunk.front();
+                chunk.remove_prefix(1);
+
+                const std::size_t keep = utf_tail<utf>(carry, carry_size);
+                if (keep == carry_size)
+                    continue;
+
+                push(carry, carry_size - keep, sink);
+
+                for (std::size_t i = 0; i < keep; ++i)
+                    carry[i] = carry[carry_size - keep + i];
+                carry_size = keep;
+            }
+        }
+
+        if (!chunk.empty())
+        {
+            const std::size_t keep = utf_tail<utf>(chunk.data(), chunk.size());
+
+            push(chunk.data(), chunk.size() - keep, sink);
+
+            for (std::size_t i = 0; i < keep && i < max_carry; ++i) // keep <= max_carry, helps GCC to see it
+                carry[i] = chunk[chunk.size() - keep + i];
+            carry_size = keep;
+        }
+
+        flush(sink);
+    }
+
+    // Normalizes the rest at the end of the stream, gives it to the sink and resets the stream
+    template<class Sink>
+    uaiw_constexpr void finish(Sink&& sink)
+    {
+        push(carry, carry_size, sink);
+
+        type_codept codepoint = 0;
+        while (FnNext(&state, &codepoint))
+            emit(codepoint, sink);
+
+        flush(sink);
+        reset();
+    }
+
+    uaiw_constexpr void reset() noexcept
+    {
+        impl_norm_iter_state_reset(&state);
+        carry_size = 0;
+        out_size = 0;
+    }
+};
+
 } // namespace detail
 
 namespace norm {
 
+#ifndef UNI_ALGO_DISABLE_CASE
+#ifndef UNI_ALGO_DISABLE_PROP
+// Steps of una::norm::to_search_key_utf8/utf16 that are done in one pass, combine them with |
+// The result is always composed: NFC or NFKC with compat
+enum class search_key : int
+{
+    nfc      = 0,
+    casefold = detail::impl_norm_search_key_casefold, // Full case folding
+    unaccent = detail::impl_norm_search_key_unaccent, // Remove Nonspacing Mark
+    compat   = detail::impl_norm_search_key_compat    // NFKC instead of NFC
+};
+inline constexpr search_key operator|(search_key x, search_key y) noexcept
+{
+    return static_cast<search_key>(static_cast<int>(x) | static_cast<int>(y));
+}
+#endif // UNI_ALGO_DISABLE_PROP
+#endif // UNI_ALGO_DISABLE_CASE
+
 template<typename UTF8, typename Alloc = std::allocator<UTF8>>
 uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
 to_nfc_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
@@ -159,6 +681,15 @@ to_nfc_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
     return detail::t_norm<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
             detail::impl_x_norm_to_nfc_utf8, detail::impl_norm_to_nfc_utf8>(alloc, source);
 }
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+to_nfc_utf8(std::basic_string_view<UTF8> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_norm_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_x_norm_to_nfc_utf8, detail::impl_norm_to_nfc_utf8>(dst, source);
+}
 
 template<typename UTF8, typename Alloc = std::allocator<UTF8>>
 uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
@@ -169,6 +700,15 @@ to_nfd_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
     return detail::t_norm<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
             detail::impl_x_norm_to_nfd_utf8, detail::impl_norm_to_nfd_utf8>(alloc, source);
 }
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+to_nfd_utf8(std::basic_string_view<UTF8> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_norm_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_x_norm_to_nfd_utf8, detail::impl_norm_to_nfd_utf8>(dst, source);
+}
 
 #ifndef UNI_ALGO_DISABLE_NFKC_NFKD
 template<typename UTF8, typename Alloc = std::allocator<UTF8>>
@@ -180,6 +720,15 @@ to_nfkc_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
     return detail::t_norm2<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
             detail::impl_norm_to_nfkc_utf8>(alloc, source);
 }
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+to_nfkc_utf8(std::basic_string_view<UTF8> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_norm2_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_norm_to_nfkc_utf8>(dst, source);
+}
 
 template<typename UTF8, typename Alloc = std::allocator<UTF8>>
 uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
@@ -190,6 +739,15 @@ to_nfkd_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
     return detail::t_norm2<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
             detail::impl_norm_to_nfkd_utf8>(alloc, source);
 }
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+to_nfkd_utf8(std::basic_string_view<UTF8> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_norm2_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_norm_to_nfkd_utf8>(dst, source);
+}
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
 #ifndef UNI_ALGO_DISABLE_PROP
@@ -202,38 +760,122 @@ to_unaccent_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc
     return detail::t_norm<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
             detail::impl_x_norm_to_unaccent_utf8, detail::impl_norm_to_unaccent_utf8>(alloc, source);
 }
-#endif // UNI_ALGO_DISABLE_PROP
-
-template<typename UTF16, typename Alloc = std::allocator<UTF16>>
-uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
-to_nfc_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+to_unaccent_utf8(std::basic_string_view<UTF8> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
 {
-    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF8>);
 
-    return detail::t_norm<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF16>,
-            detail::impl_x_norm_to_nfc_utf16, detail::impl_norm_to_nfc_utf16>(alloc, source);
+    return detail::t_norm_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_x_norm_to_unaccent_utf8, detail::impl_norm_to_unaccent_utf8>(dst, source);
 }
+#endif // UNI_ALGO_DISABLE_PROP
 
-template<typename UTF16, typename Alloc = std::allocator<UTF16>>
-uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
-to_nfd_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_CASE
+// NFKC_Casefold in one pass, the same as NFKC(casefold(NFKD(source))) without default ignorable code points
+template<typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+to_nfkc_casefold_utf8(std::basic_string_view<UTF8> source, const Alloc& alloc = Alloc())
 {
-    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF8>);
 
-    return detail::t_norm<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF16>,
-            detail::impl_x_norm_to_nfd_utf16, detail::impl_norm_to_nfd_utf16>(alloc, source);
+    return detail::t_norm2<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_norm_to_nfkc_casefold_utf8>(alloc, source);
 }
-
-#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
-template<typename UTF16, typename Alloc = std::allocator<UTF16>>
-uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
-to_nfkc_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+to_nfkc_casefold_utf8(std::basic_string_view<UTF8> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
 {
-    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+    static_assert(std::is_integral_v<UTF8>);
 
-    return detail::t_norm2<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+    return detail::t_norm2_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_norm_to_nfkc_casefold_utf8>(dst, source);
+}
+#endif // UNI_ALGO_DISABLE_CASE
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+#ifndef UNI_ALGO_DISABLE_CASE
+#ifndef UNI_ALGO_DISABLE_PROP
+template<typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+to_search_key_utf8(std::basic_string_view<UTF8> source, search_key steps = search_key::casefold | search_key::unaccent,
+                     const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_norm_mode<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, Alloc, std::basic_string_view<UTF8>,
+            detail::impl_norm_to_search_key_utf8>(alloc, source, static_cast<int>(steps));
+}
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::size_t
+to_search_key_utf8(std::basic_string_view<UTF8> source, search_key steps, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_norm_mode_append<std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>, std::basic_string_view<UTF8>,
+            detail::impl_norm_to_search_key_utf8>(dst, source, static_cast<int>(steps));
+}
+#endif // UNI_ALGO_DISABLE_PROP
+#endif // UNI_ALGO_DISABLE_CASE
+
+template<typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+to_nfc_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_norm<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_x_norm_to_nfc_utf16, detail::impl_norm_to_nfc_utf16>(alloc, source);
+}
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+to_nfc_utf16(std::basic_string_view<UTF16> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_norm_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_x_norm_to_nfc_utf16, detail::impl_norm_to_nfc_utf16>(dst, source);
+}
+
+template<typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+to_nfd_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_norm<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_x_norm_to_nfd_utf16, detail::impl_norm_to_nfd_utf16>(alloc, source);
+}
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+to_nfd_utf16(std::basic_string_view<UTF16> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_norm_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_x_norm_to_nfd_utf16, detail::impl_norm_to_nfd_utf16>(dst, source);
+}
+
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+template<typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+to_nfkc_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_norm2<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF16>,
             detail::impl_norm_to_nfkc_utf16>(alloc, source);
 }
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+to_nfkc_utf16(std::basic_string_view<UTF16> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_norm2_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_norm_to_nfkc_utf16>(dst, source);
+}
 
 template<typename UTF16, typename Alloc = std::allocator<UTF16>>
 uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
@@ -244,6 +886,15 @@ to_nfkd_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc()
     return detail::t_norm2<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF16>,
             detail::impl_norm_to_nfkd_utf16>(alloc, source);
 }
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+to_nfkd_utf16(std::basic_string_view<UTF16> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_norm2_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_norm_to_nfkd_utf16>(dst, source);
+}
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
 #ifndef UNI_ALGO_DISABLE_PROP
@@ -256,8 +907,65 @@ to_unaccent_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = All
     return detail::t_norm<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF16>,
             detail::impl_x_norm_to_unaccent_utf16, detail::impl_norm_to_unaccent_utf16>(alloc, source);
 }
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+to_unaccent_utf16(std::basic_string_view<UTF16> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_norm_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_x_norm_to_unaccent_utf16, detail::impl_norm_to_unaccent_utf16>(dst, source);
+}
 #endif // UNI_ALGO_DISABLE_PROP
 
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_CASE
+// NFKC_Casefold in one pass, the same as NFKC(casefold(NFKD(source))) without default ignorable code points
+template<typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+to_nfkc_casefold_utf16(std::basic_string_view<UTF16> source, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_norm2<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_norm_to_nfkc_casefold_utf16>(alloc, source);
+}
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+to_nfkc_casefold_utf16(std::basic_string_view<UTF16> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_norm2_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_norm_to_nfkc_casefold_utf16>(dst, source);
+}
+#endif // UNI_ALGO_DISABLE_CASE
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+#ifndef UNI_ALGO_DISABLE_CASE
+#ifndef UNI_ALGO_DISABLE_PROP
+template<typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+to_search_key_utf16(std::basic_string_view<UTF16> source, search_key steps = search_key::casefold | search_key::unaccent,
+                      const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_norm_mode<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, Alloc, std::basic_string_view<UTF16>,
+            detail::impl_norm_to_search_key_utf16>(alloc, source, static_cast<int>(steps));
+}
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::size_t
+to_search_key_utf16(std::basic_string_view<UTF16> source, search_key steps, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& dst)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_norm_mode_append<std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>, std::basic_string_view<UTF16>,
+            detail::impl_norm_to_search_key_utf16>(dst, source, static_cast<int>(steps));
+}
+#endif // UNI_ALGO_DISABLE_PROP
+#endif // UNI_ALGO_DISABLE_CASE
+
 template<typename UTF8>
 uaiw_constexpr bool is_nfc_utf8(std::basic_string_view<UTF8> source)
 {
@@ -382,6 +1090,111 @@ uaiw_constexpr bool is_nfkd_utf16(std::basic_string_view<UTF16> source)
 }
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
 
+// Canonical comparison: the same as comparing the results of to_nfd_utf8/utf16 in code point order
+// but both strings are normalized lazily code point by code point and nothing is allocated,
+// the equal prefix is skipped without decoding and the comparison stops at the first difference.
+template<typename UTF8>
+uaiw_constexpr int compare_nfd_utf8(std::basic_string_view<UTF8> string1, std::basic_string_view<UTF8> string2)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    return detail::impl_norm_compare_nfd_utf8(string1.cbegin(), string1.cend(),
+                                              string2.cbegin(), string2.cend());
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    return detail::impl_norm_compare_nfd_utf8(string1.data(), string1.data() + string1.size(),
+                                              string2.data(), string2.data() + string2.size());
+#else // Safe layer
+    namespace safe = detail::safe;
+    return detail::impl_norm_compare_nfd_utf8(safe::in{string1.data(), string1.size()}, safe::end{string1.data() + string1.size()},
+                                              safe::in{string2.data(), string2.size()}, safe::end{string2.data() + string2.size()});
+#endif
+}
+
+template<typename UTF8>
+uaiw_constexpr bool equals_nfd_utf8(std::basic_string_view<UTF8> string1, std::basic_string_view<UTF8> string2)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return compare_nfd_utf8(string1, string2) == 0;
+}
+
+template<typename UTF16>
+uaiw_constexpr int compare_nfd_utf16(std::basic_string_view<UTF16> string1, std::basic_string_view<UTF16> string2)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    return detail::impl_norm_compare_nfd_utf16(string1.cbegin(), string1.cend(),
+                                               string2.cbegin(), string2.cend());
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    return detail::impl_norm_compare_nfd_utf16(string1.data(), string1.data() + string1.size(),
+                                               string2.data(), string2.data() + string2.size());
+#else // Safe layer
+    namespace safe = detail::safe;
+    return detail::impl_norm_compare_nfd_utf16(safe::in{string1.data(), string1.size()}, safe::end{string1.data() + string1.size()},
+                                               safe::in{string2.data(), string2.size()}, safe::end{string2.data() + string2.size()});
+#endif
+}
+
+template<typename UTF16>
+uaiw_constexpr bool equals_nfd_utf16(std::basic_string_view<UTF16> string1, std::basic_string_view<UTF16> string2)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return compare_nfd_utf16(string1, string2) == 0;
+}
+
+// Canonical search: the needle is normalized to NFD once and the haystack is normalized lazily
+// while searching, a match never splits a base and its combining marks, the positions are in the haystack
+template<typename UTF8>
+uaiw_constexpr una::search search_nfd_utf8(std::basic_string_view<UTF8> string1, std::basic_string_view<UTF8> string2)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    const std::basic_string<UTF8> nfd = to_nfd_utf8<UTF8>(string2);
+    const std::basic_string_view<UTF8> needle = nfd;
+
+    size_t pos = detail::impl_npos, end = detail::impl_npos;
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    const bool ret = detail::impl_norm_search_nfd_utf8(string1.cbegin(), string1.cend(),
+                                                       needle.cbegin(), needle.cend(), &pos, &end);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    const bool ret = detail::impl_norm_search_nfd_utf8(string1.data(), string1.data() + string1.size(),
+                                                       needle.data(), needle.data() + needle.size(), &pos, &end);
+#else // Safe layer
+    namespace safe = detail::safe;
+    const bool ret = detail::impl_norm_search_nfd_utf8(safe::in{string1.data(), string1.size()}, safe::end{string1.data() + string1.size()},
+                                                       safe::in{needle.data(), needle.size()}, safe::end{needle.data() + needle.size()}, &pos, &end);
+#endif
+
+    return ret ? una::search{pos, end} : una::search{};
+}
+
+template<typename UTF16>
+uaiw_constexpr una::search search_nfd_utf16(std::basic_string_view<UTF16> string1, std::basic_string_view<UTF16> string2)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    const std::basic_string<UTF16> nfd = to_nfd_utf16<UTF16>(string2);
+    const std::basic_string_view<UTF16> needle = nfd;
+
+    size_t pos = detail::impl_npos, end = detail::impl_npos;
+#if defined(UNI_ALGO_FORCE_CPP_ITERATORS)
+    const bool ret = detail::impl_norm_search_nfd_utf16(string1.cbegin(), string1.cend(),
+                                                        needle.cbegin(), needle.cend(), &pos, &end);
+#elif defined(UNI_ALGO_FORCE_C_POINTERS)
+    const bool ret = detail::impl_norm_search_nfd_utf16(string1.data(), string1.data() + string1.size(),
+                                                        needle.data(), needle.data() + needle.size(), &pos, &end);
+#else // Safe layer
+    namespace safe = detail::safe;
+    const bool ret = detail::impl_norm_search_nfd_utf16(safe::in{string1.data(), string1.size()}, safe::end{string1.data() + string1.size()},
+                                                        safe::in{needle.data(), needle.size()}, safe::end{needle.data() + needle.size()}, &pos, &end);
+#endif
+
+    return ret ? una::search{pos, end} : una::search{};
+}
+
 template<typename Iter, typename Sent, typename Dest>
 uaiw_constexpr void to_nfc_utf8(Iter first, Sent last, Dest result)
 {
@@ -440,6 +1253,22 @@ inline uaiw_constexpr std::string to_unaccent_utf8(std::string_view source)
     return to_unaccent_utf8<char>(source);
 }
 #endif // UNI_ALGO_DISABLE_PROP
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_CASE
+inline uaiw_constexpr std::string to_nfkc_casefold_utf8(std::string_view source)
+{
+    return to_nfkc_casefold_utf8<char>(source);
+}
+#endif // UNI_ALGO_DISABLE_CASE
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_CASE
+#ifndef UNI_ALGO_DISABLE_PROP
+inline uaiw_constexpr std::string to_search_key_utf8(std::string_view source, search_key steps = search_key::casefold | search_key::unaccent)
+{
+    return to_search_key_utf8<char>(source, steps);
+}
+#endif // UNI_ALGO_DISABLE_PROP
+#endif // UNI_ALGO_DISABLE_CASE
 
 inline uaiw_constexpr std::u16string to_nfc_utf16(std::u16string_view source)
 {
@@ -465,6 +1294,22 @@ inline uaiw_constexpr std::u16string to_unaccent_utf16(std::u16string_view sourc
     return to_unaccent_utf16<char16_t>(source);
 }
 #endif // UNI_ALGO_DISABLE_PROP
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_CASE
+inline uaiw_constexpr std::u16string to_nfkc_casefold_utf16(std::u16string_view source)
+{
+    return to_nfkc_casefold_utf16<char16_t>(source);
+}
+#endif // UNI_ALGO_DISABLE_CASE
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_CASE
+#ifndef UNI_ALGO_DISABLE_PROP
+inline uaiw_constexpr std::u16string to_search_key_utf16(std::u16string_view source, search_key steps = search_key::casefold | search_key::unaccent)
+{
+    return to_search_key_utf16<char16_t>(source, steps);
+}
+#endif // UNI_ALGO_DISABLE_PROP
+#endif // UNI_ALGO_DISABLE_CASE
 
 inline uaiw_constexpr bool is_nfc_utf8(std::string_view source)
 {
@@ -484,6 +1329,18 @@ inline uaiw_constexpr bool is_nfkd_utf8(std::string_view source)
     return is_nfkd_utf8<char>(source);
 }
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
+inline uaiw_constexpr int compare_nfd_utf8(std::string_view string1, std::string_view string2)
+{
+    return compare_nfd_utf8<char>(string1, string2);
+}
+inline uaiw_constexpr bool equals_nfd_utf8(std::string_view string1, std::string_view string2)
+{
+    return equals_nfd_utf8<char>(string1, string2);
+}
+inline uaiw_constexpr una::search search_nfd_utf8(std::string_view string1, std::string_view string2)
+{
+    return search_nfd_utf8<char>(string1, string2);
+}
 
 inline uaiw_constexpr bool is_nfc_utf16(std::u16string_view source)
 {
@@ -503,6 +1360,18 @@ inline uaiw_constexpr bool is_nfkd_utf16(std::u16string_view source)
     return is_nfkd_utf16<char16_t>(source);
 }
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
+inline uaiw_constexpr int compare_nfd_utf16(std::u16string_view string1, std::u16string_view string2)
+{
+    return compare_nfd_utf16<char16_t>(string1, string2);
+}
+inline uaiw_constexpr bool equals_nfd_utf16(std::u16string_view string1, std::u16string_view string2)
+{
+    return equals_nfd_utf16<char16_t>(string1, string2);
+}
+inline uaiw_constexpr una::search search_nfd_utf16(std::u16string_view string1, std::u16string_view string2)
+{
+    return search_nfd_utf16<char16_t>(string1, string2);
+}
 
 #if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
 inline uaiw_constexpr std::wstring to_nfc_utf16(std::wstring_view source)
@@ -529,6 +1398,22 @@ inline uaiw_constexpr std::wstring to_unaccent_utf16(std::wstring_view source)
     return to_unaccent_utf16<wchar_t>(source);
 }
 #endif // UNI_ALGO_DISABLE_PROP
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_CASE
+inline uaiw_constexpr std::wstring to_nfkc_casefold_utf16(std::wstring_view source)
+{
+    return to_nfkc_casefold_utf16<wchar_t>(source);
+}
+#endif // UNI_ALGO_DISABLE_CASE
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_CASE
+#ifndef UNI_ALGO_DISABLE_PROP
+inline uaiw_constexpr std::wstring to_search_key_utf16(std::wstring_view source, search_key steps = search_key::casefold | search_key::unaccent)
+{
+    return to_search_key_utf16<wchar_t>(source, steps);
+}
+#endif // UNI_ALGO_DISABLE_PROP
+#endif // UNI_ALGO_DISABLE_CASE
 
 inline uaiw_constexpr bool is_nfc_utf16(std::wstring_view source)
 {
@@ -548,6 +1433,18 @@ inline uaiw_constexpr bool is_nfkd_utf16(std::wstring_view source)
     return is_nfkd_utf16<wchar_t>(source);
 }
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
+inline uaiw_constexpr int compare_nfd_utf16(std::wstring_view string1, std::wstring_view string2)
+{
+    return compare_nfd_utf16<wchar_t>(string1, string2);
+}
+inline uaiw_constexpr bool equals_nfd_utf16(std::wstring_view string1, std::wstring_view string2)
+{
+    return equals_nfd_utf16<wchar_t>(string1, string2);
+}
+inline uaiw_constexpr una::search search_nfd_utf16(std::wstring_view string1, std::wstring_view string2)
+{
+    return search_nfd_utf16<wchar_t>(string1, string2);
+}
 #endif // WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF
 
 #ifdef __cpp_lib_char8_t
@@ -576,6 +1473,22 @@ inline uaiw_constexpr std::u8string to_unaccent_utf8(std::u8string_view source)
     return to_unaccent_utf8<char8_t>(source);
 }
 #endif // UNI_ALGO_DISABLE_PROP
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_CASE
+inline uaiw_constexpr std::u8string to_nfkc_casefold_utf8(std::u8string_view source)
+{
+    return to_nfkc_casefold_utf8<char8_t>(source);
+}
+#endif // UNI_ALGO_DISABLE_CASE
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_CASE
+#ifndef UNI_ALGO_DISABLE_PROP
+inline uaiw_constexpr std::u8string to_search_key_utf8(std::u8string_view source, search_key steps = search_key::casefold | search_key::unaccent)
+{
+    return to_search_key_utf8<char8_t>(source, steps);
+}
+#endif // UNI_ALGO_DISABLE_PROP
+#endif // UNI_ALGO_DISABLE_CASE
 
 inline uaiw_constexpr bool is_nfc_utf8(std::u8string_view source)
 {
@@ -595,9 +1508,523 @@ inline uaiw_constexpr bool is_nfkd_utf8(std::u8string_view source)
     return is_nfkd_utf8<char8_t>(source);
 }
 #endif // UNI_ALGO_DISABLE_NFKC_NFKD
+inline uaiw_constexpr int compare_nfd_utf8(std::u8string_view string1, std::u8string_view string2)
+{
+    return compare_nfd_utf8<char8_t>(string1, string2);
+}
+inline uaiw_constexpr bool equals_nfd_utf8(std::u8string_view string1, std::u8string_view string2)
+{
+    return equals_nfd_utf8<char8_t>(string1, string2);
+}
+inline uaiw_constexpr una::search search_nfd_utf8(std::u8string_view string1, std::u8string_view string2)
+{
+    return search_nfd_utf8<char8_t>(string1, string2);
+}
 
 #endif // __cpp_lib_char8_t
 
+namespace bounded {
+
+// The same functions as above but the result is written to a caller buffer, as much as fits,
+// and normalization always stops on a boundary where the result is the same as if the whole string
+// was normalized at once. The number of code units read and written is returned so normalization
+// can be continued from there with another buffer.
+
+template<typename UTF8>
+uaiw_constexpr bounded_result to_nfc_utf8(std::basic_string_view<UTF8> source, UTF8* dst, std::size_t dst_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_bounded<UTF8, UTF8, detail::impl_x_norm_to_nfc_utf8,
+            detail::norm_bounded<UTF8, UTF8, 8, detail::impl_norm_is_nfc_qc_yes_prop,
+            detail::impl_norm_to_nfc_utf8>>(source, dst, dst_size, nullptr);
+}
+template<typename UTF8>
+uaiw_constexpr bounded_result to_nfd_utf8(std::basic_string_view<UTF8> source, UTF8* dst, std::size_t dst_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_bounded<UTF8, UTF8, detail::impl_x_norm_to_nfd_utf8,
+            detail::norm_bounded<UTF8, UTF8, 8, detail::impl_norm_is_nfc_qc_yes_prop,
+            detail::impl_norm_to_nfd_utf8>>(source, dst, dst_size, nullptr);
+}
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+template<typename UTF8>
+uaiw_constexpr bounded_result to_nfkc_utf8(std::basic_string_view<UTF8> source, UTF8* dst, std::size_t dst_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_bounded<UTF8, UTF8, detail::impl_x_norm_to_nfkc_utf8,
+            detail::norm_bounded<UTF8, UTF8, 8, detail::impl_norm_is_nfkc_qc_yes_prop,
+            detail::impl_norm_to_nfkc_utf8>>(source, dst, dst_size, nullptr);
+}
+template<typename UTF8>
+uaiw_constexpr bounded_result to_nfkd_utf8(std::basic_string_view<UTF8> source, UTF8* dst, std::size_t dst_size)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    return detail::t_bounded<UTF8, UTF8, detail::impl_x_norm_to_nfkd_utf8,
+            detail::norm_bounded<UTF8, UTF8, 8, detail::impl_norm_is_nfkc_qc_yes_prop,
+            detail::impl_norm_to_nfkd_utf8>>(source, dst, dst_size, nullptr);
+}
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+template<typename UTF16>
+uaiw_constexpr bounded_result to_nfc_utf16(std::basic_string_view<UTF16> source, UTF16* dst, std::size_t dst_size)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_bounded<UTF16, UTF16, detail::impl_x_norm_to_nfc_utf16,
+            detail::norm_bounded<UTF16, UTF16, 16, detail::impl_norm_is_nfc_qc_yes_prop,
+            detail::impl_norm_to_nfc_utf16>>(source, dst, dst_size, nullptr);
+}
+template<typename UTF16>
+uaiw_constexpr bounded_result to_nfd_utf16(std::basic_string_view<UTF16> source, UTF16* dst, std::size_t dst_size)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_bounded<UTF16, UTF16, detail::impl_x_norm_to_nfd_utf16,
+            detail::norm_bounded<UTF16, UTF16, 16, detail::impl_norm_is_nfc_qc_yes_prop,
+            detail::impl_norm_to_nfd_utf16>>(source, dst, dst_size, nullptr);
+}
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+template<typename UTF16>
+uaiw_constexpr bounded_result to_nfkc_utf16(std::basic_string_view<UTF16> source, UTF16* dst, std::size_t dst_size)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_bounded<UTF16, UTF16, detail::impl_x_norm_to_nfkc_utf16,
+            detail::norm_bounded<UTF16, UTF16, 16, detail::impl_norm_is_nfkc_qc_yes_prop,
+            detail::impl_norm_to_nfkc_utf16>>(source, dst, dst_size, nullptr);
+}
+template<typename UTF16>
+uaiw_constexpr bounded_result to_nfkd_utf16(std::basic_string_view<UTF16> source, UTF16* dst, std::size_t dst_size)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    return detail::t_bounded<UTF16, UTF16, detail::impl_x_norm_to_nfkd_utf16,
+            detail::norm_bounded<UTF16, UTF16, 16, detail::impl_norm_is_nfkc_qc_yes_prop,
+            detail::impl_norm_to_nfkd_utf16>>(source, dst, dst_size, nullptr);
+}
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+inline uaiw_constexpr bounded_result to_nfc_utf8(std::string_view source, char* dst, std::size_t dst_size)
+{
+    return to_nfc_utf8<char>(source, dst, dst_size);
+}
+inline uaiw_constexpr bounded_result to_nfd_utf8(std::string_view source, char* dst, std::size_t dst_size)
+{
+    return to_nfd_utf8<char>(source, dst, dst_size);
+}
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+inline uaiw_constexpr bounded_result to_nfkc_utf8(std::string_view source, char* dst, std::size_t dst_size)
+{
+    return to_nfkc_utf8<char>(source, dst, dst_size);
+}
+inline uaiw_constexpr bounded_result to_nfkd_utf8(std::string_view source, char* dst, std::size_t dst_size)
+{
+    return to_nfkd_utf8<char>(source, dst, dst_size);
+}
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+inline uaiw_constexpr bounded_result to_nfc_utf16(std::u16string_view source, char16_t* dst, std::size_t dst_size)
+{
+    return to_nfc_utf16<char16_t>(source, dst, dst_size);
+}
+inline uaiw_constexpr bounded_result to_nfd_utf16(std::u16string_view source, char16_t* dst, std::size_t dst_size)
+{
+    return to_nfd_utf16<char16_t>(source, dst, dst_size);
+}
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+inline uaiw_constexpr bounded_result to_nfkc_utf16(std::u16string_view source, char16_t* dst, std::size_t dst_size)
+{
+    return to_nfkc_utf16<char16_t>(source, dst, dst_size);
+}
+inline uaiw_constexpr bounded_result to_nfkd_utf16(std::u16string_view source, char16_t* dst, std::size_t dst_size)
+{
+    return to_nfkd_utf16<char16_t>(source, dst, dst_size);
+}
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+} // namespace bounded
+
+// Quick check first normalization: returns the source itself if it is already normalized,
+// otherwise the normalized string is written to the buffer and a view of the buffer is returned.
+// Only the part after the normalized prefix is normalized, the prefix is just copied to the buffer.
+// The previous content of the buffer is replaced and its capacity is reused.
+// Note that the result is a view of the source or the buffer so both of them must outlive it.
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::basic_string_view<UTF8>
+to_nfc_utf8_view(std::basic_string_view<UTF8> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& buffer)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    const std::size_t prefix = detail::norm_prefix<UTF8, 8, detail::impl_norm_is_nfc_qc_yes_prop>(source.data(), source.size());
+    if (prefix == source.size())
+        return source;
+
+    buffer.assign(source.data(), prefix);
+    to_nfc_utf8(source.substr(prefix), buffer);
+    return buffer;
+}
+
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::basic_string_view<UTF8>
+to_nfd_utf8_view(std::basic_string_view<UTF8> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& buffer)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    const std::size_t prefix = detail::norm_prefix<UTF8, 8, detail::impl_norm_is_nfd_qc_yes_prop>(source.data(), source.size());
+    if (prefix == source.size())
+        return source;
+
+    buffer.assign(source.data(), prefix);
+    to_nfd_utf8(source.substr(prefix), buffer);
+    return buffer;
+}
+
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::basic_string_view<UTF8>
+to_nfkc_utf8_view(std::basic_string_view<UTF8> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& buffer)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    const std::size_t prefix = detail::norm_prefix<UTF8, 8, detail::impl_norm_is_nfkc_qc_yes_prop>(source.data(), source.size());
+    if (prefix == source.size())
+        return source;
+
+    buffer.assign(source.data(), prefix);
+    to_nfkc_utf8(source.substr(prefix), buffer);
+    return buffer;
+}
+
+template<typename UTF8, typename Alloc>
+uaiw_constexpr std::basic_string_view<UTF8>
+to_nfkd_utf8_view(std::basic_string_view<UTF8> source, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& buffer)
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    const std::size_t prefix = detail::norm_prefix<UTF8, 8, detail::impl_norm_is_nfkd_qc_yes_prop>(source.data(), source.size());
+    if (prefix == source.size())
+        return source;
+
+    buffer.assign(source.data(), prefix);
+    to_nfkd_utf8(source.substr(prefix), buffer);
+    return buffer;
+}
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::basic_string_view<UTF16>
+to_nfc_utf16_view(std::basic_string_view<UTF16> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& buffer)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    const std::size_t prefix = detail::norm_prefix<UTF16, 16, detail::impl_norm_is_nfc_qc_yes_prop>(source.data(), source.size());
+    if (prefix == source.size())
+        return source;
+
+    buffer.assign(source.data(), prefix);
+    to_nfc_utf16(source.substr(prefix), buffer);
+    return buffer;
+}
+
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::basic_string_view<UTF16>
+to_nfd_utf16_view(std::basic_string_view<UTF16> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& buffer)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    const std::size_t prefix = detail::norm_prefix<UTF16, 16, detail::impl_norm_is_nfd_qc_yes_prop>(source.data(), source.size());
+    if (prefix == source.size())
+        return source;
+
+    buffer.assign(source.data(), prefix);
+    to_nfd_utf16(source.substr(prefix), buffer);
+    return buffer;
+}
+
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::basic_string_view<UTF16>
+to_nfkc_utf16_view(std::basic_string_view<UTF16> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& buffer)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    const std::size_t prefix = detail::norm_prefix<UTF16, 16, detail::impl_norm_is_nfkc_qc_yes_prop>(source.data(), source.size());
+    if (prefix == source.size())
+        return source;
+
+    buffer.assign(source.data(), prefix);
+    to_nfkc_utf16(source.substr(prefix), buffer);
+    return buffer;
+}
+
+template<typename UTF16, typename Alloc>
+uaiw_constexpr std::basic_string_view<UTF16>
+to_nfkd_utf16_view(std::basic_string_view<UTF16> source, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& buffer)
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    const std::size_t prefix = detail::norm_prefix<UTF16, 16, detail::impl_norm_is_nfkd_qc_yes_prop>(source.data(), source.size());
+    if (prefix == source.size())
+        return source;
+
+    buffer.assign(source.data(), prefix);
+    to_nfkd_utf16(source.substr(prefix), buffer);
+    return buffer;
+}
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+// Offset map: the result of to_nf*_utf8/utf16_mapped functions that maps positions between the source
+// and the normalized string. The map is a list of spans: a copied span is the same in both strings
+// so positions inside it are mapped exactly, a changed span is normalized as a whole so positions inside it
+// are mapped to its start or to its end with *_end functions. Adjacent copied spans are merged into one.
+// Use to_source(pos) and to_source_end(end_pos) to map a range in the normalized string back to the source.
+class offset_map
+{
+private:
+    struct span
+    {
+        std::size_t source;
+        std::size_t normalized;
+        bool copied;
+    };
+    std::vector<span> spans;
+    std::size_t source_total = 0;
+    std::size_t normalized_total = 0;
+
+    uaiw_constexpr std::size_t find(std::size_t pos, bool normalized) const noexcept
+    {
+        // Binary search of the last span that starts at or before pos
+        std::size_t first = 0;
+        std::size_t last = spans.size();
+        while (first < last)
+        {
+            const std::size_t middle = first + (last - first) / 2;
+            if ((normalized ? spans[middle].normalized : spans[middle].source) <= pos)
+                first = middle + 1;
+            else
+                last = middle;
+        }
+        return first - 1;
+    }
+    uaiw_constexpr std::size_t map(std::size_t pos, bool normalized, bool end) const noexcept
+    {
+        const std::size_t from_total = normalized ? normalized_total : source_total;
+        const std::size_t to_total = normalized ? source_total : normalized_total;
+
+        if (pos >= from_total)
+            return to_total;
+
+        const std::size_t i = find(pos, normalized);
+        const std::size_t from = normalized ? spans[i].normalized : spans[i].source;
+        const std::size_t to = normalized ? spans[i].source : spans[i].normalized;
+
+        if (spans[i].copied)
+            return to + (pos - from);
+        if (!end || pos == from)
+            return to;
+        if (i + 1 < spans.size())
+            return normalized ? spans[i + 1].source : spans[i + 1].normalized;
+        return to_total;
+    }
+
+public:
+    uaiw_constexpr offset_map() = default;
+
+    // Appends a span, it is used by the normalization functions
+    uaiw_constexpr void append(std::size_t source_size, std::size_t normalized_size, bool copied)
+    {
+        if (source_size == 0 && normalized_size == 0)
+            return;
+
+        if (!copied || spans.empty() || !spans.back().copied)
+            spans.push_back(span{source_total, normalized_total, copied});
+
+        source_total += source_size;
+        normalized_total += normalized_size;
+    }
+    uaiw_constexpr void clear() noexcept
+    {
+        spans.clear();
+        source_total = 0;
+        normalized_total = 0;
+    }
+    // The number of spans in the map
+    uaiw_constexpr std::size_t size() const noexcept { return spans.size(); }
+    uaiw_constexpr bool empty() const noexcept { return spans.empty(); }
+    uaiw_constexpr std::size_t source_size() const noexcept { return source_total; }
+    uaiw_constexpr std::size_t normalized_size() const noexcept { return normalized_total; }
+
+    // Position in the normalized string to position in the source, the start of a changed span
+    uaiw_constexpr std::size_t to_source(std::size_t pos) const noexcept { return map(pos, true, false); }
+    // The same but the end of a changed span, use it for the end of a range
+    uaiw_constexpr std::size_t to_source_end(std::size_t pos) const noexcept { return map(pos, true, true); }
+    // Position in the source to position in the normalized string, the start of a changed span
+    uaiw_constexpr std::size_t to_normalized(std::size_t pos) const noexcept { return map(pos, false, false); }
+    // The same but the end of a changed span, use it for the end of a range
+    uaiw_constexpr std::size_t to_normalized_end(std::size_t pos) const noexcept { return map(pos, false, true); }
+};
+
+// Normalization with an offset map: the same as the normal functions but the map (see offset_map above)
+// is filled too so positions in the result can be mapped back to the source, for example for highlighting.
+// The source is split on the same boundaries as in parallel normalization (see uni_algo/ext/parallel.h) so the result is always the same.
+
+template<typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+to_nfc_utf8_mapped(std::basic_string_view<UTF8> source, offset_map& map, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    using traits = detail::norm_bounded<UTF8, UTF8, 8, detail::impl_norm_is_nfc_qc_yes_prop, detail::impl_norm_to_nfc_utf8>;
+    std::basic_string<UTF8, std::char_traits<UTF8>, Alloc> dst{alloc};
+    detail::t_norm_mapped<UTF8, 8, detail::impl_norm_is_nfc_qc_yes_prop, traits>(source, dst, map,
+        [](std::basic_string_view<UTF8> s, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& d) { to_nfc_utf8(s, d); });
+    return dst;
+}
+template<typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+to_nfd_utf8_mapped(std::basic_string_view<UTF8> source, offset_map& map, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    using traits = detail::norm_bounded<UTF8, UTF8, 8, detail::impl_norm_is_nfc_qc_yes_prop, detail::impl_norm_to_nfd_utf8>;
+    std::basic_string<UTF8, std::char_traits<UTF8>, Alloc> dst{alloc};
+    detail::t_norm_mapped<UTF8, 8, detail::impl_norm_is_nfd_qc_yes_prop, traits>(source, dst, map,
+        [](std::basic_string_view<UTF8> s, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& d) { to_nfd_utf8(s, d); });
+    return dst;
+}
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+template<typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+to_nfkc_utf8_mapped(std::basic_string_view<UTF8> source, offset_map& map, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    using traits = detail::norm_bounded<UTF8, UTF8, 8, detail::impl_norm_is_nfkc_qc_yes_prop, detail::impl_norm_to_nfkc_utf8>;
+    std::basic_string<UTF8, std::char_traits<UTF8>, Alloc> dst{alloc};
+    detail::t_norm_mapped<UTF8, 8, detail::impl_norm_is_nfkc_qc_yes_prop, traits>(source, dst, map,
+        [](std::basic_string_view<UTF8> s, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& d) { to_nfkc_utf8(s, d); });
+    return dst;
+}
+template<typename UTF8, typename Alloc = std::allocator<UTF8>>
+uaiw_constexpr std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>
+to_nfkd_utf8_mapped(std::basic_string_view<UTF8> source, offset_map& map, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF8>);
+
+    using traits = detail::norm_bounded<UTF8, UTF8, 8, detail::impl_norm_is_nfkc_qc_yes_prop, detail::impl_norm_to_nfkd_utf8>;
+    std::basic_string<UTF8, std::char_traits<UTF8>, Alloc> dst{alloc};
+    detail::t_norm_mapped<UTF8, 8, detail::impl_norm_is_nfkd_qc_yes_prop, traits>(source, dst, map,
+        [](std::basic_string_view<UTF8> s, std::basic_string<UTF8, std::char_traits<UTF8>, Alloc>& d) { to_nfkd_utf8(s, d); });
+    return dst;
+}
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+template<typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+to_nfc_utf16_mapped(std::basic_string_view<UTF16> source, offset_map& map, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    using traits = detail::norm_bounded<UTF16, UTF16, 16, detail::impl_norm_is_nfc_qc_yes_prop, detail::impl_norm_to_nfc_utf16>;
+    std::basic_string<UTF16, std::char_traits<UTF16>, Alloc> dst{alloc};
+    detail::t_norm_mapped<UTF16, 16, detail::impl_norm_is_nfc_qc_yes_prop, traits>(source, dst, map,
+        [](std::basic_string_view<UTF16> s, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& d) { to_nfc_utf16(s, d); });
+    return dst;
+}
+template<typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+to_nfd_utf16_mapped(std::basic_string_view<UTF16> source, offset_map& map, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    using traits = detail::norm_bounded<UTF16, UTF16, 16, detail::impl_norm_is_nfc_qc_yes_prop, detail::impl_norm_to_nfd_utf16>;
+    std::basic_string<UTF16, std::char_traits<UTF16>, Alloc> dst{alloc};
+    detail::t_norm_mapped<UTF16, 16, detail::impl_norm_is_nfd_qc_yes_prop, traits>(source, dst, map,
+        [](std::basic_string_view<UTF16> s, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& d) { to_nfd_utf16(s, d); });
+    return dst;
+}
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+template<typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+to_nfkc_utf16_mapped(std::basic_string_view<UTF16> source, offset_map& map, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    using traits = detail::norm_bounded<UTF16, UTF16, 16, detail::impl_norm_is_nfkc_qc_yes_prop, detail::impl_norm_to_nfkc_utf16>;
+    std::basic_string<UTF16, std::char_traits<UTF16>, Alloc> dst{alloc};
+    detail::t_norm_mapped<UTF16, 16, detail::impl_norm_is_nfkc_qc_yes_prop, traits>(source, dst, map,
+        [](std::basic_string_view<UTF16> s, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& d) { to_nfkc_utf16(s, d); });
+    return dst;
+}
+template<typename UTF16, typename Alloc = std::allocator<UTF16>>
+uaiw_constexpr std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>
+to_nfkd_utf16_mapped(std::basic_string_view<UTF16> source, offset_map& map, const Alloc& alloc = Alloc())
+{
+    static_assert(std::is_integral_v<UTF16> && sizeof(UTF16) >= sizeof(char16_t));
+
+    using traits = detail::norm_bounded<UTF16, UTF16, 16, detail::impl_norm_is_nfkc_qc_yes_prop, detail::impl_norm_to_nfkd_utf16>;
+    std::basic_string<UTF16, std::char_traits<UTF16>, Alloc> dst{alloc};
+    detail::t_norm_mapped<UTF16, 16, detail::impl_norm_is_nfkd_qc_yes_prop, traits>(source, dst, map,
+        [](std::basic_string_view<UTF16> s, std::basic_string<UTF16, std::char_traits<UTF16>, Alloc>& d) { to_nfkd_utf16(s, d); });
+    return dst;
+}
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+inline uaiw_constexpr std::string to_nfc_utf8_mapped(std::string_view source, offset_map& map)
+{
+    return to_nfc_utf8_mapped<char>(source, map);
+}
+inline uaiw_constexpr std::string to_nfd_utf8_mapped(std::string_view source, offset_map& map)
+{
+    return to_nfd_utf8_mapped<char>(source, map);
+}
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+inline uaiw_constexpr std::string to_nfkc_utf8_mapped(std::string_view source, offset_map& map)
+{
+    return to_nfkc_utf8_mapped<char>(source, map);
+}
+inline uaiw_constexpr std::string to_nfkd_utf8_mapped(std::string_view source, offset_map& map)
+{
+    return to_nfkd_utf8_mapped<char>(source, map);
+}
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+inline uaiw_constexpr std::u16string to_nfc_utf16_mapped(std::u16string_view source, offset_map& map)
+{
+    return to_nfc_utf16_mapped<char16_t>(source, map);
+}
+inline uaiw_constexpr std::u16string to_nfd_utf16_mapped(std::u16string_view source, offset_map& map)
+{
+    return to_nfd_utf16_mapped<char16_t>(source, map);
+}
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+inline uaiw_constexpr std::u16string to_nfkc_utf16_mapped(std::u16string_view source, offset_map& map)
+{
+    return to_nfkc_utf16_mapped<char16_t>(source, map);
+}
+inline uaiw_constexpr std::u16string to_nfkd_utf16_mapped(std::u16string_view source, offset_map& map)
+{
+    return to_nfkd_utf16_mapped<char16_t>(source, map);
+}
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
+// Streaming normalization of chunks with bounded memory, see detail::norm_stream
+
+template<typename UTF = char>
+using nfc_stream = detail::norm_stream<UTF, detail::inline_norm_iter_nfc, detail::inline_norm_iter_next_comp>;
+template<typename UTF = char>
+using nfd_stream = detail::norm_stream<UTF, detail::inline_norm_iter_nfd, detail::inline_norm_iter_next_decomp>;
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+template<typename UTF = char>
+using nfkc_stream = detail::norm_stream<UTF, detail::inline_norm_iter_nfkc, detail::inline_norm_iter_next_comp>;
+template<typename UTF = char>
+using nfkd_stream = detail::norm_stream<UTF, detail::inline_norm_iter_nfkd, detail::inline_norm_iter_next_decomp>;
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+
 } // namespace norm
 
 // ----------
@@ -5,6 +5,7 @@
 // The performance test is a mess. If you want to use it you're on your own.
 
 #include "perf_convert_utf8to16.h"
+//#include "perf_convert_exact.h"
 //#include "perf_normalize_nfc_utf16.h"
 //#include "perf_normalize_nfc_utf8.h"
 //#include "perf_break_utf16.h"
@@ -0,0 +1,172 @@
+/* Performance test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// All performance tests are a mess. If you want to use them you're on your own.
+
+// Compares the default conversion (allocate for the worst case and shrink after) with
+// una::exact conversion (count the result length first and allocate once).
+// Memory is measured with an allocator that tracks the peak of allocated bytes.
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <stdexcept>
+#include "../include/uni_algo/conv.h"
+
+std::size_t alloc_current = 0;
+std::size_t alloc_peak = 0;
+std::size_t alloc_total = 0;
+
+template<class T>
+class alloc_peak_counter
+{
+public:
+    using value_type = T;
+
+    template <class U>
+    alloc_peak_counter(const alloc_peak_counter<U>&) {}
+
+    alloc_peak_counter() = default;
+    T* allocate(std::size_t n)
+    {
+        alloc_current += n * sizeof(T);
+        alloc_total += n * sizeof(T);
+        if (alloc_current > alloc_peak)
+            alloc_peak = alloc_current;
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T* p, std::size_t n)
+    {
+        alloc_current -= n * sizeof(T);
+        std::allocator<T>{}.deallocate(p, n);
+    }
+};
+template<class T, class U>
+bool operator==(const alloc_peak_counter<T>&, const alloc_peak_counter<U>&) { return true; }
+template<class T, class U>
+bool operator!=(const alloc_peak_counter<T>&, const alloc_peak_counter<U>&) { return false; }
+
+void alloc_reset()
+{
+    alloc_current = 0;
+    alloc_peak = 0;
+    alloc_total = 0;
+}
+
+const size_t number_of_passes = 20000;
+std::vector<std::string> strs;
+std::vector<std::u16string> strs16;
+
+void fill_1()
+{
+    if (number_of_passes > 50000)
+        throw std::runtime_error("RAM! RAM! RAM!");
+
+    // Random text from: https://creativecommons.org/licenses/by-sa/1.0/deed.en
+    std::u32string s1 = U"Attribution You must give appropriate credit, provide a link to the license, and indicate if changes were made. You may do so in any reasonable manner, but not in any way that suggests the licensor endorses you or your use.";
+    std::u32string s2 = U"Attiecinājums — Jums ir atbilstoši jāatsaucas uz darbu, norādot saiti uz licenci un jānorāda veiktās izmaiņas. Jūs varat to darīt dažādos saprātīgos veidos, bet noteikti ne tā, kas liktu domāt, ka licencētājs ir apstiprinājis jūsu darbu vai tajā veiktās izmaiņas.";
+    std::u32string s3 = U"«Attribution» («Атрибуция») — Вы должны обеспечить соответствующее указание авторства, предоставить ссылку на лицензию, и обозначить изменения, если таковые были сделаны. Вы можете это делать любым разумным способом, но не таким, который подразумевал бы, что лицензиар одобряет вас или ваш способ использования произведения.";
+    std::u32string s4 = U"অ্যাট্রিবিউশন — আপনাকে অবশ্যই যথাযথ কৃতিত্ব দিতে হবে, লাইসেন্সের একটি লিঙ্ক প্রদান করতে হবে, এবং কোন পরিবর্তন করা হলে তা নির্দেশ করতে হবে। আপনি যে কোন যুক্তিসঙ্গত পদ্ধতিতে তা করতে পারেন, কিন্তু এমন কোন পদ্ধতিতে নয় যাতে মনে হয় লাইসেন্সকারী আপনাকে বা আপনার এই ব্যবহারের জন্য অনুমোদন দিয়েছেন।";
+    std::u32string s5 = U"署名 — 您必须给出适当的署名，提供指向本许可协议的链接，同时标明是否（对原始作品）作了修改。您可以用任何合理的方式来署名，但是不得以任何方式暗示许可人为您或您的使用背书。";
+    std::u32string s6 = U"表示 — あなたは 適切なクレジットを表示し、ライセンスへのリンクを提供し、変更があったらその旨を示さなければなりません。これらは合理的であればどのような方法で行っても構いませんが、許諾者があなたやあなたの利用行為を支持していると示唆するような方法は除きます。";
+    std::u32string s7 = U"저작자표시 — 적절한 출처와, 해당 라이센스 링크를 표시하고, 변경이 있는 경우 공지해야 합니다. 합리적인 방식으로 이렇게 하면 되지만, 이용 허락권자가 귀하에게 권리를 부여한다거나 귀하의 사용을 허가한다는 내용을 나타내서는 안 됩니다.";
+
+    for (size_t i = 0; i < number_of_passes; i++)
+    {
+        std::u32string str;
+        for (size_t j = 0; j < 3; j++)
+        {
+            str += s1 + s2 + s3 + s4 + s5 + s6 + s7;
+        }
+        strs.emplace_back(una::utf32to8<char32_t, char>(str));
+        strs16.emplace_back(una::utf32to16<char32_t, char16_t>(str));
+    }
+}
+
+void fill_2()
+{
+    // English only text to see the difference when the result is much smaller than the worst case
+    std::string s1 = "Attribution You must give appropriate credit, provide a link to the license, and indicate if changes were made. You may do so in any reasonable manner, but not in any way that suggests the licensor endorses you or your use.";
+
+    for (size_t i = 0; i < number_of_passes; i++)
+    {
+        std::string str;
+        for (size_t j = 0; j < 20; j++)
+            str += s1;
+        strs.emplace_back(str);
+        strs16.emplace_back(una::utf8to16<char, char16_t>(str));
+    }
+}
+
+void test_performance();
+
+int main5()
+{
+    fill_1();
+    //fill_2();
+
+    test_performance();
+
+    return 0;
+}
+
+template<class Dst, class Src, class Fn>
+void test_one(const std::vector<Src>& src, Fn fn, unsigned int& nothing)
+{
+    alloc_reset();
+
+    auto time1 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < number_of_passes; i++)
+    {
+        Dst result = fn(src[i]);
+
+        // Use it somehow just because
+        nothing += static_cast<unsigned int>(result.back());
+    }
+    auto time2 = std::chrono::steady_clock::now();
+
+    // Time, peak memory for one conversion and all memory allocated during the test
+    std::cout << std::chrono::duration<double, std::milli>(time2 - time1).count() << '\t'
+              << alloc_peak << '\t' << alloc_total / number_of_passes << '\t';
+}
+
+void test_performance()
+{
+    using string8 = std::basic_string<char, std::char_traits<char>, alloc_peak_counter<char>>;
+    using string16 = std::basic_string<char16_t, std::char_traits<char16_t>, alloc_peak_counter<char16_t>>;
+    using string32 = std::basic_string<char32_t, std::char_traits<char32_t>, alloc_peak_counter<char32_t>>;
+
+    unsigned int nothing = 0;
+
+    std::cout << "Source: " << strs[0].size() << " bytes in UTF-8, "
+              << strs16[0].size() * 2 << " bytes in UTF-16" << '\n';
+    std::cout << "\tDEFAULT\t\t\tEXACT" << '\n';
+    std::cout << "\tTIME\tPEAK\tALLOC\tTIME\tPEAK\tALLOC" << '\n';
+
+    for (int j = 0; j < 5; j++)
+    {
+        std::cout << "8->16\t";
+        test_one<string16>(strs, [](const std::string& s) {
+            return una::utf8to16<char, char16_t>(s, alloc_peak_counter<char16_t>{}); }, nothing);
+        test_one<string16>(strs, [](const std::string& s) {
+            return una::exact::utf8to16<char, char16_t>(s, alloc_peak_counter<char16_t>{}); }, nothing);
+        std::cout << '\n';
+
+        std::cout << "8->32\t";
+        test_one<string32>(strs, [](const std::string& s) {
+            return una::utf8to32<char, char32_t>(s, alloc_peak_counter<char32_t>{}); }, nothing);
+        test_one<string32>(strs, [](const std::string& s) {
+            return una::exact::utf8to32<char, char32_t>(s, alloc_peak_counter<char32_t>{}); }, nothing);
+        std::cout << '\n';
+
+        std::cout << "16->8\t";
+        test_one<string8>(strs16, [](const std::u16string& s) {
+            return una::utf16to8<char16_t, char>(s, alloc_peak_counter<char>{}); }, nothing);
+        test_one<string8>(strs16, [](const std::u16string& s) {
+            return una::exact::utf16to8<char16_t, char>(s, alloc_peak_counter<char>{}); }, nothing);
+        std::cout << '\n';
+    }
+
+    std::cout << nothing << '\n';
+}
@@ -102,6 +102,52 @@ typedef type_codept    type_char32; // Can be 32-bit or more signed/unsigned
 #include "../include/uni_algo/impl/impl_norm.h"
 #endif // UNI_ALGO_DISABLE_NORM
 
+// Compiled LIKE pattern that SQLite keeps for the pattern argument while it is the same,
+// so a table scan with LIKE case folds the pattern only once
+struct like_aux
+{
+    struct impl_case_like_pattern pattern;
+    type_codept escape;
+    type_codept* literal;
+    struct impl_case_searcher_unit* window;
+};
+
+static void like_aux_free(void* p)
+{
+    struct like_aux* aux = (struct like_aux*)p;
+    sqlite3_free(aux->window);
+    sqlite3_free(aux);
+}
+
+static struct like_aux* like_aux_compile(const char* str, size_t len, type_codept escape)
+{
+    // The literal is in the same memory after the struct
+    struct like_aux* aux = (struct like_aux*)sqlite3_malloc64(sizeof(struct like_aux) +
+                                                               sizeof(type_codept) * len * impl_max_case_expand);
+    if (!aux)
+        return NULL;
+
+    aux->escape = escape;
+    aux->literal = (type_codept*)(aux + 1);
+    aux->window = NULL;
+
+    impl_case_like_compile_utf8(&aux->pattern, str, str + len, '%', '_', escape, aux->literal);
+    impl_case_like_prepare(&aux->pattern, aux->literal);
+
+    if (aux->pattern.window)
+    {
+        aux->window = (struct impl_case_searcher_unit*)sqlite3_malloc64(sizeof(struct impl_case_searcher_unit) *
+                                                                        aux->pattern.window);
+        if (!aux->window)
+        {
+            sqlite3_free(aux);
+            return NULL;
+        }
+    }
+
+    return aux;
+}
+
 static void sqlite3_like_utf8(sqlite3_context* context, int argc, sqlite3_value** argv)
 {
     size_t len1 = (size_t)sqlite3_value_bytes(argv[1]);
@@ -131,9 +177,25 @@ static void sqlite3_like_utf8(sqlite3_context* context, int argc, sqlite3_value*
         }
     }
 
-    bool ret = impl_case_like_utf8(str1, str1 + len1, str2, str2 + len2, true, '%', '_', escape);
+    struct like_aux* aux = (struct like_aux*)sqlite3_get_auxdata(context, 0);
+    const bool cached = aux && aux->escape == escape;
+    if (!cached)
+    {
+        aux = like_aux_compile(str2, len2, escape);
+        if (!aux)
+        {
+            sqlite3_result_error_nomem(context);
+            return;
+        }
+    }
+
+    bool ret = impl_case_like_match_utf8(&aux->pattern, aux->literal, aux->window, str1, str1 + len1, str2, str2 + len2);
 
     sqlite3_result_int(context, ret ? 1 : 0);
+
+    // Note that SQLite can call the destructor right away so the pattern must not be used after this
+    if (!cached)
+        sqlite3_set_auxdata(context, 0, aux, like_aux_free);
 }
 
 static const char* internal_case_map_utf8(const char* str, size_t len, int mode, size_t* end)
@@ -23,6 +23,9 @@
 #include "../include/uni_algo/ranges_word.h"
 // Extensions
 #include "../include/uni_algo/ext/ascii.h"
+#include "../include/uni_algo/ext/file.h"
+#include "../include/uni_algo/ext/parallel.h"
+#include "../include/uni_algo/ext/case_cache.h"
 // Transliterators
 #include "../include/uni_algo/ext/translit/macedonian_to_latin_docs.h"
 #include "../include/uni_algo/ext/translit/japanese_kana_to_romaji_hepburn.h"
@@ -90,9 +93,26 @@
 #include "test_strict_iter_rev.h"
 
 #include "test_conv_and_iter.h"
+#include "test_simd.h"
+#include "test_conv_stream.h"
+#include "test_bounded.h"
+#include "test_file.h"
+#include "test_parallel.h"
+#include "test_norm_view.h"
+#include "test_norm_stream.h"
+#include "test_norm_casefold.h"
+#include "test_norm_search_key.h"
+#include "test_norm_compare.h"
+#include "test_norm_search.h"
+#include "test_norm_map.h"
+#include "test_case_searcher.h"
+#include "test_case_matcher.h"
+#include "test_case_like_pattern.h"
+#include "test_case_cache.h"
 
 #include "test_short_func.h"
 #include "test_alloc_func.h"
+#include "test_append_func.h"
 
 #include "test_ranges.h"
 
@@ -223,6 +243,10 @@ int main7()
     STATIC_TESTX(test_alloc_func_case());
     STATIC_TESTX(test_alloc_func_norm());
 
+    STATIC_TESTX(test_append_func_conv());
+    STATIC_TESTX(test_append_func_case());
+    STATIC_TESTX(test_append_func_norm());
+
     std::cout << "DONE: Functions" << '\n';
 
     STATIC_TESTX(test_ranges());
@@ -301,6 +325,79 @@ int main7()
     STATIC_TESTX(test_conv_and_iter_iter());
 
     std::cout << "DONE: Conversion and Ranges Extra" << '\n';
+
+    STATIC_TESTX(test_simd_valid_utf8());
+    STATIC_TESTX(test_simd_ascii_utf8to16_utf8to32());
+    STATIC_TESTX(test_simd_utf8to16());
+    STATIC_TESTX(test_simd_exact());
+    STATIC_TESTX(test_simd_case_map());
+
+    std::cout << "DONE: SIMD" << '\n';
+
+    STATIC_TESTX(test_conv_stream());
+
+    std::cout << "DONE: Conversion Stream" << '\n';
+
+    STATIC_TESTX(test_bounded_conv());
+    STATIC_TESTX(test_bounded_norm());
+
+    std::cout << "DONE: Bounded Conversion and Normalization" << '\n';
+
+    STATIC_TESTX(test_file_transform());
+
+    std::cout << "DONE: File Transform" << '\n';
+
+    STATIC_TESTX(test_parallel_norm());
+    STATIC_TESTX(test_parallel_conv());
+
+    std::cout << "DONE: Parallel Normalization and Conversion" << '\n';
+
+    STATIC_TESTX(test_norm_view());
+    STATIC_TESTX(test_norm_view_stream_safe());
+
+    std::cout << "DONE: Quick Check First Normalization" << '\n';
+
+    STATIC_TESTX(test_norm_stream());
+
+    std::cout << "DONE: Normalization Stream" << '\n';
+
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+    STATIC_TESTX(test_norm_casefold());
+
+    std::cout << "DONE: NFKC_Casefold" << '\n';
+#endif
+
+    STATIC_TESTX(test_norm_search_key());
+
+    std::cout << "DONE: Search Key" << '\n';
+
+    STATIC_TESTX(test_norm_compare());
+
+    std::cout << "DONE: Canonical Comparison" << '\n';
+
+    STATIC_TESTX(test_norm_search());
+
+    std::cout << "DONE: Canonical Search" << '\n';
+
+    STATIC_TESTX(test_norm_map());
+
+    std::cout << "DONE: Normalization Offset Map" << '\n';
+
+    STATIC_TESTX(test_case_searcher());
+
+    std::cout << "DONE: Caseless Searcher" << '\n';
+
+    STATIC_TESTX(test_case_matcher());
+
+    std::cout << "DONE: Caseless Multi-Pattern Search" << '\n';
+
+    STATIC_TESTX(test_case_like_pattern());
+
+    std::cout << "DONE: Precompiled LIKE Pattern" << '\n';
+
+    STATIC_TESTX(test_case_cache());
+
+    std::cout << "DONE: Case Cache" << '\n';
 #else
     std::cout << "SKIP: Conversion and Ranges Extra" << '\n';
 #endif
@@ -314,6 +411,7 @@ int main7()
     STATIC_TESTX(test_norm_detect());
     std::cout << "DONE: Detecting Normalization Forms" << '\n';
     STATIC_TESTX(test_norm_stream_safe());
+    STATIC_TESTX(test_norm_stream_safe_ascii());
     std::cout << "DONE: Normalization Stream-Safe Text Format" << '\n';
     STATIC_TESTX(test_norm_unaccent());
 
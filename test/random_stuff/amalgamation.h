@@ -235,6 +235,8 @@ void amalgam()
     // Internals must be first
     output << amalgam_part("uni_algo/internal/error.h");
     output << amalgam_part("uni_algo/internal/search.h");
+    output << amalgam_part("uni_algo/internal/simd.h");
+    output << amalgam_part("uni_algo/internal/bounded.h");
     output << amalgam_part("uni_algo/internal/ranges_core.h");
     output << amalgam_part("uni_algo/internal/ranges_translit.h");
 
@@ -258,6 +260,9 @@ void amalgam()
     // ASCII
     output << amalgam_part("uni_algo/ext/ascii.h");
 
+    // Case cache
+    output << amalgam_part("uni_algo/ext/case_cache.h");
+
     // Transliterators
     output << amalgam_part("uni_algo/ext/translit/macedonian_to_latin_docs.h");
     output << amalgam_part("uni_algo/ext/translit/japanese_kana_to_romaji_hepburn.h");
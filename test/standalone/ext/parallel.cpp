@@ -0,0 +1 @@
+#include "../../../include/uni_algo/ext/parallel.h"
@@ -18,6 +18,9 @@ target_sources(${PROJECT_NAME} PRIVATE
     "${PROJECT_SOURCE_DIR}/standalone/ranges_word.cpp"
     # Extensions
     "${PROJECT_SOURCE_DIR}/standalone/ext/ascii.cpp"
+    "${PROJECT_SOURCE_DIR}/standalone/ext/file.cpp"
+    "${PROJECT_SOURCE_DIR}/standalone/ext/parallel.cpp"
+    "${PROJECT_SOURCE_DIR}/standalone/ext/case_cache.cpp"
     "${PROJECT_SOURCE_DIR}/standalone/ext/translit/macedonian_to_latin_docs.cpp"
     "${PROJECT_SOURCE_DIR}/standalone/ext/translit/japanese_kana_to_romaji_hepburn.cpp"
     # Low-level (just in case)
@@ -85,6 +85,20 @@ test_constexpr bool test_alloc_func_conv()
     TESTX((una::strict::utf16to32<char16_t, char32_t>(u16str, error, alloc32) == u32str));
     TESTX((una::strict::utf32to16<char32_t, char16_t>(u32str, error, alloc16) == u16str));
 
+    TESTX((una::exact::utf8to16<char, char16_t>(str, alloc16) == u16str));
+    TESTX((una::exact::utf8to32<char, char32_t>(str, alloc32) == u32str));
+    TESTX((una::exact::utf16to8<char16_t, char>(u16str, alloc) == str));
+    TESTX((una::exact::utf32to8<char32_t, char>(u32str, alloc) == str));
+    TESTX((una::exact::utf16to32<char16_t, char32_t>(u16str, alloc32) == u32str));
+    TESTX((una::exact::utf32to16<char32_t, char16_t>(u32str, alloc16) == u16str));
+
+    TESTX((una::exact::strict::utf8to16<char, char16_t>(str, error, alloc16) == u16str));
+    TESTX((una::exact::strict::utf8to32<char, char32_t>(str, error, alloc32) == u32str));
+    TESTX((una::exact::strict::utf16to8<char16_t, char>(u16str, error, alloc) == str));
+    TESTX((una::exact::strict::utf32to8<char32_t, char>(u32str, error, alloc) == str));
+    TESTX((una::exact::strict::utf16to32<char16_t, char32_t>(u16str, error, alloc32) == u32str));
+    TESTX((una::exact::strict::utf32to16<char32_t, char16_t>(u32str, error, alloc16) == u16str));
+
     // REMINDER: Custom memory resourse
 #if 0
     //char buffer[64] = {};
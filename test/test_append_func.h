@@ -0,0 +1,234 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Test that functions that append to an existing string produce the same result
+// as functions that return a new string, keep the existing data and return the number of code units appended.
+
+test_constexpr bool test_append_func_conv()
+{
+    const std::string str = "\x41\xC2\xA9\xE2\x82\xAC\xF0\x9F\x98\x80";
+    const std::u16string u16str = u"\x0041\x00A9\x20AC\xD83D\xDE00";
+    const std::u32string u32str = U"\x00000041\x000000A9\x000020AC\x0001F600";
+
+    std::string dst8 = "prefix";
+    std::u16string dst16 = u"prefix";
+    std::u32string dst32 = U"prefix";
+
+    TESTX(una::utf8to16(std::string_view{str}, dst16) == u16str.size());
+    TESTX(dst16 == u"prefix" + u16str);
+    TESTX(una::utf8to32(std::string_view{str}, dst32) == u32str.size());
+    TESTX(dst32 == U"prefix" + u32str);
+    TESTX(una::utf16to8(std::u16string_view{u16str}, dst8) == str.size());
+    TESTX(dst8 == "prefix" + str);
+    TESTX(una::utf32to8(std::u32string_view{u32str}, dst8) == str.size());
+    TESTX(dst8 == "prefix" + str + str);
+    TESTX(una::utf16to32(std::u16string_view{u16str}, dst32) == u32str.size());
+    TESTX(dst32 == U"prefix" + u32str + u32str);
+    TESTX(una::utf32to16(std::u32string_view{u32str}, dst16) == u16str.size());
+    TESTX(dst16 == u"prefix" + u16str + u16str);
+
+    // Empty source does nothing
+    TESTX(una::utf8to16(std::string_view{}, dst16) == 0);
+    TESTX(dst16 == u"prefix" + u16str + u16str);
+
+    // Overwrite: clear and reuse the capacity
+    dst16.clear();
+    dst16.reserve(100);
+    const std::size_t capacity = dst16.capacity();
+    TESTX(una::utf8to16(std::string_view{str}, dst16) == u16str.size());
+    TESTX(dst16 == u16str);
+    TESTX(dst16.capacity() == capacity);
+
+    // Lenient mode replaces ill-formed sequences
+    dst16 = u"prefix";
+    TESTX(una::utf8to16(std::string_view{"\x41\x80\x42"}, dst16) == 3);
+    TESTX(dst16 == u"prefix\x0041\xFFFD\x0042");
+
+    una::error error;
+
+    dst8 = "prefix";
+    dst16 = u"prefix";
+    dst32 = U"prefix";
+
+    TESTX(una::strict::utf8to16(std::string_view{str}, error, dst16) == u16str.size());
+    TESTX(!error && dst16 == u"prefix" + u16str);
+    TESTX(una::strict::utf8to32(std::string_view{str}, error, dst32) == u32str.size());
+    TESTX(!error && dst32 == U"prefix" + u32str);
+    TESTX(una::strict::utf16to8(std::u16string_view{u16str}, error, dst8) == str.size());
+    TESTX(!error && dst8 == "prefix" + str);
+    TESTX(una::strict::utf32to8(std::u32string_view{u32str}, error, dst8) == str.size());
+    TESTX(!error && dst8 == "prefix" + str + str);
+    TESTX(una::strict::utf16to32(std::u16string_view{u16str}, error, dst32) == u32str.size());
+    TESTX(!error && dst32 == U"prefix" + u32str + u32str);
+    TESTX(una::strict::utf32to16(std::u32string_view{u32str}, error, dst16) == u16str.size());
+    TESTX(!error && dst16 == u"prefix" + u16str + u16str);
+
+    // Strict mode appends nothing if there is an error
+    dst8 = "prefix";
+    dst16 = u"prefix";
+    dst32 = U"prefix";
+
+    TESTX(una::strict::utf8to16(std::string_view{"\x41\x42\x80"}, error, dst16) == 0);
+    TESTX(error && error.pos() == 2 && dst16 == u"prefix");
+    TESTX(una::strict::utf8to32(std::string_view{"\x41\x42\x80"}, error, dst32) == 0);
+    TESTX(error && error.pos() == 2 && dst32 == U"prefix");
+    TESTX(una::strict::utf16to8(std::u16string_view{u"\x0041\xDC00"}, error, dst8) == 0);
+    TESTX(error && error.pos() == 1 && dst8 == "prefix");
+    TESTX(una::strict::utf32to8(std::u32string_view{U"\x00000041\x00110000"}, error, dst8) == 0);
+    TESTX(error && error.pos() == 1 && dst8 == "prefix");
+    TESTX(una::strict::utf16to32(std::u16string_view{u"\x0041\xDC00"}, error, dst32) == 0);
+    TESTX(error && error.pos() == 1 && dst32 == U"prefix");
+    TESTX(una::strict::utf32to16(std::u32string_view{U"\x00000041\x00110000"}, error, dst16) == 0);
+    TESTX(error && error.pos() == 1 && dst16 == u"prefix");
+
+    // The error is reset on success
+    TESTX(una::strict::utf8to16(std::string_view{str}, error, dst16) == u16str.size());
+    TESTX(!error && dst16 == u"prefix" + u16str);
+
+    return true;
+}
+
+test_constexpr bool test_append_func_case()
+{
+    const std::string str = "Straße ǅ ΣΑΣ";
+    const std::u16string u16str = u"Straße ǅ ΣΑΣ";
+
+    std::string dst8 = "prefix";
+    std::u16string dst16 = u"prefix";
+
+    std::string result8 = una::cases::to_lowercase_utf8<char>(str);
+    TESTX(una::cases::to_lowercase_utf8<char>(str, dst8) == result8.size());
+    TESTX(dst8 == "prefix" + result8);
+    result8 = una::cases::to_uppercase_utf8<char>(str);
+    dst8 = "prefix";
+    TESTX(una::cases::to_uppercase_utf8<char>(str, dst8) == result8.size());
+    TESTX(dst8 == "prefix" + result8);
+    result8 = una::cases::to_casefold_utf8<char>(str);
+    dst8 = "prefix";
+    TESTX(una::cases::to_casefold_utf8<char>(str, dst8) == result8.size());
+    TESTX(dst8 == "prefix" + result8);
+
+    std::u16string result16 = una::cases::to_lowercase_utf16<char16_t>(u16str);
+    TESTX(una::cases::to_lowercase_utf16<char16_t>(u16str, dst16) == result16.size());
+    TESTX(dst16 == u"prefix" + result16);
+    result16 = una::cases::to_uppercase_utf16<char16_t>(u16str);
+    dst16 = u"prefix";
+    TESTX(una::cases::to_uppercase_utf16<char16_t>(u16str, dst16) == result16.size());
+    TESTX(dst16 == u"prefix" + result16);
+    result16 = una::cases::to_casefold_utf16<char16_t>(u16str);
+    dst16 = u"prefix";
+    TESTX(una::cases::to_casefold_utf16<char16_t>(u16str, dst16) == result16.size());
+    TESTX(dst16 == u"prefix" + result16);
+
+#ifndef UNI_ALGO_DISABLE_FULL_CASE
+    const una::locale tr{"tr"};
+
+    result8 = una::cases::to_uppercase_utf8<char>("istanbul", tr);
+    dst8 = "prefix";
+    TESTX(una::cases::to_uppercase_utf8<char>("istanbul", tr, dst8) == result8.size());
+    TESTX(dst8 == "prefix" + result8);
+    result8 = una::cases::to_lowercase_utf8<char>("ISTANBUL", tr);
+    dst8 = "prefix";
+    TESTX(una::cases::to_lowercase_utf8<char>("ISTANBUL", tr, dst8) == result8.size());
+    TESTX(dst8 == "prefix" + result8);
+
+    result16 = una::cases::to_uppercase_utf16<char16_t>(u"istanbul", tr);
+    dst16 = u"prefix";
+    TESTX(una::cases::to_uppercase_utf16<char16_t>(u"istanbul", tr, dst16) == result16.size());
+    TESTX(dst16 == u"prefix" + result16);
+    result16 = una::cases::to_lowercase_utf16<char16_t>(u"ISTANBUL", tr);
+    dst16 = u"prefix";
+    TESTX(una::cases::to_lowercase_utf16<char16_t>(u"ISTANBUL", tr, dst16) == result16.size());
+    TESTX(dst16 == u"prefix" + result16);
+#endif // UNI_ALGO_DISABLE_FULL_CASE
+
+#ifndef UNI_ALGO_DISABLE_BREAK_WORD
+#ifndef UNI_ALGO_DISABLE_FULL_CASE
+    result8 = una::cases::to_titlecase_utf8<char>(str);
+    dst8 = "prefix";
+    TESTX(una::cases::to_titlecase_utf8<char>(str, dst8) == result8.size());
+    TESTX(dst8 == "prefix" + result8);
+    result8 = una::cases::to_titlecase_utf8<char>("istanbul", tr);
+    dst8 = "prefix";
+    TESTX(una::cases::to_titlecase_utf8<char>("istanbul", tr, dst8) == result8.size());
+    TESTX(dst8 == "prefix" + result8);
+
+    result16 = una::cases::to_titlecase_utf16<char16_t>(u16str);
+    dst16 = u"prefix";
+    TESTX(una::cases::to_titlecase_utf16<char16_t>(u16str, dst16) == result16.size());
+    TESTX(dst16 == u"prefix" + result16);
+    result16 = una::cases::to_titlecase_utf16<char16_t>(u"istanbul", tr);
+    dst16 = u"prefix";
+    TESTX(una::cases::to_titlecase_utf16<char16_t>(u"istanbul", tr, dst16) == result16.size());
+    TESTX(dst16 == u"prefix" + result16);
+#endif // UNI_ALGO_DISABLE_FULL_CASE
+#endif // UNI_ALGO_DISABLE_BREAK_WORD
+
+    return true;
+}
+
+test_constexpr bool test_append_func_norm()
+{
+    const std::string str = "A\xCC\x8A" "e\xCC\x81 \xC3\x85 \xEF\xAC\x81 \xE1\x84\x80\xE1\x85\xA1";
+    const std::u16string u16str = u"A\x030A" u"e\x0301 \x00C5 \xFB01 \x1100\x1161";
+
+    std::string dst8 = "prefix";
+    std::u16string dst16 = u"prefix";
+
+    std::string result8 = una::norm::to_nfc_utf8<char>(str);
+    TESTX(una::norm::to_nfc_utf8<char>(str, dst8) == result8.size());
+    TESTX(dst8 == "prefix" + result8);
+    result8 = una::norm::to_nfd_utf8<char>(str);
+    dst8 = "prefix";
+    TESTX(una::norm::to_nfd_utf8<char>(str, dst8) == result8.size());
+    TESTX(dst8 == "prefix" + result8);
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+    result8 = una::norm::to_nfkc_utf8<char>(str);
+    dst8 = "prefix";
+    TESTX(una::norm::to_nfkc_utf8<char>(str, dst8) == result8.size());
+    TESTX(dst8 == "prefix" + result8);
+    result8 = una::norm::to_nfkd_utf8<char>(str);
+    dst8 = "prefix";
+    TESTX(una::norm::to_nfkd_utf8<char>(str, dst8) == result8.size());
+    TESTX(dst8 == "prefix" + result8);
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_PROP
+    result8 = una::norm::to_unaccent_utf8<char>(str);
+    dst8 = "prefix";
+    TESTX(una::norm::to_unaccent_utf8<char>(str, dst8) == result8.size());
+    TESTX(dst8 == "prefix" + result8);
+#endif // UNI_ALGO_DISABLE_PROP
+
+    std::u16string result16 = una::norm::to_nfc_utf16<char16_t>(u16str);
+    TESTX(una::norm::to_nfc_utf16<char16_t>(u16str, dst16) == result16.size());
+    TESTX(dst16 == u"prefix" + result16);
+    result16 = una::norm::to_nfd_utf16<char16_t>(u16str);
+    dst16 = u"prefix";
+    TESTX(una::norm::to_nfd_utf16<char16_t>(u16str, dst16) == result16.size());
+    TESTX(dst16 == u"prefix" + result16);
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+    result16 = una::norm::to_nfkc_utf16<char16_t>(u16str);
+    dst16 = u"prefix";
+    TESTX(una::norm::to_nfkc_utf16<char16_t>(u16str, dst16) == result16.size());
+    TESTX(dst16 == u"prefix" + result16);
+    result16 = una::norm::to_nfkd_utf16<char16_t>(u16str);
+    dst16 = u"prefix";
+    TESTX(una::norm::to_nfkd_utf16<char16_t>(u16str, dst16) == result16.size());
+    TESTX(dst16 == u"prefix" + result16);
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+#ifndef UNI_ALGO_DISABLE_PROP
+    result16 = una::norm::to_unaccent_utf16<char16_t>(u16str);
+    dst16 = u"prefix";
+    TESTX(una::norm::to_unaccent_utf16<char16_t>(u16str, dst16) == result16.size());
+    TESTX(dst16 == u"prefix" + result16);
+#endif // UNI_ALGO_DISABLE_PROP
+
+    // Custom allocator
+    alloc_func<char> alloc;
+    std::basic_string<char, std::char_traits<char>, decltype(alloc)> dst_alloc = "prefix";
+    TESTX(una::norm::to_nfc_utf8<char>(str, dst_alloc) == una::norm::to_nfc_utf8<char>(str).size());
+    TESTX(dst_alloc == "prefix" + una::norm::to_nfc_utf8<char>(str, alloc));
+
+    return true;
+}
@@ -0,0 +1,293 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Bounded conversion and normalization test
+// The source is processed with a buffer of a fixed size again and again from the position where
+// the previous call stopped and the result must be the same as the whole conversion/normalization.
+// If nothing fits the buffer is doubled for one call.
+
+template<typename Dst, typename Src, class Fn>
+Dst test_bounded_loop(const Src& src, std::size_t buffer_size, Fn fn, una::error* error)
+{
+    Dst result;
+    std::basic_string<typename Dst::value_type> buffer;
+
+    std::size_t pos = 0;
+    std::size_t size = buffer_size;
+    while (pos < src.size())
+    {
+        buffer.resize(size);
+        const std::basic_string_view<typename Src::value_type> rest{src.data() + pos, src.size() - pos};
+        const una::bounded_result r = fn(rest, buffer.data(), buffer.size());
+        if (r.written > buffer.size() || r.read > rest.size())
+            return Dst{};
+        result.append(buffer.data(), r.written);
+
+        if (error && *error)
+        {
+            *error = una::error{error->get_code(), pos + error->pos()};
+            return result;
+        }
+
+        if (r.read == 0)
+        {
+            if (r.written != 0)
+                return Dst{};
+            size *= 2;
+            continue;
+        }
+        pos += r.read;
+        size = buffer_size;
+    }
+
+    return result;
+}
+
+template<typename Dst, typename Src, class Fn>
+bool test_bounded_compare(const Src& src, const Dst& whole, Fn fn)
+{
+    const std::size_t sizes[] = {1, 2, 3, 4, 5, 6, 7, 13, 64};
+    for (std::size_t size : sizes)
+    {
+        if (test_bounded_loop<Dst>(src, size, fn, nullptr) != whole)
+            return false;
+    }
+    return true;
+}
+
+template<typename Dst, typename Src, class Fn, class FnLenient>
+bool test_bounded_compare_strict(const Src& src, const una::error& whole_error, Fn fn, FnLenient fn_lenient)
+{
+    const std::size_t sizes[] = {1, 2, 3, 4, 5, 6, 7, 13, 64};
+    for (std::size_t size : sizes)
+    {
+        una::error error;
+        const Dst result = test_bounded_loop<Dst>(src, size, [&error, &fn](auto s, auto* d, std::size_t n) {
+            return fn(s, d, n, error);
+        }, &error);
+        if (static_cast<bool>(error) != static_cast<bool>(whole_error))
+            return false;
+        // Everything before the error must be converted
+        if (error && (error.pos() != whole_error.pos() || result != fn_lenient(src.substr(0, error.pos()))))
+            return false;
+        if (!error && result != fn_lenient(src))
+            return false;
+    }
+    return true;
+}
+
+bool test_bounded_utf8(const std::string& str)
+{
+    una::error error16, error32;
+    una::strict::utf8to16u(str, error16);
+    una::strict::utf8to32u(str, error32);
+
+    const auto to16 = [](std::string_view s, char16_t* d, std::size_t n) { return una::bounded::utf8to16(s, d, n); };
+    const auto to32 = [](std::string_view s, char32_t* d, std::size_t n) { return una::bounded::utf8to32(s, d, n); };
+    const auto to16_strict = [](std::string_view s, char16_t* d, std::size_t n, una::error& e) {
+        return una::bounded::strict::utf8to16(s, d, n, e); };
+    const auto to32_strict = [](std::string_view s, char32_t* d, std::size_t n, una::error& e) {
+        return una::bounded::strict::utf8to32(s, d, n, e); };
+    const auto to16_lenient = [](const std::string& s) { return una::utf8to16u(s); };
+    const auto to32_lenient = [](const std::string& s) { return una::utf8to32u(s); };
+
+    return test_bounded_compare(str, una::utf8to16u(str), to16) &&
+           test_bounded_compare(str, una::utf8to32u(str), to32) &&
+           test_bounded_compare_strict<std::u16string>(str, error16, to16_strict, to16_lenient) &&
+           test_bounded_compare_strict<std::u32string>(str, error32, to32_strict, to32_lenient);
+}
+
+bool test_bounded_utf16(const std::u16string& str)
+{
+    una::error error8, error32;
+    una::strict::utf16to8(str, error8);
+    una::strict::utf16to32u(str, error32);
+
+    const auto to8 = [](std::u16string_view s, char* d, std::size_t n) { return una::bounded::utf16to8(s, d, n); };
+    const auto to32 = [](std::u16string_view s, char32_t* d, std::size_t n) { return una::bounded::utf16to32(s, d, n); };
+    const auto to8_strict = [](std::u16string_view s, char* d, std::size_t n, una::error& e) {
+        return una::bounded::strict::utf16to8(s, d, n, e); };
+    const auto to32_strict = [](std::u16string_view s, char32_t* d, std::size_t n, una::error& e) {
+        return una::bounded::strict::utf16to32(s, d, n, e); };
+    const auto to8_lenient = [](const std::u16string& s) { return una::utf16to8(s); };
+    const auto to32_lenient = [](const std::u16string& s) { return una::utf16to32u(s); };
+
+    return test_bounded_compare(str, una::utf16to8(str), to8) &&
+           test_bounded_compare(str, una::utf16to32u(str), to32) &&
+           test_bounded_compare_strict<std::string>(str, error8, to8_strict, to8_lenient) &&
+           test_bounded_compare_strict<std::u32string>(str, error32, to32_strict, to32_lenient);
+}
+
+bool test_bounded_utf32(const std::u32string& str)
+{
+    una::error error8, error16;
+    una::strict::utf32to8(str, error8);
+    una::strict::utf32to16u(str, error16);
+
+    const auto to8 = [](std::u32string_view s, char* d, std::size_t n) { return una::bounded::utf32to8(s, d, n); };
+    const auto to16 = [](std::u32string_view s, char16_t* d, std::size_t n) { return una::bounded::utf32to16(s, d, n); };
+    const auto to8_strict = [](std::u32string_view s, char* d, std::size_t n, una::error& e) {
+        return una::bounded::strict::utf32to8(s, d, n, e); };
+    const auto to16_strict = [](std::u32string_view s, char16_t* d, std::size_t n, una::error& e) {
+        return una::bounded::strict::utf32to16(s, d, n, e); };
+    const auto to8_lenient = [](const std::u32string& s) { return una::utf32to8(s); };
+    const auto to16_lenient = [](const std::u32string& s) { return una::utf32to16u(s); };
+
+    return test_bounded_compare(str, una::utf32to8(str), to8) &&
+           test_bounded_compare(str, una::utf32to16u(str), to16) &&
+           test_bounded_compare_strict<std::string>(str, error8, to8_strict, to8_lenient) &&
+           test_bounded_compare_strict<std::u16string>(str, error16, to16_strict, to16_lenient);
+}
+
+bool test_bounded_conv()
+{
+    std::mt19937 gen{42};
+
+    // Uses the random string generator from test/test_simd.h
+    const std::size_t sizes[] = {0, 1, 10, 100, 1000};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 5; ++n)
+        {
+            const std::string str = test_simd_random_utf8(gen, size);
+            const std::u16string u16str = una::utf8to16u(str);
+            const std::u32string u32str = una::utf8to32u(str);
+
+            TESTX(test_bounded_utf8(str));
+            TESTX(test_bounded_utf16(u16str));
+            TESTX(test_bounded_utf32(u32str));
+
+            if (str.empty())
+                continue;
+
+            // Ill-formed and truncated
+            std::uniform_int_distribution<std::size_t> pos{0, str.size() - 1};
+            for (std::size_t i = 0; i < 10; ++i)
+            {
+                std::string s = str;
+                s[pos(gen)] = static_cast<char>(i * 7 + 0x80);
+                TESTX(test_bounded_utf8(s));
+                TESTX(test_bounded_utf8(str.substr(0, pos(gen))));
+
+                std::u16string s16 = u16str;
+                s16.insert(std::min(pos(gen), s16.size()), 1, (i % 2) ? u'\xD800' : u'\xDFFF');
+                TESTX(test_bounded_utf16(s16));
+
+                std::u32string s32 = u32str;
+                s32.insert(std::min(pos(gen), s32.size()), 1, (i % 2) ? U'\xD800' : static_cast<char32_t>(0x110000));
+                TESTX(test_bounded_utf32(s32));
+            }
+        }
+    }
+
+    // Stops when the next code point does not fit
+    char buffer[8] = {};
+    una::bounded_result r = una::bounded::utf32to8(U"\x0041\x00E9\x20AC\x0001F600", buffer, 5);
+    TESTX(r.read == 2 && r.written == 3 && std::string_view(buffer, r.written) == "\x41\xC3\xA9");
+    r = una::bounded::utf32to8(U"\x0041\x00E9\x20AC\x0001F600", buffer, 6);
+    TESTX(r.read == 3 && r.written == 6);
+    r = una::bounded::utf32to8(U"\x0001F600", buffer, 3);
+    TESTX(r.read == 0 && r.written == 0);
+
+    char16_t buffer16[8] = {};
+    r = una::bounded::utf8to16("\xF0\x9F\x98\x80\xF0\x9F\x98\x80", buffer16, 3);
+    TESTX(r.read == 4 && r.written == 2);
+
+    una::error error;
+    r = una::bounded::strict::utf8to16("ab\xFF" "cd", buffer16, std::size(buffer16), error);
+    TESTX(error && error.pos() == 2 && r.read == 2 && r.written == 2);
+    r = una::bounded::strict::utf8to16("abcd", buffer16, std::size(buffer16), error);
+    TESTX(!error && r.read == 4 && r.written == 4);
+
+    return true;
+}
+
+std::u32string test_bounded_random_norm(std::mt19937& gen, std::size_t size)
+{
+    // Starters, letters with accents, combining marks with different ccc, Hangul and compatibility characters
+    const char32_t cps[] = {
+        0x0041, 0x0061, 0x0065, 0x0020, 0x00C5, 0x00E9, 0x01FA, 0x1E69, 0x0301, 0x0302, 0x0307, 0x030A,
+        0x0323, 0x0327, 0x0345, 0x0F73, 0x1100, 0x1161, 0x11A8, 0xAC00, 0xAC01, 0xFB01, 0xFDFA, 0x2460,
+        0x212B, 0x0958, 0x0344, 0x1D160, 0x00A0, 0x3099, 0x304B, 0x0000, 0xFFFD, 0x0001F600};
+    std::uniform_int_distribution<std::size_t> index{0, std::size(cps) - 1};
+
+    std::u32string str32;
+    while (str32.size() < size)
+        str32.push_back(cps[index(gen)]);
+    return str32;
+}
+
+bool test_bounded_norm()
+{
+    std::mt19937 gen{42};
+
+    const std::size_t sizes[] = {0, 1, 10, 100, 1000};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 10; ++n)
+        {
+            const std::u32string str32 = test_bounded_random_norm(gen, size);
+            const std::string str = una::utf32to8(str32);
+            const std::u16string u16str = una::utf32to16u(str32);
+
+            TESTX(test_bounded_compare(str, una::norm::to_nfc_utf8(str),
+                [](std::string_view s, char* d, std::size_t k) { return una::norm::bounded::to_nfc_utf8(s, d, k); }));
+            TESTX(test_bounded_compare(str, una::norm::to_nfd_utf8(str),
+                [](std::string_view s, char* d, std::size_t k) { return una::norm::bounded::to_nfd_utf8(s, d, k); }));
+            TESTX(test_bounded_compare(u16str, una::norm::to_nfc_utf16(u16str),
+                [](std::u16string_view s, char16_t* d, std::size_t k) { return una::norm::bounded::to_nfc_utf16(s, d, k); }));
+            TESTX(test_bounded_compare(u16str, una::norm::to_nfd_utf16(u16str),
+                [](std::u16string_view s, char16_t* d, std::size_t k) { return una::norm::bounded::to_nfd_utf16(s, d, k); }));
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+            TESTX(test_bounded_compare(str, una::norm::to_nfkc_utf8(str),
+                [](std::string_view s, char* d, std::size_t k) { return una::norm::bounded::to_nfkc_utf8(s, d, k); }));
+            TESTX(test_bounded_compare(str, una::norm::to_nfkd_utf8(str),
+                [](std::string_view s, char* d, std::size_t k) { return una::norm::bounded::to_nfkd_utf8(s, d, k); }));
+            TESTX(test_bounded_compare(u16str, una::norm::to_nfkc_utf16(u16str),
+                [](std::u16string_view s, char16_t* d, std::size_t k) { return una::norm::bounded::to_nfkc_utf16(s, d, k); }));
+            TESTX(test_bounded_compare(u16str, una::norm::to_nfkd_utf16(u16str),
+                [](std::u16string_view s, char16_t* d, std::size_t k) { return una::norm::bounded::to_nfkd_utf16(s, d, k); }));
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
+        }
+    }
+
+    // FF9E is a starter in NFC/NFD but it has 1 initial non-starter in NFKD so it is not a boundary
+    // because it continues the run of non-starters and U+034F must be inserted within the run
+    std::u32string run32 = U"a";
+    run32.append(20, 0x0315);
+    run32.append(1, 0xFF9E);
+    run32.append(20, 0x0315);
+    const std::string run = una::utf32to8(run32);
+    TESTX(una::norm::to_nfc_utf8(run).find("\xCD\x8F") != std::string::npos);
+    TESTX(test_bounded_compare(run, una::norm::to_nfc_utf8(run),
+        [](std::string_view s, char* d, std::size_t k) { return una::norm::bounded::to_nfc_utf8(s, d, k); }));
+    TESTX(test_bounded_compare(run, una::norm::to_nfd_utf8(run),
+        [](std::string_view s, char* d, std::size_t k) { return una::norm::bounded::to_nfd_utf8(s, d, k); }));
+
+    // U+0958 is a starter with NFC_Quick_Check=No so a run of it is one long piece that is longer than
+    // the stack buffer, it is processed only when SizeX times the piece fits in the destination
+    std::string long_run;
+    for (std::size_t i = 0; i < 100; ++i)
+        long_run += "\xE0\xA5\x98";
+    TESTX(test_bounded_compare(long_run, una::norm::to_nfc_utf8(long_run),
+        [](std::string_view s, char* d, std::size_t k) { return una::norm::bounded::to_nfc_utf8(s, d, k); }));
+    std::string long_buffer(long_run.size() * 3, 0);
+    una::bounded_result r = una::norm::bounded::to_nfc_utf8(long_run, long_buffer.data(), long_buffer.size() - 1);
+    TESTX(r.read == 0 && r.written == 0);
+    r = una::norm::bounded::to_nfc_utf8(long_run, long_buffer.data(), long_buffer.size());
+    TESTX(r.read == long_run.size() && std::string_view(long_buffer.data(), r.written) == una::norm::to_nfc_utf8(long_run));
+    r = una::norm::bounded::to_nfc_utf8("ab" + long_run, long_buffer.data(), 64);
+    TESTX(r.read == 1 && r.written == 1);
+
+    // Stops before a letter with accents if it does not fit
+    char buffer[8] = {};
+    r = una::norm::bounded::to_nfc_utf8("abe\xCC\x81z", buffer, 3);
+    TESTX(r.read == 2 && r.written == 2);
+    r = una::norm::bounded::to_nfc_utf8("abe\xCC\x81z", buffer, 4);
+    TESTX(r.read == 5 && r.written == 4 && std::string_view(buffer, r.written) == "ab\xC3\xA9");
+    r = una::norm::bounded::to_nfd_utf8("a\xC3\xA9z", buffer, 3);
+    TESTX(r.read == 1 && r.written == 1);
+
+    return true;
+}
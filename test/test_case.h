@@ -334,6 +334,20 @@ test_constexpr bool test_case_like()
     TESTX(!una::caseless::like_utf8("ABC", "ABC%", U'%'));
     TESTX(!una::caseless::like_utf8("ABC", "ABC_", U'_'));
 
+    // The pattern ends before the string so the match must restart after the last %
+
+    TESTX(una::caseless::like_utf8("abcabc", "%ABC"));
+    TESTX(una::caseless::like_utf8("xabab", "%ab"));
+    TESTX(una::caseless::like_utf8("abcabc", "%A_C"));
+    TESTX(una::caseless::like_utf8("abxcabc", "A%C"));
+    TESTX(!una::caseless::like_utf8("abcabx", "%ABC"));
+#ifndef UNI_ALGO_DISABLE_FULL_CASE
+    TESTX(una::caseless::like_utf8("sss", "%SS"));
+    TESTX(una::caseless::like_utf8("xs\u00DF", "%SS"));
+    TESTX(!una::caseless::like_utf8("\u00DFs", "%SS"));
+    TESTX(!una::caseless::like_utf8("\uFB01", "%f\u0130%"));
+#endif // UNI_ALGO_DISABLE_FULL_CASE
+
     // Empty strings
 
     TESTX(!una::caseless::like_utf8("abc", ""));
@@ -0,0 +1,79 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Case cache test
+// The result must always be the same as the result of the function without the cache,
+// the number of cached strings must never exceed the capacity.
+
+bool test_case_cache()
+{
+    const std::string keys[] = {
+        "Alice", "BOB", "\xC3\x9F" "tra\xC3\x9F" "e", "\xEF\xAC\x81" "le", "\xE2\x84\xAA" "elvin", "", "\x80" "abc",
+        std::string(64, 'X'), std::string(65, 'Y') // The last one is longer than the default max size
+    };
+
+    unx::case_cache cache;
+    for (int i = 0; i < 3; ++i)
+    {
+        for (const std::string& key : keys)
+            TESTX(cache.transform_utf8(key) == una::cases::to_casefold_utf8(key));
+    }
+    TESTX(cache.misses() == std::size(keys) - 1);
+    TESTX(cache.hits() == (std::size(keys) - 1) * 2);
+    TESTX(cache.size() == std::size(keys) - 1);
+
+    cache.clear();
+    cache.reset_counters();
+    TESTX(cache.size() == 0);
+    TESTX(cache.transform_utf8("ABC") == "abc");
+    TESTX(cache.misses() == 1 && cache.hits() == 0);
+
+    // Disabled cache
+    unx::case_cache disabled{unx::case_cache_mode::casefold, 0};
+    TESTX(disabled.transform_utf8("ABC") == "abc");
+    TESTX(disabled.transform_utf8("ABC") == "abc");
+    TESTX(disabled.size() == 0 && disabled.hits() == 0);
+
+#if defined(UNI_ALGO_EXPERIMENTAL) && !defined(UNI_ALGO_DISABLE_COLLATE)
+    unx::case_cache sortkeys{unx::case_cache_mode::sortkey};
+    for (const std::string& key : keys)
+    {
+        TESTX(sortkeys.transform_utf8(key) == una::caseless::sortkey_utf8(key));
+        TESTX(sortkeys.transform_utf8(key) == una::caseless::sortkey_utf8(key));
+    }
+#endif
+
+    // Small cache with a lot of threads and more keys than the capacity so entries are replaced all the time
+    unx::case_cache small{unx::case_cache_mode::casefold, 100, 16};
+    std::vector<std::string> words;
+    for (std::size_t i = 0; i < 500; ++i)
+        words.push_back("Word" + std::to_string(i) + "\xC3\x9F");
+
+    std::atomic<bool> ok{true};
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < 8; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            std::mt19937 gen{static_cast<std::mt19937::result_type>(t)};
+            // Hot words are used much more often
+            std::uniform_int_distribution<std::size_t> hot{0, 49};
+            std::uniform_int_distribution<std::size_t> any{0, words.size() - 1};
+            for (int i = 0; i < 20000; ++i)
+            {
+                const std::string& word = words[(i % 4) ? hot(gen) : any(gen)];
+                if (small.transform_utf8(word) != una::cases::to_casefold_utf8(word))
+                    ok = false;
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    TESTX(ok);
+    TESTX(small.hits() + small.misses() == 8 * 20000);
+    TESTX(small.hits() > small.misses());
+    TESTX(small.size() <= 100);
+
+    return true;
+}
@@ -0,0 +1,74 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Precompiled LIKE pattern test
+// The result must always be the same as the result of una::caseless::like_utf8.
+
+bool test_case_like_pattern()
+{
+#ifdef UNI_ALGO_EXPERIMENTAL
+    const char* const atoms[] = {
+        "a", "A", "b", "s", "S", "f", "i", "I",
+        "\xC3\x9F", // U+00DF ß
+        "\xC5\xBF", // U+017F ſ
+        "\xEF\xAC\x81", // U+FB01 ﬁ
+        "\xEF\xAC\x83", // U+FB03 ﬃ
+        "\xC4\xB0", // U+0130 İ
+        "\xCE\x90", // U+0390 ΐ
+        "\xF0\x90\x90\x80", "\xF0\x90\x90\xA8", // U+10400 U+10428
+        "\x80", "\xE0\xA0", "\xF0" // Ill-formed
+    };
+    const char* const special[] = {"%", "_", "/", "%%"};
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> atom{0, std::size(atoms) - 1};
+    std::uniform_int_distribution<std::size_t> special_atom{0, std::size(special) - 1};
+    std::uniform_int_distribution<std::size_t> length{0, 4};
+    std::uniform_int_distribution<int> percent{0, 99};
+    auto random = [&](std::size_t size) {
+        std::string str;
+        for (std::size_t i = 0; i < size; ++i)
+            str += atoms[atom(gen)];
+        return str;
+    };
+
+    for (int n = 0; n < 20000; ++n)
+    {
+        const std::string string = random(length(gen) * 3);
+
+        // Simple patterns (most of them) and general patterns
+        std::string pattern;
+        if (percent(gen) < 50)
+            pattern += (percent(gen) < 50) ? "%" : "%%";
+        pattern += (percent(gen) < 30) ? string.substr(0, length(gen)) : random(length(gen));
+        if (percent(gen) < 20)
+            pattern += special[special_atom(gen)] + random(length(gen));
+        if (percent(gen) < 50)
+            pattern += (percent(gen) < 50) ? "%" : "%%";
+
+        TESTX(una::caseless::like_pattern{pattern}.match_utf8(string) == una::caseless::like_utf8(string, pattern));
+        TESTX(una::caseless::like_pattern(pattern, U'/').match_utf8(string) == una::caseless::like_utf8(string, pattern, U'/'));
+        TESTX(una::caseless::like_pattern{pattern}.match_utf8(string + string) == una::caseless::like_utf8(string + string, pattern));
+    }
+
+    // Long literal that does not fit the local window
+    const std::string literal = random(50);
+    const una::caseless::like_pattern contains{"%" + literal + "%"};
+    TESTX(contains.match_utf8("x" + una::cases::to_uppercase_utf8(literal) + "x"));
+    TESTX(contains.match_utf8("x" + literal + "x") == una::caseless::like_utf8("x" + literal + "x", "%" + literal + "%"));
+
+    const una::caseless::like_pattern prefix{"FFI%"};
+    TESTX(prefix.match_utf8("\xEF\xAC\x83" "abc"));
+    TESTX(!una::caseless::like_pattern{"FF%"}.match_utf8("\xEF\xAC\x83" "abc"));
+    TESTX(una::caseless::like_pattern{"%ABC"}.match_utf8("abcabc"));
+    TESTX(una::caseless::like_pattern{"%FFI"}.match_utf8("abc\xEF\xAC\x83"));
+    TESTX(!una::caseless::like_pattern{"%FI"}.match_utf8("abc\xEF\xAC\x83"));
+    TESTX(una::caseless::like_pattern{"%%"}.match_utf8("abc"));
+    TESTX(una::caseless::like_pattern{""}.match_utf8(""));
+    TESTX(!una::caseless::like_pattern{""}.match_utf8("abc"));
+    TESTX(una::caseless::like_pattern("%/%%", U'/').match_utf8("50%"));
+#endif // UNI_ALGO_EXPERIMENTAL
+
+    return true;
+}
@@ -0,0 +1,162 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Multi-pattern caseless search test
+// Every match must be a match of una::caseless::search_utf8/utf16 that starts at the same position,
+// the first match of a pattern must be the same as the result of una::caseless::search_utf8/utf16
+// and for well-formed strings all matches must be found.
+
+bool test_case_matcher_all(const std::string& haystack, const std::vector<std::string>& patterns)
+{
+    const una::caseless::matcher matcher{patterns};
+
+    // TESTX cannot be used inside the callback so the matches are checked after the search
+    std::vector<std::size_t> indexes;
+    std::vector<una::search> matches;
+    matcher.search_utf8(haystack, [&](std::size_t index, una::search match) {
+        indexes.push_back(index);
+        matches.push_back(match);
+    });
+
+    std::vector<std::vector<una::search>> found(patterns.size());
+    std::size_t last_end = 0;
+    for (std::size_t i = 0; i < matches.size(); ++i)
+    {
+        TESTX(indexes[i] < patterns.size());
+        TESTX(matches[i].end_pos() >= last_end);
+        last_end = matches[i].end_pos();
+        found[indexes[i]].push_back(matches[i]);
+    }
+
+    const bool valid = una::is_valid_utf8(haystack);
+
+    for (std::size_t i = 0; i < patterns.size(); ++i)
+    {
+        const una::search result = una::caseless::search_utf8(haystack, patterns[i]);
+        if (patterns[i].empty() || !result)
+        {
+            TESTX(found[i].empty());
+            continue;
+        }
+        TESTX(!found[i].empty());
+        TESTX(found[i][0].pos() == result.pos() && found[i][0].end_pos() == result.end_pos());
+
+        for (const una::search& match : found[i])
+        {
+            const una::search sub = una::caseless::search_utf8(std::string_view{haystack}.substr(match.pos()), patterns[i]);
+            TESTX(sub && sub.pos() == 0 && sub.end_pos() == match.end_pos() - match.pos());
+        }
+
+        if (valid)
+        {
+            std::size_t count = 0;
+            for (std::size_t pos = 0; pos < haystack.size(); ++pos)
+            {
+                if ((haystack[pos] & 0xC0) == 0x80)
+                    continue;
+                const una::search sub = una::caseless::search_utf8(std::string_view{haystack}.substr(pos), patterns[i]);
+                if (sub && sub.pos() == 0)
+                    ++count;
+            }
+            TESTX(count == found[i].size());
+        }
+    }
+
+    // The same in UTF-16
+    if (valid)
+    {
+        std::vector<std::u16string> patterns16;
+        for (const std::string& pattern : patterns)
+            patterns16.push_back(una::utf8to16u(pattern));
+        const una::caseless::matcher matcher16{patterns16};
+
+        const std::u16string haystack16 = una::utf8to16u(haystack);
+        std::vector<std::size_t> count16(patterns.size());
+        bool ok16 = true;
+        matcher16.search_utf16(haystack16, [&](std::size_t index, una::search match) {
+            const una::search sub = una::caseless::search_utf16(std::u16string_view{haystack16}.substr(match.pos()), patterns16[index]);
+            if (!sub || sub.pos() != 0 || sub.end_pos() != match.end_pos() - match.pos())
+                ok16 = false;
+            ++count16[index];
+        });
+        TESTX(ok16);
+        for (std::size_t i = 0; i < patterns.size(); ++i)
+            TESTX(count16[i] == found[i].size());
+    }
+
+    return true;
+}
+
+bool test_case_matcher()
+{
+    // The same atoms as in the caseless searcher test
+    const char* const atoms[] = {
+        "a", "A", "b", "s", "S", "k", "K", "f", "i", "I", " ",
+        "\xC3\x9F", "\xE1\xBA\x9E", "\xC5\xBF", "\xE2\x84\xAA", "\xEF\xAC\x81", "\xC4\xB0", "\xC4\xB1",
+        "\xCE\xA3", "\xCF\x83", "\xCF\x82", "\xF0\x90\x90\x80", "\xF0\x90\x90\xA8", "\xEF\xBF\xBD",
+        "\x80", "\xE0\xA0", "\xF0"
+    };
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> atom{0, std::size(atoms) - 1};
+    std::uniform_int_distribution<std::size_t> length{0, 4};
+    auto random = [&](std::size_t size) {
+        std::string str;
+        for (std::size_t i = 0; i < size; ++i)
+            str += atoms[atom(gen)];
+        return str;
+    };
+
+    const std::size_t sizes[] = {0, 1, 10, 100, 300};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 20; ++n)
+        {
+            const std::string haystack = random(size);
+
+            std::vector<std::string> patterns;
+            for (int i = 0; i < 10; ++i)
+                patterns.push_back(random(length(gen)));
+            // Substrings even in the middle of a code point and duplicates
+            std::uniform_int_distribution<std::size_t> index{0, haystack.size()};
+            for (int i = 0; i < 10; ++i)
+            {
+                std::size_t pos = index(gen);
+                std::size_t end = index(gen);
+                if (pos > end)
+                    std::swap(pos, end);
+                patterns.push_back(haystack.substr(pos, std::min<std::size_t>(end - pos, 12)));
+            }
+            patterns.push_back(patterns.back());
+
+            TESTX(test_case_matcher_all(haystack, patterns));
+        }
+    }
+
+    // Long pattern that does not fit the local window
+    const std::string long_pattern = random(100);
+    TESTX(test_case_matcher_all("x" + una::cases::to_lowercase_utf8(long_pattern) + "x", {long_pattern, "x"}));
+
+    // Overlapping matches in order of the end position and longer matches first
+    std::vector<std::pair<std::size_t, std::size_t>> result;
+    una::caseless::matcher{"he", "SHE", "his", "hers"}.search_utf8("uSHers", [&](std::size_t index, una::search match) {
+        result.emplace_back(index, match.pos());
+    });
+    TESTX((result == std::vector<std::pair<std::size_t, std::size_t>>{{1, 1}, {0, 2}, {3, 2}}));
+
+    // ß matches ss only as a whole
+    result.clear();
+    una::caseless::matcher{"ss", "s", "\xC3\x9F"}.search_utf8("\xC3\x9F" "ss", [&](std::size_t index, una::search match) {
+        result.emplace_back(index, match.end_pos());
+    });
+    TESTX((result == std::vector<std::pair<std::size_t, std::size_t>>{{0, 2}, {2, 2}, {1, 3}, {0, 4}, {2, 4}, {1, 4}}));
+
+    // No patterns and empty patterns
+    std::size_t count = 0;
+    una::caseless::matcher{}.search_utf8("abc", [&](std::size_t, una::search) { ++count; });
+    una::caseless::matcher{""}.search_utf16(u"abc", [&](std::size_t, una::search) { ++count; });
+    TESTX(count == 0);
+
+    return true;
+}
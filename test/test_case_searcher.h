@@ -0,0 +1,111 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Caseless searcher test
+// The result must always be the same as the result of una::caseless::search_utf8/utf16.
+
+bool test_case_searcher_all(const std::string& haystack, const std::string& needle)
+{
+    const una::caseless::searcher searcher{needle};
+
+    const una::search result = una::caseless::search_utf8(haystack, needle);
+    const una::search found = searcher.search_utf8(haystack);
+    TESTX(static_cast<bool>(found) == static_cast<bool>(result));
+    if (found)
+        TESTX(found.pos() == result.pos() && found.end_pos() == result.end_pos());
+
+    // The same in UTF-16 but only for well-formed strings because ill-formed sequences are not the same
+    if (una::is_valid_utf8(haystack) && una::is_valid_utf8(needle))
+    {
+        const std::u16string haystack16 = una::utf8to16u(haystack);
+        const std::u16string needle16 = una::utf8to16u(needle);
+        const una::caseless::searcher searcher16{needle16};
+
+        const una::search result16 = una::caseless::search_utf16(haystack16, needle16);
+        const una::search found16 = searcher16.search_utf16(haystack16);
+        TESTX(static_cast<bool>(found16) == static_cast<bool>(result16));
+        TESTX(static_cast<bool>(found16) == static_cast<bool>(found));
+        if (found16)
+            TESTX(found16.pos() == result16.pos() && found16.end_pos() == result16.end_pos());
+    }
+
+    return true;
+}
+
+bool test_case_searcher()
+{
+    // Code points with special case folding, different case folding to the same code point and ill-formed sequences
+    const char* const atoms[] = {
+        "a", "A", "b", "s", "S", "k", "K", "f", "i", "I", " ",
+        "\xC3\x9F", // U+00DF ß
+        "\xE1\xBA\x9E", // U+1E9E ẞ
+        "\xC5\xBF", // U+017F ſ
+        "\xE2\x84\xAA", // U+212A Kelvin sign
+        "\xEF\xAC\x81", // U+FB01 ﬁ
+        "\xC4\xB0", // U+0130 İ
+        "\xC4\xB1", // U+0131 ı
+        "\xCE\xA3", "\xCF\x83", "\xCF\x82", // Σ σ ς
+        "\xF0\x90\x90\x80", "\xF0\x90\x90\xA8", // U+10400 U+10428
+        "\xEF\xBF\xBD", // U+FFFD
+        "\x80", "\xE0\xA0", "\xF0" // Ill-formed
+    };
+
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> atom{0, std::size(atoms) - 1};
+    auto random = [&](std::size_t size) {
+        std::string str;
+        for (std::size_t i = 0; i < size; ++i)
+            str += atoms[atom(gen)];
+        return str;
+    };
+
+    const std::size_t sizes[] = {0, 1, 10, 100, 1000};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 10; ++n)
+        {
+            const std::string haystack = random(size);
+
+            std::uniform_int_distribution<std::size_t> index{0, haystack.size()};
+            for (int i = 0; i < 20; ++i)
+            {
+                std::size_t pos = index(gen);
+                std::size_t end = index(gen);
+                if (pos > end)
+                    std::swap(pos, end);
+
+                // Needles that start and end everywhere even in the middle of a code point and random
+                TESTX(test_case_searcher_all(haystack, haystack.substr(pos, end - pos)));
+                TESTX(test_case_searcher_all(haystack, una::cases::to_uppercase_utf8(haystack.substr(pos, end - pos))));
+                TESTX(test_case_searcher_all(haystack, random(1)));
+                TESTX(test_case_searcher_all(haystack, random(3)));
+            }
+        }
+    }
+
+    // Long needle that does not fit the local window
+    const std::string long_needle = random(100);
+    TESTX(test_case_searcher_all("x" + una::cases::to_lowercase_utf8(long_needle) + "x", long_needle));
+
+    // Default constructed searcher is empty needle
+    TESTX(una::caseless::searcher{}.search_utf8("abc").pos() == 0);
+    TESTX(una::caseless::searcher{}.search_utf16(u"").end_pos() == 0);
+
+    const una::caseless::searcher ss{"SS"};
+    TESTX(ss.search_utf8("Stra\xC3\x9F" "e").pos() == 4);
+    TESTX(ss.search_utf8("Stra\xC3\x9F" "e").end_pos() == 6);
+    TESTX(ss.search_utf16(u"Stra\x00DF" "e").pos() == 4);
+    TESTX(!una::caseless::searcher{"s"}.search_utf8("\xC3\x9F"));
+    TESTX(una::caseless::searcher{"\xEF\xAC\x81"}.search_utf8("xFI").pos() == 1);
+    TESTX(!una::caseless::searcher{"f"}.search_utf8("\xEF\xAC\x81"));
+    TESTX(una::caseless::searcher{"k"}.search_utf8("x\xE2\x84\xAA").pos() == 1);
+    TESTX(una::caseless::searcher{"\xE2\x84\xAA"}.search_utf16(u"xk").pos() == 1);
+    TESTX(una::caseless::searcher{"S"}.search_utf8("x\xC5\xBF").end_pos() == 3);
+    TESTX(una::caseless::searcher{"i\xCC\x87"}.search_utf8("x\xC4\xB0").pos() == 1);
+    TESTX(una::caseless::searcher{u"\x03C3"}.search_utf16(u"x\x03C2").pos() == 1);
+    TESTX(una::caseless::searcher{"\xEF\xBF\xBD" "b"}.search_utf8("a\x80" "b").pos() == 1);
+    TESTX(!una::caseless::searcher{"a"}.search_utf8(""));
+
+    return true;
+}
@@ -0,0 +1,167 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Streaming conversion test
+// The stream is fed with chunks of random sizes and the result must be the same as the whole conversion
+
+template<typename Stream, typename Dst, typename Src>
+Dst test_conv_stream_feed(const Src& src, std::mt19937& gen, std::size_t max_chunk, una::error* error)
+{
+    Stream stream;
+    Dst result;
+    std::basic_string<typename Dst::value_type> buffer(Stream::buffer_size(max_chunk), 0);
+
+    std::uniform_int_distribution<std::size_t> chunk_size{0, max_chunk};
+
+    std::size_t pos = 0;
+    while (pos < src.size())
+    {
+        const std::size_t size = std::min(chunk_size(gen), src.size() - pos);
+        const std::basic_string_view<typename Src::value_type> chunk{src.data() + pos, size};
+        pos += size;
+
+        std::size_t written = 0;
+        if (error)
+        {
+            written = stream.feed(chunk, buffer.data(), buffer.size(), *error);
+            if (*error)
+                return result.append(buffer.data(), written);
+        }
+        else
+            written = stream.feed(chunk, buffer.data(), buffer.size());
+        result.append(buffer.data(), written);
+    }
+
+    if (error)
+        result.append(buffer.data(), stream.finish(buffer.data(), buffer.size(), *error));
+    else
+        result.append(buffer.data(), stream.finish(buffer.data(), buffer.size()));
+
+    return result;
+}
+
+template<typename Stream, typename Dst, typename Src>
+bool test_conv_stream_compare(const Src& src, const Dst& whole, std::mt19937& gen)
+{
+    const std::size_t chunks[] = {1, 2, 3, 5, 16, 100};
+    for (std::size_t max_chunk : chunks)
+    {
+        if (test_conv_stream_feed<Stream, Dst>(src, gen, max_chunk, nullptr) != whole)
+            return false;
+    }
+    return true;
+}
+
+template<typename Stream, typename Dst, typename Src>
+bool test_conv_stream_compare_strict(const Src& src, const una::error& whole_error, std::mt19937& gen)
+{
+    const std::size_t chunks[] = {1, 2, 3, 5, 16, 100};
+    for (std::size_t max_chunk : chunks)
+    {
+        una::error error;
+        test_conv_stream_feed<Stream, Dst>(src, gen, max_chunk, &error);
+        if (static_cast<bool>(error) != static_cast<bool>(whole_error))
+            return false;
+        if (error && error.pos() != whole_error.pos())
+            return false;
+    }
+    return true;
+}
+
+bool test_conv_stream_utf8(const std::string& str, std::mt19937& gen)
+{
+    una::error error16, error32;
+    una::strict::utf8to16u(str, error16);
+    una::strict::utf8to32u(str, error32);
+
+    return test_conv_stream_compare<una::utf8to16_stream<>>(str, una::utf8to16u(str), gen) &&
+           test_conv_stream_compare<una::utf8to32_stream<>>(str, una::utf8to32u(str), gen) &&
+           test_conv_stream_compare_strict<una::utf8to16_stream<>, std::u16string>(str, error16, gen) &&
+           test_conv_stream_compare_strict<una::utf8to32_stream<>, std::u32string>(str, error32, gen);
+}
+
+bool test_conv_stream_utf16(const std::u16string& str, std::mt19937& gen)
+{
+    una::error error8, error32;
+    una::strict::utf16to8(str, error8);
+    una::strict::utf16to32u(str, error32);
+
+    return test_conv_stream_compare<una::utf16to8_stream<>>(str, una::utf16to8(str), gen) &&
+           test_conv_stream_compare<una::utf16to32_stream<>>(str, una::utf16to32u(str), gen) &&
+           test_conv_stream_compare_strict<una::utf16to8_stream<>, std::string>(str, error8, gen) &&
+           test_conv_stream_compare_strict<una::utf16to32_stream<>, std::u32string>(str, error32, gen);
+}
+
+bool test_conv_stream_utf32(const std::u32string& str, std::mt19937& gen)
+{
+    una::error error8, error16;
+    una::strict::utf32to8(str, error8);
+    una::strict::utf32to16u(str, error16);
+
+    return test_conv_stream_compare<una::utf32to8_stream<>>(str, una::utf32to8(str), gen) &&
+           test_conv_stream_compare<una::utf32to16_stream<>>(str, una::utf32to16u(str), gen) &&
+           test_conv_stream_compare_strict<una::utf32to8_stream<>, std::string>(str, error8, gen) &&
+           test_conv_stream_compare_strict<una::utf32to16_stream<>, std::u16string>(str, error16, gen);
+}
+
+bool test_conv_stream()
+{
+    std::mt19937 gen{42};
+
+    // Uses the random string generator from test/test_simd.h
+    const std::size_t sizes[] = {0, 1, 10, 100, 1000};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 5; ++n)
+        {
+            const std::string str = test_simd_random_utf8(gen, size);
+            const std::u16string u16str = una::utf8to16u(str);
+            const std::u32string u32str = una::utf8to32u(str);
+
+            TESTX(test_conv_stream_utf8(str, gen));
+            TESTX(test_conv_stream_utf16(u16str, gen));
+            TESTX(test_conv_stream_utf32(u32str, gen));
+
+            if (str.empty())
+                continue;
+
+            // Ill-formed and truncated
+            std::uniform_int_distribution<std::size_t> pos{0, str.size() - 1};
+            for (std::size_t i = 0; i < 20; ++i)
+            {
+                std::string s = str;
+                s[pos(gen)] = static_cast<char>(i + 0x80);
+                TESTX(test_conv_stream_utf8(s, gen));
+                TESTX(test_conv_stream_utf8(str.substr(0, pos(gen)), gen));
+
+                std::u16string s16 = u16str;
+                s16.insert(std::min(pos(gen), s16.size()), 1, (i % 2) ? u'\xD800' : u'\xDFFF');
+                TESTX(test_conv_stream_utf16(s16, gen));
+                TESTX(test_conv_stream_utf16(u16str.substr(0, std::min(pos(gen), u16str.size())), gen));
+
+                std::u32string s32 = u32str;
+                s32.insert(std::min(pos(gen), s32.size()), 1, (i % 2) ? U'\xD800' : static_cast<char32_t>(0x110000));
+                TESTX(test_conv_stream_utf32(s32, gen));
+            }
+        }
+    }
+
+    // The stream can be reused after finish
+    una::utf8to16_stream<> stream;
+    char16_t buffer[16] = {};
+    TESTX(stream.feed("\xE2\x82", buffer, std::size(buffer)) == 0);
+    TESTX(stream.feed("\xAC", buffer, std::size(buffer)) == 1 && buffer[0] == 0x20AC);
+    TESTX(stream.feed("\xE2\x82", buffer, std::size(buffer)) == 0);
+    TESTX(stream.finish(buffer, std::size(buffer)) == 1 && buffer[0] == 0xFFFD);
+    TESTX(stream.feed("abc", buffer, std::size(buffer)) == 3 && buffer[0] == 'a');
+
+    // Strict stream remembers the error
+    una::error error;
+    TESTX(stream.feed("ab\xFF", buffer, std::size(buffer), error) == 2 && error && error.pos() == 5);
+    TESTX(stream.feed("cd", buffer, std::size(buffer), error) == 0 && error && error.pos() == 5);
+    TESTX(stream.finish(buffer, std::size(buffer), error) == 0 && error && error.pos() == 5);
+    TESTX(stream.feed("cd", buffer, std::size(buffer), error) == 2 && !error);
+
+    return true;
+}
@@ -0,0 +1,131 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// File transform test
+// The source is transformed with chunks of different sizes and the result must be the same
+// as the result for the whole source. Files are not used here, only the chunking is tested.
+
+std::string test_file_chunks(std::string_view src, unx::file_transform mode, std::size_t chunk_size)
+{
+    std::string result;
+    std::size_t last_read = 0;
+    const bool ok = unx::transform_chunks(src, mode,
+        [&](const char* data, std::size_t size, std::size_t read) {
+            if (read <= last_read || read > src.size())
+                return false;
+            last_read = read;
+            result.append(data, size);
+            return true;
+        }, chunk_size);
+    if (!ok || last_read != src.size())
+        return "ERROR";
+    return result;
+}
+
+// Returns the biggest chunk of the source
+std::size_t test_file_max_chunk(std::string_view src, unx::file_transform mode, std::size_t chunk_size)
+{
+    std::size_t max = 0;
+    std::size_t last_read = 0;
+    unx::transform_chunks(src, mode,
+        [&](const char*, std::size_t, std::size_t read) {
+            max = std::max(max, read - last_read);
+            last_read = read;
+            return true;
+        }, chunk_size);
+    return max;
+}
+
+bool test_file_compare(std::string_view src)
+{
+    const std::u16string u16 = una::utf8to16u(src);
+    std::string u16le;
+    for (char16_t c : u16)
+    {
+        u16le.push_back(static_cast<char>(c & 0xFF));
+        u16le.push_back(static_cast<char>(c >> 8));
+    }
+
+    const std::size_t sizes[] = {1, 2, 3, 5, 7, 13, 64, 1000};
+    for (std::size_t size : sizes)
+    {
+        if (test_file_chunks(src, unx::file_transform::utf8to16, size) != u16le)
+            return false;
+        if (test_file_chunks(src, unx::file_transform::nfc, size) != una::norm::to_nfc_utf8(src))
+            return false;
+        if (test_file_chunks(src, unx::file_transform::lowercase, size) != una::cases::to_lowercase_utf8(src))
+            return false;
+        if (test_file_chunks(src, unx::file_transform::uppercase, size) != una::cases::to_uppercase_utf8(src))
+            return false;
+        if (test_file_chunks(src, unx::file_transform::casefold, size) != una::cases::to_casefold_utf8(src))
+            return false;
+    }
+    return true;
+}
+
+bool test_file_transform()
+{
+    std::mt19937 gen{42};
+
+    // Final sigma, combining marks and ill-formed sequences
+    const char32_t cps[] = {
+        0x0041, 0x0061, 0x0020, 0x002E, 0x00AD, 0x0301, 0x0323, 0x0345, 0x03A3, 0x03C3, 0x0391,
+        0x1100, 0x1161, 0x11A8, 0x212B, 0x00DF, 0x0130, 0xFB01, 0x1E9E, 0x2019, 0x0001F600};
+    std::uniform_int_distribution<std::size_t> index{0, std::size(cps) - 1};
+    std::uniform_int_distribution<int> bad{0, 19};
+
+    const std::size_t sizes[] = {0, 1, 10, 100, 1000};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 10; ++n)
+        {
+            std::string str;
+            while (str.size() < size)
+            {
+                if (bad(gen) == 0)
+                    str += "\xE2\x82";
+                else
+                    str += una::utf32to8(std::u32string(1, cps[index(gen)]));
+            }
+            TESTX(test_file_compare(str));
+        }
+    }
+
+    // No split positions for a long time
+    TESTX(test_file_compare(std::string(100, 'A') + std::string(50, '\xCC') + "\x81"));
+    TESTX(test_file_compare("\xCE\xA3" + std::string(100, '\xCC') + "\x81\xCE\xA3"));
+
+    std::string marks = "a";
+    for (int i = 0; i < 100; ++i)
+        marks += "\xCC\x81";
+    TESTX(test_file_compare(marks));
+
+    // Starter with initial non-starters in NFKD (U+FF9E) continues the run of non-starters
+    // so it is not a split position, otherwise U+034F is not inserted
+    std::string run = std::string(1000, 'x') + "a";
+    for (int i = 0; i < 29; ++i)
+        run += "\xCC\x81";
+    run += "\xEF\xBE\x9E\xCC\x81\xCC\x81\xCC\x81";
+    TESTX(una::norm::to_nfc_utf8(run).find("\xCD\x8F") != std::string::npos);
+    TESTX(test_file_chunks(run, unx::file_transform::nfc, 1024) == una::norm::to_nfc_utf8(run));
+    TESTX(test_file_compare(run));
+
+    // Letters only: chunks must be bounded for all transforms, lowercase too
+    std::string letters;
+    for (int i = 0; i < 10000; ++i)
+        letters += (i % 100 == 0) ? "\xCE\xA3" : "a";
+    const unx::file_transform modes[] = {unx::file_transform::utf8to16, unx::file_transform::nfc,
+        unx::file_transform::lowercase, unx::file_transform::uppercase, unx::file_transform::casefold};
+    for (unx::file_transform mode : modes)
+        TESTX(test_file_max_chunk(letters, mode, 1000) <= 1000 + 32);
+    TESTX(test_file_compare(letters));
+
+    // Final sigma context around the split position
+    TESTX(test_file_chunks("ab\xCE\xA3.'.cd", unx::file_transform::lowercase, 3) == "ab\xCF\x83.'.cd");
+    TESTX(test_file_chunks("ab\xCE\xA3.'. cd", unx::file_transform::lowercase, 5) == "ab\xCF\x82.'. cd");
+    TESTX(test_file_chunks(std::string(2000, '\'') + "\xCE\xA3" + std::string(2000, '.'), unx::file_transform::lowercase, 100) ==
+          una::cases::to_lowercase_utf8(std::string(2000, '\'') + "\xCE\xA3" + std::string(2000, '.')));
+
+    return true;
+}
@@ -721,6 +721,35 @@ test_constexpr bool test_norm_stream_safe()
     return true;
 }
 
+test_constexpr bool test_norm_stream_safe_ascii()
+{
+    // 00A8 with 1 trailing non-starter is followed by ASCII and 30 non-starters, so CGJ must not be produced
+    // This test to make sure that the counter of non-starters is reset by the block skip of ASCII in the fast loop
+    // Note: the strings are built with append because operator+ with a string literal triggers -Wrestrict in GCC 12
+
+    std::u32string NFC  = U"\x00A8\x00E0";
+    std::u32string NFD  = U"\x00A8\x0061";
+    std::u32string NFKC = U"\x0020\x0308\x00E0";
+    std::u32string NFKD = U"\x0020\x0308\x0061";
+
+    NFC.append(29, 0x0300);
+    NFD.append(30, 0x0300);
+    NFKC.append(29, 0x0300);
+    NFKD.append(30, 0x0300);
+
+    TESTX(una::utf32to8(NFC) == una::norm::to_nfc_utf8(una::utf32to8(NFD)));
+    TESTX(una::utf32to8(NFD) == una::norm::to_nfd_utf8(una::utf32to8(NFD)));
+    TESTX(una::utf32to8(NFKC) == una::norm::to_nfkc_utf8(una::utf32to8(NFD)));
+    TESTX(una::utf32to8(NFKD) == una::norm::to_nfkd_utf8(una::utf32to8(NFD)));
+
+    TESTX(una::utf32to16u(NFC) == una::norm::to_nfc_utf16(una::utf32to16u(NFD)));
+    TESTX(una::utf32to16u(NFD) == una::norm::to_nfd_utf16(una::utf32to16u(NFD)));
+    TESTX(una::utf32to16u(NFKC) == una::norm::to_nfkc_utf16(una::utf32to16u(NFD)));
+    TESTX(una::utf32to16u(NFKD) == una::norm::to_nfkd_utf16(una::utf32to16u(NFD)));
+
+    return true;
+}
+
 test_constexpr std::string to_nfc_utf8(std::string_view str)
 {
     return str | una::views::utf8 | una::views::norm::nfc | una::ranges::to_utf8<std::string>();
@@ -0,0 +1,91 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// NFKC_Casefold test
+// The result must be the same as mapping every code point with NFKC(casefold(NFKD(c)))
+// without default ignorable code points and then NFC of the whole string.
+
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+
+bool test_norm_casefold_ignorable(char32_t c)
+{
+    return c == 0x00AD || c == 0x034F || c == 0x061C || (c >= 0x115F && c <= 0x1160) ||
+           (c >= 0x17B4 && c <= 0x17B5) || (c >= 0x180B && c <= 0x180F) || (c >= 0x200B && c <= 0x200F) ||
+           (c >= 0x202A && c <= 0x202E) || (c >= 0x2060 && c <= 0x206F) || c == 0x3164 ||
+           (c >= 0xFE00 && c <= 0xFE0F) || c == 0xFEFF || c == 0xFFA0 || (c >= 0xFFF0 && c <= 0xFFF8) ||
+           (c >= 0x1BCA0 && c <= 0x1BCA3) || (c >= 0x1D173 && c <= 0x1D17A) || (c >= 0xE0000 && c <= 0xE0FFF);
+}
+
+std::string test_norm_casefold_slow(const std::u32string& str32)
+{
+    std::string result;
+    for (char32_t c : str32)
+    {
+        std::u32string decomp;
+        for (char32_t d : una::utf8to32u(una::norm::to_nfkd_utf8(una::utf32to8(std::u32string(1, c)))))
+        {
+            if (!test_norm_casefold_ignorable(d))
+                decomp.push_back(d);
+        }
+        result += una::norm::to_nfkc_utf8(una::cases::to_casefold_utf8(una::utf32to8(decomp)));
+    }
+    return una::norm::to_nfc_utf8(result);
+}
+
+bool test_norm_casefold()
+{
+    std::mt19937 gen{42};
+
+    // Code points with full case folding, folding that changes CCC, compatibility decompositions
+    // that need folding after decomposition and default ignorable code points
+    const char32_t cps[] = {
+        0x0041, 0x005A, 0x00C9, 0x00DF, 0x1E9E, 0x0130, 0x1F88, 0x1FB3, 0x0345, 0x037A, 0x3371, 0x2160,
+        0x01C5, 0x212A, 0x212B, 0xFB01, 0x00AD, 0x200D, 0xFE0F, 0xE0041, 0x0301, 0x0323, 0x1100, 0xAC00};
+    std::uniform_int_distribution<std::size_t> index{0, std::size(cps) - 1};
+    std::uniform_int_distribution<std::size_t> coin{0, 1};
+
+    const std::size_t sizes[] = {0, 1, 10, 100, 1000};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 10; ++n)
+        {
+            std::u32string str32 = test_bounded_random_norm(gen, size);
+            for (char32_t& c : str32)
+            {
+                if (coin(gen))
+                    c = cps[index(gen)];
+            }
+
+            const std::string str = una::utf32to8(str32);
+            const std::u16string u16str = una::utf32to16u(str32);
+            const std::string result = test_norm_casefold_slow(str32);
+
+            TESTX(una::norm::to_nfkc_casefold_utf8(str) == result);
+            TESTX(una::norm::to_nfkc_casefold_utf16(u16str) == una::utf8to16u(result));
+
+            // Already folded
+            TESTX(una::norm::to_nfkc_casefold_utf8(result) == result);
+
+            std::string dst = "x";
+            TESTX(una::norm::to_nfkc_casefold_utf8(std::string_view{str}, dst) == result.size() && dst == "x" + result);
+        }
+    }
+
+    TESTX(una::norm::to_nfkc_casefold_utf8("HELLO World") == "hello world");
+    TESTX(una::norm::to_nfkc_casefold_utf8("Stra\xC3\x9F" "e \xE1\xBA\x9E") == "strasse ss");
+    TESTX(una::norm::to_nfkc_casefold_utf8("\xE3\x8D\xB1") == "hpa"); // U+3371
+    TESTX(una::norm::to_nfkc_casefold_utf8("\xE2\x85\xA0") == "i"); // U+2160
+    TESTX(una::norm::to_nfkc_casefold_utf8("\xC4\xB0") == "i\xCC\x87"); // U+0130
+    TESTX(una::norm::to_nfkc_casefold_utf8("\xC3\x89" "COLE") == "\xC3\xA9" "cole");
+    TESTX(una::norm::to_nfkc_casefold_utf8("E\xCC\x81") == "\xC3\xA9");
+    TESTX(una::norm::to_nfkc_casefold_utf8("Soft\xC2\xAD" "hyphen\xE2\x80\x8D") == "softhyphen");
+    // U+0345 folds to a starter before canonical ordering
+    TESTX(una::norm::to_nfkc_casefold_utf8("\xCD\x85\xCC\x81") == "\xCE\xAF");
+    TESTX(una::norm::to_nfkc_casefold_utf16(u"\x1F88") == u"\x1F00\x03B9");
+    TESTX(una::norm::to_nfkc_casefold_utf8("\xF0\x9F\x98") == "\xEF\xBF\xBD");
+
+    return true;
+}
+
+#endif // UNI_ALGO_DISABLE_NFKC_NFKD
@@ -0,0 +1,67 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Canonical comparison test
+// The result must be the same as comparing the results of NFD in code point order.
+
+int test_norm_compare_slow(const std::string& str1, const std::string& str2)
+{
+    const std::u32string nfd1 = una::utf8to32u(una::norm::to_nfd_utf8(str1));
+    const std::u32string nfd2 = una::utf8to32u(una::norm::to_nfd_utf8(str2));
+    const int result = nfd1.compare(nfd2);
+    return (result > 0) - (result < 0);
+}
+
+bool test_norm_compare_all(const std::string& str1, const std::string& str2)
+{
+    const int result = test_norm_compare_slow(str1, str2);
+
+    TESTX(una::norm::compare_nfd_utf8(str1, str2) == result);
+    TESTX(una::norm::compare_nfd_utf8(str2, str1) == -result);
+    TESTX(una::norm::equals_nfd_utf8(str1, str2) == (result == 0));
+    TESTX(una::norm::compare_nfd_utf16(una::utf8to16u(str1), una::utf8to16u(str2)) == result);
+    TESTX(una::norm::equals_nfd_utf16(una::utf8to16u(str1), una::utf8to16u(str2)) == (result == 0));
+
+    return true;
+}
+
+bool test_norm_compare()
+{
+    std::mt19937 gen{42};
+
+    const std::size_t sizes[] = {0, 1, 10, 100, 1000};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 10; ++n)
+        {
+            std::string str = una::utf32to8(test_bounded_random_norm(gen, size));
+            // Ill-formed sequences
+            if (n % 2 && str.size() > 2)
+                str.insert(str.size() / 2, "\xE2\x82");
+
+            // Canonically equivalent forms must be equal
+            TESTX(test_norm_compare_all(str, una::norm::to_nfc_utf8(str)));
+            TESTX(test_norm_compare_all(str, una::norm::to_nfd_utf8(str)));
+            TESTX(test_norm_compare_all(una::norm::to_nfc_utf8(str), una::norm::to_nfd_utf8(str)));
+
+            // Prefixes and a difference in the middle
+            TESTX(test_norm_compare_all(str, str.substr(0, str.size() / 2)));
+            const std::string other = una::utf32to8(test_bounded_random_norm(gen, size));
+            TESTX(test_norm_compare_all(str, other));
+            TESTX(test_norm_compare_all(str + "\xCC\x81", str + "\xCC\xA3"));
+        }
+    }
+
+    TESTX(una::norm::equals_nfd_utf8("caf\xC3\xA9", "cafe\xCC\x81"));
+    TESTX(una::norm::equals_nfd_utf8("a\xCC\x81\xCC\xA3", "a\xCC\xA3\xCC\x81"));
+    TESTX(una::norm::equals_nfd_utf8("\xE1\xBA\xA1\xCC\x81", "a\xCC\x81\xCC\xA3"));
+    TESTX(una::norm::equals_nfd_utf16(u"\x212B", u"\x00C5"));
+    TESTX(!una::norm::equals_nfd_utf8("caf\xC3\xA9", "cafe"));
+    TESTX(una::norm::compare_nfd_utf8("cafe", "caf\xC3\xA9") == -1);
+    TESTX(una::norm::compare_nfd_utf8("caf\xC3\xA9", "cafe") == 1);
+    TESTX(una::norm::compare_nfd_utf8("", "") == 0);
+    TESTX(una::norm::compare_nfd_utf8("\xCC", "\xEF\xBF\xBD") == 0);
+
+    return true;
+}
@@ -0,0 +1,165 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Normalization with an offset map test
+// The result must be the same as the result of the normal function and every range of code points
+// in the result must be mapped to a range in the source that gives the same result when it is normalized.
+
+template<class Src, class FnMapped, class FnNorm>
+bool test_norm_map_compare(const Src& src, const std::vector<std::size_t>& cps, std::mt19937& gen, FnMapped mapped, FnNorm norm)
+{
+    una::norm::offset_map map;
+    const Src result = mapped(src, map);
+    if (result != norm(src))
+        return false;
+    if (map.source_size() != src.size() || map.normalized_size() != result.size())
+        return false;
+
+    // Code point boundaries in the source are mapped to the result and back
+    std::uniform_int_distribution<std::size_t> index{0, cps.size() - 1};
+    for (int i = 0; i < 20; ++i)
+    {
+        std::size_t pos = cps[index(gen)];
+        std::size_t end = cps[index(gen)];
+        if (pos > end)
+            std::swap(pos, end);
+
+        const std::size_t result_pos = map.to_normalized(pos);
+        const std::size_t result_end = map.to_normalized_end(end);
+        if (result_pos > result_end || result_end > result.size())
+            return false;
+
+        const std::size_t source_pos = map.to_source(result_pos);
+        const std::size_t source_end = map.to_source_end(result_end);
+        if (source_pos > pos || source_end < end)
+            return false;
+
+        if (norm(src.substr(source_pos, source_end - source_pos)) != result.substr(result_pos, result_end - result_pos))
+            return false;
+    }
+    return true;
+}
+
+template<class Src>
+std::vector<std::size_t> test_norm_map_cps(const Src& src)
+{
+    // Code point boundaries of well-formed source
+    std::vector<std::size_t> cps;
+    for (std::size_t i = 0; i < src.size(); ++i)
+    {
+        if constexpr (sizeof(typename Src::value_type) == 1)
+        {
+            if ((static_cast<unsigned char>(src[i]) & 0xC0) != 0x80)
+                cps.push_back(i);
+        }
+        else
+        {
+            if (src[i] < 0xDC00 || src[i] > 0xDFFF)
+                cps.push_back(i);
+        }
+    }
+    cps.push_back(src.size());
+    return cps;
+}
+
+bool test_norm_map()
+{
+    std::mt19937 gen{42};
+
+    const std::size_t sizes[] = {0, 1, 10, 100, 1000};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 10; ++n)
+        {
+            const std::string str = una::utf32to8(test_bounded_random_norm(gen, size));
+            const std::u16string u16str = una::utf8to16u(str);
+            const std::vector<std::size_t> cps = test_norm_map_cps(str);
+            const std::vector<std::size_t> cps16 = test_norm_map_cps(u16str);
+
+            TESTX(test_norm_map_compare(str, cps, gen,
+                [](const std::string& s, una::norm::offset_map& m) { return una::norm::to_nfc_utf8_mapped(s, m); },
+                [](const std::string& s) { return una::norm::to_nfc_utf8(s); }));
+            TESTX(test_norm_map_compare(str, cps, gen,
+                [](const std::string& s, una::norm::offset_map& m) { return una::norm::to_nfd_utf8_mapped(s, m); },
+                [](const std::string& s) { return una::norm::to_nfd_utf8(s); }));
+            TESTX(test_norm_map_compare(u16str, cps16, gen,
+                [](const std::u16string& s, una::norm::offset_map& m) { return una::norm::to_nfc_utf16_mapped(s, m); },
+                [](const std::u16string& s) { return una::norm::to_nfc_utf16(s); }));
+            TESTX(test_norm_map_compare(u16str, cps16, gen,
+                [](const std::u16string& s, una::norm::offset_map& m) { return una::norm::to_nfd_utf16_mapped(s, m); },
+                [](const std::u16string& s) { return una::norm::to_nfd_utf16(s); }));
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+            TESTX(test_norm_map_compare(str, cps, gen,
+                [](const std::string& s, una::norm::offset_map& m) { return una::norm::to_nfkc_utf8_mapped(s, m); },
+                [](const std::string& s) { return una::norm::to_nfkc_utf8(s); }));
+            TESTX(test_norm_map_compare(str, cps, gen,
+                [](const std::string& s, una::norm::offset_map& m) { return una::norm::to_nfkd_utf8_mapped(s, m); },
+                [](const std::string& s) { return una::norm::to_nfkd_utf8(s); }));
+            TESTX(test_norm_map_compare(u16str, cps16, gen,
+                [](const std::u16string& s, una::norm::offset_map& m) { return una::norm::to_nfkc_utf16_mapped(s, m); },
+                [](const std::u16string& s) { return una::norm::to_nfkc_utf16(s); }));
+            TESTX(test_norm_map_compare(u16str, cps16, gen,
+                [](const std::u16string& s, una::norm::offset_map& m) { return una::norm::to_nfkd_utf16_mapped(s, m); },
+                [](const std::u16string& s) { return una::norm::to_nfkd_utf16(s); }));
+#endif
+        }
+    }
+
+    una::norm::offset_map map;
+
+    // Copied spans are merged and mapped exactly, changed spans are mapped to their start or end
+    TESTX(una::norm::to_nfc_utf8_mapped("abce\xCC\x81 xyz", map) == "abc\xC3\xA9 xyz");
+    TESTX(map.size() == 3);
+    TESTX(map.to_source(2) == 2 && map.to_source(3) == 3 && map.to_source(4) == 3 && map.to_source(5) == 6);
+    TESTX(map.to_source_end(4) == 6 && map.to_source_end(5) == 6 && map.to_source_end(9) == 10);
+    TESTX(map.to_normalized(4) == 3 && map.to_normalized_end(4) == 5 && map.to_normalized(7) == 6);
+
+    // Already normalized is one span
+    TESTX(una::norm::to_nfc_utf8_mapped("abc \xC3\xA9", map) == "abc \xC3\xA9");
+    TESTX(map.size() == 1 && map.to_source(5) == 5);
+
+    // Long run of non-starters: U+034F (CGJ) is inserted in NFD so the run is a changed span
+    // that starts at the starter before it even though the source is NFD_Quick_Check=Yes
+    std::string run = "xyz a";
+    for (char32_t i = 0; i < 31; ++i)
+        run += una::utf32to8(std::u32string(1, 0x0300 + i % 16));
+    run += " end";
+    const std::string run_nfd = una::norm::to_nfd_utf8(run);
+    const std::size_t cgj = run_nfd.find("\xCD\x8F");
+    TESTX(cgj == 5 + 30 * 2);
+    TESTX(una::norm::to_nfd_utf8_mapped(run, map) == run_nfd);
+    TESTX(map.size() == 3);
+    TESTX(map.to_source(cgj) == 4 && map.to_source_end(cgj + 2) == 5 + 31 * 2);
+    TESTX(map.to_normalized(4) == 4 && map.to_normalized_end(5 + 31 * 2) == 5 + 31 * 2 + 2);
+    TESTX(map.to_source(run_nfd.size() - 3) == run.size() - 3);
+    TESTX(una::norm::to_nfc_utf16_mapped(una::utf8to16u(run), map) == una::norm::to_nfc_utf16(una::utf8to16u(run)));
+    TESTX(map.size() == 3);
+
+    // The last ASCII before a combining mark is in the changed span even if SIMD skipped it in a whole block
+    for (std::size_t pad = 0; pad <= 64; ++pad)
+    {
+        std::string str = std::string(pad, 'x') + "a\xCC\x81";
+        TESTX(una::norm::to_nfc_utf8_mapped(str, map) == std::string(pad, 'x') + "\xC3\xA1");
+        TESTX(map.to_source(pad) == pad && map.to_source_end(pad + 2) == pad + 3);
+        TESTX(test_norm_map_compare(str, test_norm_map_cps(str), gen,
+            [](const std::string& s, una::norm::offset_map& m) { return una::norm::to_nfc_utf8_mapped(s, m); },
+            [](const std::string& s) { return una::norm::to_nfc_utf8(s); }));
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+        str = std::string(pad, 'x') + "e\xCC\xA3\xCC\x82";
+        TESTX(una::norm::to_nfkc_utf8_mapped(str, map) == std::string(pad, 'x') + "\xE1\xBB\x87");
+        TESTX(test_norm_map_compare(str, test_norm_map_cps(str), gen,
+            [](const std::string& s, una::norm::offset_map& m) { return una::norm::to_nfkc_utf8_mapped(s, m); },
+            [](const std::string& s) { return una::norm::to_nfkc_utf8(s); }));
+#endif
+    }
+
+    // Ill-formed sequences
+    TESTX(una::norm::to_nfd_utf16_mapped(u"a\xD800" "b", map) == u"a\xFFFD" "b");
+    TESTX(map.to_source(1) == 1 && map.to_source_end(2) == 2);
+
+    TESTX(una::norm::to_nfc_utf8_mapped("", map).empty() && map.empty());
+    TESTX(map.to_source(0) == 0 && map.to_source_end(0) == 0);
+
+    return true;
+}
@@ -0,0 +1,122 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Canonical search test
+// The haystack is split into segments that start with a code point that decomposes to a starter,
+// the result must be the first run of whole segments that is equal to the needle after NFD.
+
+una::search test_norm_search_slow(const std::u32string& haystack, const std::u32string& needle)
+{
+    const std::u32string nfd = una::utf8to32u(una::norm::to_nfd_utf8(una::utf32to8(needle)));
+    if (nfd.empty())
+        return una::search{0, 0};
+
+    std::vector<std::size_t> offsets; // Segment start offsets in UTF-8 code units
+    std::vector<std::u32string> segments;
+    std::size_t offset = 0;
+    for (char32_t c : haystack)
+    {
+        const std::u32string d = una::utf8to32u(una::norm::to_nfd_utf8(una::utf32to8(std::u32string(1, c))));
+        if (segments.empty() || una::codepoint::prop_norm{d[0]}.Canonical_Combining_Class() == 0)
+        {
+            offsets.push_back(offset);
+            segments.emplace_back();
+        }
+        segments.back() += d;
+        offset += una::utf32to8(std::u32string(1, c)).size();
+    }
+    offsets.push_back(offset);
+
+    for (std::size_t i = 0; i < segments.size(); ++i)
+    {
+        std::u32string str;
+        for (std::size_t j = i; j < segments.size() && str.size() < nfd.size(); ++j)
+        {
+            str += una::utf8to32u(una::norm::to_nfd_utf8(una::utf32to8(segments[j])));
+            if (str == nfd)
+                return una::search{offsets[i], offsets[j + 1]};
+        }
+    }
+    return una::search{};
+}
+
+bool test_norm_search_all(const std::u32string& haystack, const std::u32string& needle)
+{
+    const una::search result = test_norm_search_slow(haystack, needle);
+    const std::string str = una::utf32to8(haystack);
+
+    const una::search found = una::norm::search_nfd_utf8(str, una::utf32to8(needle));
+    TESTX(static_cast<bool>(found) == static_cast<bool>(result));
+    if (found)
+    {
+        TESTX(found.pos() == result.pos() && found.end_pos() == result.end_pos());
+
+        // The same match in UTF-16 must cover the same code points
+        const std::u16string u16str = una::utf32to16u(haystack);
+        const una::search found16 = una::norm::search_nfd_utf16(u16str, una::utf32to16u(needle));
+        TESTX(found16);
+        TESTX(una::utf16to8(u16str.substr(found16.pos(), found16.end_pos() - found16.pos())) ==
+              str.substr(found.pos(), found.end_pos() - found.pos()));
+    }
+    else
+        TESTX(!una::norm::search_nfd_utf16(una::utf32to16u(haystack), una::utf32to16u(needle)));
+
+    return true;
+}
+
+bool test_norm_search()
+{
+    std::mt19937 gen{42};
+
+    const std::size_t sizes[] = {0, 1, 10, 100};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 10; ++n)
+        {
+            const std::u32string haystack = test_bounded_random_norm(gen, size);
+            const std::u32string nfc = una::utf8to32u(una::norm::to_nfc_utf8(una::utf32to8(haystack)));
+
+            std::uniform_int_distribution<std::size_t> index{0, haystack.size()};
+            for (int i = 0; i < 10; ++i)
+            {
+                std::size_t pos = index(gen);
+                std::size_t end = index(gen);
+                if (pos > end)
+                    std::swap(pos, end);
+
+                // Needles that start and end everywhere, canonically equivalent and random
+                const std::u32string needle = haystack.substr(pos, end - pos);
+                TESTX(test_norm_search_all(haystack, needle));
+                TESTX(test_norm_search_all(nfc, needle));
+                TESTX(test_norm_search_all(haystack, una::utf8to32u(una::norm::to_nfc_utf8(una::utf32to8(needle)))));
+                TESTX(test_norm_search_all(haystack, test_bounded_random_norm(gen, 2)));
+            }
+        }
+    }
+
+    // é in different forms
+    TESTX(una::norm::search_nfd_utf8("caf\xC3\xA9 bar", "e\xCC\x81").pos() == 3);
+    TESTX(una::norm::search_nfd_utf8("caf\xC3\xA9 bar", "e\xCC\x81").end_pos() == 5);
+    TESTX(una::norm::search_nfd_utf8("cafe\xCC\x81 bar", "\xC3\xA9").end_pos() == 6);
+    // A base without its combining marks or a mark without its base is not a match
+    TESTX(!una::norm::search_nfd_utf8("caf\xC3\xA9", "cafe"));
+    TESTX(!una::norm::search_nfd_utf8("cafe\xCC\x81", "cafe"));
+    TESTX(!una::norm::search_nfd_utf8("cafe\xCC\x81", "\xCC\x81"));
+    TESTX(una::norm::search_nfd_utf8("cafe cafe\xCC\x81", "cafe").pos() == 0);
+    TESTX(una::norm::search_nfd_utf8("cafe\xCC\x81 cafe", "cafe").pos() == 7);
+    TESTX(una::norm::search_nfd_utf8("xxe\xCC\x81 xe", "e").pos() == 7);
+    TESTX(una::norm::search_nfd_utf16(u"xxe xe\x0301", u"\x00E9").pos() == 5);
+    // Combining marks in a different order
+    TESTX(una::norm::search_nfd_utf8("xa\xCC\x81\xCC\xA3y", "\xE1\xBA\xA1\xCC\x81").pos() == 1);
+    // Hangul syllable is not split
+    TESTX(!una::norm::search_nfd_utf16(u"\xAC01", u"\xAC00"));
+    TESTX(una::norm::search_nfd_utf16(u"\x1100\xAC00", u"\xAC00").pos() == 1);
+    TESTX(una::norm::search_nfd_utf16(u"\x1100\x1161", u"\xAC00").end_pos() == 2);
+    // Empty needle, empty haystack and ill-formed haystack
+    TESTX(una::norm::search_nfd_utf8("abc", "").pos() == 0);
+    TESTX(!una::norm::search_nfd_utf8("", "a"));
+    TESTX(una::norm::search_nfd_utf8("a\x80" "b", "\xEF\xBF\xBD" "b").end_pos() == 3);
+
+    return true;
+}
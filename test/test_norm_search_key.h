@@ -0,0 +1,112 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Search key test
+// The result must be the same as decomposing every code point, removing Nonspacing Mark
+// and case folding it step by step and then NFC/NFKC of the whole string.
+
+std::string test_norm_search_key_slow(const std::u32string& str32, una::norm::search_key steps)
+{
+    const int mode = static_cast<int>(steps);
+    const bool compat = (mode & static_cast<int>(una::norm::search_key::compat)) != 0;
+
+    std::string result;
+    for (char32_t c : str32)
+    {
+        const std::string cp = una::utf32to8(std::u32string(1, c));
+        std::u32string decomp;
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+        if (compat)
+            decomp = una::utf8to32u(una::norm::to_nfkd_utf8(cp));
+        else
+#endif
+            decomp = una::utf8to32u(una::norm::to_nfd_utf8(cp));
+
+        std::u32string unaccented;
+        for (char32_t d : decomp)
+        {
+            if (!(mode & static_cast<int>(una::norm::search_key::unaccent)) ||
+                una::codepoint::get_general_category(d) != una::codepoint::general_category::Mn)
+                unaccented.push_back(d);
+        }
+
+        if (mode & static_cast<int>(una::norm::search_key::casefold))
+            result += una::cases::to_casefold_utf8(una::utf32to8(unaccented));
+        else
+            result += una::utf32to8(unaccented);
+    }
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+    if (compat)
+        return una::norm::to_nfkc_utf8(result);
+#endif
+    return una::norm::to_nfc_utf8(result);
+}
+
+bool test_norm_search_key()
+{
+    std::mt19937 gen{42};
+
+    // Code points with full case folding, folding that changes CCC and Nonspacing Mark with CCC=0
+    const char32_t cps[] = {
+        0x0041, 0x005A, 0x00C9, 0x00DF, 0x1E9E, 0x0130, 0x1F88, 0x0345, 0x3371, 0x2160, 0x01C5, 0x212B,
+        0x0E31, 0x0E48, 0x093F, 0x094D, 0x0301, 0x0323};
+    std::uniform_int_distribution<std::size_t> index{0, std::size(cps) - 1};
+    std::uniform_int_distribution<std::size_t> coin{0, 1};
+
+    const una::norm::search_key modes[] = {
+        una::norm::search_key::nfc,
+        una::norm::search_key::casefold,
+        una::norm::search_key::unaccent,
+        una::norm::search_key::casefold | una::norm::search_key::unaccent,
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+        una::norm::search_key::compat,
+        una::norm::search_key::compat | una::norm::search_key::casefold,
+        una::norm::search_key::compat | una::norm::search_key::unaccent,
+        una::norm::search_key::compat | una::norm::search_key::casefold | una::norm::search_key::unaccent,
+#endif
+    };
+
+    const std::size_t sizes[] = {0, 1, 10, 100, 1000};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 10; ++n)
+        {
+            std::u32string str32 = test_bounded_random_norm(gen, size);
+            for (char32_t& c : str32)
+            {
+                if (coin(gen))
+                    c = cps[index(gen)];
+            }
+
+            const std::string str = una::utf32to8(str32);
+            const std::u16string u16str = una::utf32to16u(str32);
+
+            for (una::norm::search_key steps : modes)
+            {
+                const std::string result = test_norm_search_key_slow(str32, steps);
+
+                TESTX(una::norm::to_search_key_utf8(str, steps) == result);
+                TESTX(una::norm::to_search_key_utf16(u16str, steps) == una::utf8to16u(result));
+
+                std::string dst = "x";
+                TESTX(una::norm::to_search_key_utf8(std::string_view{str}, steps, dst) == result.size() && dst == "x" + result);
+            }
+
+            TESTX(una::norm::to_search_key_utf8(str, una::norm::search_key::nfc) == una::norm::to_nfc_utf8(str));
+        }
+    }
+
+    TESTX(una::norm::to_search_key_utf8("Caf\xC3\xA9 NA\xC3\x8FVE Stra\xC3\x9F" "e") == "cafe naive strasse");
+    TESTX(una::norm::to_search_key_utf8("Caf\xC3\xA9", una::norm::search_key::casefold) == "caf\xC3\xA9");
+    TESTX(una::norm::to_search_key_utf8("Cafe\xCC\x81", una::norm::search_key::unaccent) == "Cafe");
+    TESTX(una::norm::to_search_key_utf16(u"\x2460" "CHE") == u"\x2460" "che");
+    // U+0345 is removed before it is folded to a letter
+    TESTX(una::norm::to_search_key_utf8("\xE1\xBE\xB3") == "\xCE\xB1"); // U+1FB3
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+    TESTX(una::norm::to_search_key_utf8("\xEF\xAC\x81" "CH\xC3\x89", una::norm::search_key::casefold |
+        una::norm::search_key::unaccent | una::norm::search_key::compat) == "fiche");
+#endif
+
+    return true;
+}
@@ -0,0 +1,107 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Streaming normalization test
+// The stream is fed with chunks of random sizes and the result must be the same as the whole normalization
+
+template<typename Stream, typename Src>
+Src test_norm_stream_feed(const Src& src, std::mt19937& gen, std::size_t max_chunk, bool* bounded)
+{
+    Stream stream;
+    Src result;
+
+    std::uniform_int_distribution<std::size_t> chunk_size{0, max_chunk};
+
+    auto sink = [&result, bounded](std::basic_string_view<typename Src::value_type> piece) {
+        if (piece.empty() || piece.size() > 256) // Never empty and always bounded
+            *bounded = false;
+        result.append(piece.data(), piece.size());
+    };
+
+    std::size_t pos = 0;
+    while (pos < src.size())
+    {
+        const std::size_t size = std::min(chunk_size(gen), src.size() - pos);
+        stream.feed({src.data() + pos, size}, sink);
+        pos += size;
+    }
+    stream.finish(sink);
+
+    return result;
+}
+
+template<typename Stream, typename Src>
+bool test_norm_stream_compare(const Src& src, const Src& whole, std::mt19937& gen)
+{
+    const std::size_t chunks[] = {1, 2, 3, 5, 16, 100};
+    for (std::size_t max_chunk : chunks)
+    {
+        bool bounded = true;
+        if (test_norm_stream_feed<Stream>(src, gen, max_chunk, &bounded) != whole || !bounded)
+            return false;
+    }
+    return true;
+}
+
+bool test_norm_stream_all(const std::string& str, std::mt19937& gen)
+{
+    const std::u16string u16str = una::utf8to16u(str);
+    const std::u32string u32str = una::utf8to32u(str);
+
+    TESTX(test_norm_stream_compare<una::norm::nfc_stream<>>(str, una::norm::to_nfc_utf8(str), gen));
+    TESTX(test_norm_stream_compare<una::norm::nfd_stream<>>(str, una::norm::to_nfd_utf8(str), gen));
+    TESTX(test_norm_stream_compare<una::norm::nfc_stream<char16_t>>(u16str, una::norm::to_nfc_utf16(u16str), gen));
+    TESTX(test_norm_stream_compare<una::norm::nfd_stream<char16_t>>(u16str, una::norm::to_nfd_utf16(u16str), gen));
+    TESTX(test_norm_stream_compare<una::norm::nfc_stream<char32_t>>(u32str, una::utf8to32u(una::norm::to_nfc_utf8(str)), gen));
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+    TESTX(test_norm_stream_compare<una::norm::nfkc_stream<>>(str, una::norm::to_nfkc_utf8(str), gen));
+    TESTX(test_norm_stream_compare<una::norm::nfkd_stream<>>(str, una::norm::to_nfkd_utf8(str), gen));
+    TESTX(test_norm_stream_compare<una::norm::nfkc_stream<char16_t>>(u16str, una::norm::to_nfkc_utf16(u16str), gen));
+    TESTX(test_norm_stream_compare<una::norm::nfkd_stream<char16_t>>(u16str, una::norm::to_nfkd_utf16(u16str), gen));
+#endif
+
+    return true;
+}
+
+bool test_norm_stream()
+{
+    std::mt19937 gen{42};
+
+    const std::size_t sizes[] = {0, 1, 10, 100, 1000};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 10; ++n)
+        {
+            std::string str = una::utf32to8(test_bounded_random_norm(gen, size));
+            // Ill-formed sequences
+            if (n % 2 && str.size() > 2)
+            {
+                str.insert(str.size() / 2, "\xE2\x82");
+                str = "\xCC" + str;
+                str += "\xF0\x9F\x98";
+            }
+            TESTX(test_norm_stream_all(str, gen));
+        }
+    }
+
+    // Long sequence of non-starters, CGJ must be inserted the same way
+    std::string marks = "a";
+    for (int i = 0; i < 1000; ++i)
+        marks += "\xCC\x81\xCC\xA3";
+    TESTX(test_norm_stream_all(marks, gen));
+
+    // The stream can be reused after finish
+    una::norm::nfc_stream<> stream;
+    std::string result;
+    auto sink = [&result](std::string_view piece) { result.append(piece.data(), piece.size()); };
+    stream.feed("e\xCC", sink);
+    stream.finish(sink);
+    stream.feed("e", sink);
+    TESTX(result == "e\xEF\xBF\xBD"); // The last code point is held back until it is stable
+    stream.feed("\xCC\x81", sink);
+    stream.finish(sink);
+    TESTX(result == "e\xEF\xBF\xBD\xC3\xA9");
+
+    return true;
+}
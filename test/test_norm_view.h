@@ -0,0 +1,187 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Quick check first normalization test
+// The result must be the same as the result of the normal function and it must be
+// the source itself when the quick check says the source is already normalized
+// and the normal function doesn't insert U+034F (see test_norm_stream_safe).
+
+template<class FnView, class Src, class Dst>
+bool test_norm_view_compare(const Src& src, const Dst& whole, bool is_yes, FnView fn)
+{
+    Dst buffer = Dst(100, 'x'); // The previous content must be replaced
+    const auto result = fn(src, buffer);
+    if (result != whole)
+        return false;
+    if (is_yes && result.data() != src.data())
+        return false;
+    if (!is_yes && result.data() != buffer.data())
+        return false;
+    return true;
+}
+
+bool test_norm_view_all(const std::string& str)
+{
+    const std::u16string u16str = una::utf8to16u(str);
+    const std::string_view s = str;
+    const std::u16string_view s16 = u16str;
+
+    TESTX(test_norm_view_compare(s, una::norm::to_nfc_utf8(s), una::norm::is_nfc_utf8(s) && una::norm::to_nfc_utf8(s) == s,
+        [](std::string_view v, std::string& b) { return una::norm::to_nfc_utf8_view(v, b); }));
+    TESTX(test_norm_view_compare(s, una::norm::to_nfd_utf8(s), una::norm::is_nfd_utf8(s) && una::norm::to_nfd_utf8(s) == s,
+        [](std::string_view v, std::string& b) { return una::norm::to_nfd_utf8_view(v, b); }));
+    TESTX(test_norm_view_compare(s16, una::norm::to_nfc_utf16(s16), una::norm::is_nfc_utf16(s16) && una::norm::to_nfc_utf16(s16) == s16,
+        [](std::u16string_view v, std::u16string& b) { return una::norm::to_nfc_utf16_view(v, b); }));
+    TESTX(test_norm_view_compare(s16, una::norm::to_nfd_utf16(s16), una::norm::is_nfd_utf16(s16) && una::norm::to_nfd_utf16(s16) == s16,
+        [](std::u16string_view v, std::u16string& b) { return una::norm::to_nfd_utf16_view(v, b); }));
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+    TESTX(test_norm_view_compare(s, una::norm::to_nfkc_utf8(s), una::norm::is_nfkc_utf8(s) && una::norm::to_nfkc_utf8(s) == s,
+        [](std::string_view v, std::string& b) { return una::norm::to_nfkc_utf8_view(v, b); }));
+    TESTX(test_norm_view_compare(s, una::norm::to_nfkd_utf8(s), una::norm::is_nfkd_utf8(s) && una::norm::to_nfkd_utf8(s) == s,
+        [](std::string_view v, std::string& b) { return una::norm::to_nfkd_utf8_view(v, b); }));
+    TESTX(test_norm_view_compare(s16, una::norm::to_nfkc_utf16(s16), una::norm::is_nfkc_utf16(s16) && una::norm::to_nfkc_utf16(s16) == s16,
+        [](std::u16string_view v, std::u16string& b) { return una::norm::to_nfkc_utf16_view(v, b); }));
+    TESTX(test_norm_view_compare(s16, una::norm::to_nfkd_utf16(s16), una::norm::is_nfkd_utf16(s16) && una::norm::to_nfkd_utf16(s16) == s16,
+        [](std::u16string_view v, std::u16string& b) { return una::norm::to_nfkd_utf16_view(v, b); }));
+#endif
+
+    return true;
+}
+
+bool test_norm_view()
+{
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> ascii{0, 40};
+
+    const std::size_t sizes[] = {0, 1, 10, 100, 1000};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 10; ++n)
+        {
+            // ASCII runs of different lengths so SIMD blocks end everywhere
+            std::string str(ascii(gen), 'a');
+            str += una::utf32to8(test_bounded_random_norm(gen, size));
+            str += std::string(ascii(gen), 'b');
+            TESTX(test_norm_view_all(str));
+
+            // Already normalized
+            TESTX(test_norm_view_all(una::norm::to_nfc_utf8(str)));
+            TESTX(test_norm_view_all(una::norm::to_nfd_utf8(str)));
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+            TESTX(test_norm_view_all(una::norm::to_nfkc_utf8(str)));
+            TESTX(test_norm_view_all(una::norm::to_nfkd_utf8(str)));
+#endif
+            // Ill-formed sequences
+            if (str.size() > 2)
+            {
+                str.insert(str.size() / 2, "\xE2\x82");
+                TESTX(test_norm_view_all(str));
+            }
+        }
+    }
+
+    // The first code point that fails the check is after ASCII blocks and after a boundary
+    std::string str = std::string(40, 'a') + "\xC3\xA9" "e\xCC\x81";
+    std::string buffer;
+    TESTX(una::norm::to_nfc_utf8_view(std::string_view{str}, buffer) == std::string(40, 'a') + "\xC3\xA9\xC3\xA9");
+    // Wrong order of combining marks after a starter
+    str = std::string(40, 'a') + "a\xCC\x81\xCC\xA3";
+    TESTX(una::norm::to_nfc_utf8_view(std::string_view{str}, buffer) == std::string(40, 'a') + "\xE1\xBA\xA1\xCC\x81");
+    // Already normalized ASCII
+    str = std::string(100, 'a');
+    TESTX(una::norm::to_nfc_utf8_view(std::string_view{str}, buffer).data() == str.data());
+
+    // The last ASCII before a combining mark is composed with it even if SIMD skipped it in a whole block
+    for (std::size_t pad = 0; pad <= 64; ++pad)
+    {
+        str = std::string(pad, 'x') + "a\xCC\x81";
+        TESTX(una::norm::to_nfc_utf8_view(std::string_view{str}, buffer) == std::string(pad, 'x') + "\xC3\xA1");
+        TESTX(test_norm_view_all(str));
+        str = std::string(pad, 'x') + "e\xCC\xA3\xCC\x82";
+        TESTX(una::norm::to_nfc_utf8_view(std::string_view{str}, buffer) == std::string(pad, 'x') + "\xE1\xBB\x87");
+        TESTX(test_norm_view_all(str));
+    }
+
+    return true;
+}
+
+bool test_norm_view_stream_safe()
+{
+    // Note: 0x034F is U+034F COMBINING GRAPHEME JOINER (CGJ) that must be inserted within long sequences (30) of non-starters
+    // The quick check doesn't care about it so the view must not return the source for such sequences
+
+    std::u32string str32 = U"a";
+    str32.append(35, 0x0315);
+    std::u32string cgj32 = U"a";
+    cgj32.append(30, 0x0315);
+    cgj32.append(1, 0x034F);
+    cgj32.append(5, 0x0315);
+
+    std::string str = std::string(40, 'x') + una::utf32to8(str32);
+    std::string cgj = std::string(40, 'x') + una::utf32to8(cgj32);
+    std::u16string str16 = una::utf8to16u(str);
+    std::u16string cgj16 = una::utf8to16u(cgj);
+
+    std::string buffer;
+    std::u16string buffer16;
+    TESTX(una::norm::to_nfc_utf8_view(std::string_view{str}, buffer) == cgj);
+    TESTX(una::norm::to_nfd_utf8_view(std::string_view{str}, buffer) == cgj);
+    TESTX(una::norm::to_nfc_utf16_view(std::u16string_view{str16}, buffer16) == cgj16);
+    TESTX(una::norm::to_nfd_utf16_view(std::u16string_view{str16}, buffer16) == cgj16);
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+    TESTX(una::norm::to_nfkc_utf8_view(std::string_view{str}, buffer) == cgj);
+    TESTX(una::norm::to_nfkd_utf8_view(std::string_view{str}, buffer) == cgj);
+    TESTX(una::norm::to_nfkc_utf16_view(std::u16string_view{str16}, buffer16) == cgj16);
+    TESTX(una::norm::to_nfkd_utf16_view(std::u16string_view{str16}, buffer16) == cgj16);
+#endif
+
+    // Already normalized with CGJ
+    TESTX(una::norm::to_nfc_utf8_view(std::string_view{cgj}, buffer).data() == cgj.data());
+    TESTX(una::norm::to_nfd_utf16_view(std::u16string_view{cgj16}, buffer16).data() == cgj16.data());
+
+    // 30 non-starters is fine
+    str = una::utf32to8(cgj32.substr(0, 31));
+    TESTX(una::norm::to_nfc_utf8_view(std::string_view{str}, buffer).data() == str.data());
+
+    // 00E0 has 1 trailing non-starter in NFKD so 29 more non-starters is the limit
+    str32 = U"\x00E0";
+    str32.append(30, 0x0315);
+    str = una::utf32to8(str32);
+    TESTX(una::norm::to_nfc_utf8_view(std::string_view{str}, buffer) == una::norm::to_nfc_utf8(str));
+    TESTX(una::norm::to_nfc_utf8(str).find("\xCD\x8F") != std::string::npos);
+
+    // FF9E is a starter in NFC/NFD but it has 1 initial non-starter in NFKD so it continues the run
+    str32 = U"a";
+    str32.append(20, 0x0315);
+    str32.append(1, 0xFF9E);
+    str32.append(20, 0x0315);
+    str = una::utf32to8(str32);
+    str16 = una::utf32to16u(str32);
+    TESTX(una::norm::to_nfc_utf8_view(std::string_view{str}, buffer) == una::norm::to_nfc_utf8(str));
+    TESTX(una::norm::to_nfd_utf8_view(std::string_view{str}, buffer) == una::norm::to_nfd_utf8(str));
+    TESTX(una::norm::to_nfc_utf16_view(std::u16string_view{str16}, buffer16) == una::norm::to_nfc_utf16(str16));
+    TESTX(una::norm::to_nfd_utf16_view(std::u16string_view{str16}, buffer16) == una::norm::to_nfd_utf16(str16));
+    TESTX(una::norm::to_nfc_utf8(str).find("\xCD\x8F") != std::string::npos);
+
+    // Random runs of non-starters
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<std::size_t> run{0, 50};
+    std::uniform_int_distribution<char32_t> mark{0x0300, 0x0315};
+    const char32_t starters[] = {0x0061, 0x00E0, 0x01D6, 0xFF9E, 0x0F77, 0x03B1};
+    std::uniform_int_distribution<std::size_t> starter{0, std::size(starters) - 1};
+    for (int n = 0; n < 200; ++n)
+    {
+        str32.clear();
+        for (int i = 0; i < 4; ++i)
+        {
+            str32.push_back(starters[starter(gen)]);
+            for (std::size_t j = run(gen); j > 0; --j)
+                str32.push_back(mark(gen));
+        }
+        str = una::utf32to8(str32);
+        TESTX(test_norm_view_all(str));
+    }
+
+    return true;
+}
@@ -0,0 +1,175 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Parallel functions test
+// The source is processed with small chunks by different executors
+// and the result must be the same as the result of the serial function.
+
+// Runs tasks in reverse order on the calling thread
+struct test_parallel_reverse_executor
+{
+    template<class Fn>
+    void operator()(std::size_t count, Fn task) const
+    {
+        for (std::size_t i = count; i > 0; --i)
+            task(i - 1);
+    }
+};
+
+template<class FnParallel, class Src, class Dst>
+bool test_parallel_compare(const Src& src, const Dst& whole, FnParallel fn)
+{
+    const std::size_t sizes[] = {1, 2, 3, 4, 5, 7, 13, 64};
+    for (std::size_t size : sizes)
+    {
+        if (fn(src, unx::thread_executor{4}, size) != whole)
+            return false;
+        if (fn(src, test_parallel_reverse_executor{}, size) != whole)
+            return false;
+    }
+    return true;
+}
+
+bool test_parallel_norm()
+{
+    std::mt19937 gen{42};
+
+    const std::size_t sizes[] = {0, 1, 10, 100, 1000};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 10; ++n)
+        {
+            std::u32string str32 = test_bounded_random_norm(gen, size);
+            std::string str = una::utf32to8(str32);
+            // Ill-formed sequences
+            if (n % 2 && str.size() > 2)
+            {
+                str.insert(str.size() / 2, "\xE2\x82");
+                str.insert(1, "\xCC");
+            }
+            const std::u16string u16str = una::utf8to16u(str);
+
+            TESTX(test_parallel_compare(str, una::norm::to_nfc_utf8(str),
+                [](std::string_view s, auto&& e, std::size_t k) { return unx::norm::to_nfc_utf8_parallel(s, e, k); }));
+            TESTX(test_parallel_compare(str, una::norm::to_nfd_utf8(str),
+                [](std::string_view s, auto&& e, std::size_t k) { return unx::norm::to_nfd_utf8_parallel(s, e, k); }));
+            TESTX(test_parallel_compare(u16str, una::norm::to_nfc_utf16(u16str),
+                [](std::u16string_view s, auto&& e, std::size_t k) { return unx::norm::to_nfc_utf16_parallel(s, e, k); }));
+            TESTX(test_parallel_compare(u16str, una::norm::to_nfd_utf16(u16str),
+                [](std::u16string_view s, auto&& e, std::size_t k) { return unx::norm::to_nfd_utf16_parallel(s, e, k); }));
+#ifndef UNI_ALGO_DISABLE_NFKC_NFKD
+            TESTX(test_parallel_compare(str, una::norm::to_nfkc_utf8(str),
+                [](std::string_view s, auto&& e, std::size_t k) { return unx::norm::to_nfkc_utf8_parallel(s, e, k); }));
+            TESTX(test_parallel_compare(str, una::norm::to_nfkd_utf8(str),
+                [](std::string_view s, auto&& e, std::size_t k) { return unx::norm::to_nfkd_utf8_parallel(s, e, k); }));
+            TESTX(test_parallel_compare(u16str, una::norm::to_nfkc_utf16(u16str),
+                [](std::u16string_view s, auto&& e, std::size_t k) { return unx::norm::to_nfkc_utf16_parallel(s, e, k); }));
+            TESTX(test_parallel_compare(u16str, una::norm::to_nfkd_utf16(u16str),
+                [](std::u16string_view s, auto&& e, std::size_t k) { return unx::norm::to_nfkd_utf16_parallel(s, e, k); }));
+#endif
+        }
+    }
+
+    // No boundaries for a long time
+    std::string marks = "a";
+    for (int i = 0; i < 1000; ++i)
+        marks += "\xCC\x81";
+    marks += "a\xCC\x81";
+    TESTX(test_parallel_compare(marks, una::norm::to_nfc_utf8(marks),
+        [](std::string_view s, auto&& e, std::size_t k) { return unx::norm::to_nfc_utf8_parallel(s, e, k); }));
+
+    // FF9E with initial non-starter in NFKD within a run of non-starters is not a boundary
+    std::u32string run32 = U"a";
+    run32.append(20, 0x0315);
+    run32.append(1, 0xFF9E);
+    run32.append(20, 0x0315);
+    const std::string run = una::utf32to8(run32);
+    TESTX(test_parallel_compare(run, una::norm::to_nfc_utf8(run),
+        [](std::string_view s, auto&& e, std::size_t k) { return unx::norm::to_nfc_utf8_parallel(s, e, k); }));
+    TESTX(test_parallel_compare(run, una::norm::to_nfd_utf8(run),
+        [](std::string_view s, auto&& e, std::size_t k) { return unx::norm::to_nfd_utf8_parallel(s, e, k); }));
+
+    // Default chunk size and executor
+    std::string big;
+    while (big.size() < 3 * 1024 * 1024)
+        big += una::utf32to8(test_bounded_random_norm(gen, 1000));
+    TESTX(unx::norm::to_nfc_utf8_parallel(big) == una::norm::to_nfc_utf8(big));
+    TESTX(unx::norm::to_nfd_utf8_parallel(big) == una::norm::to_nfd_utf8(big));
+
+    return true;
+}
+
+template<class FnParallel, class Src, class Dst>
+bool test_parallel_compare_strict(const Src& src, const Dst& whole, const una::error& whole_error, FnParallel fn)
+{
+    const std::size_t sizes[] = {1, 2, 3, 4, 5, 7, 13, 64};
+    for (std::size_t size : sizes)
+    {
+        una::error error;
+        if (fn(src, error, unx::thread_executor{4}, size) != whole)
+            return false;
+        if (error.get_code() != whole_error.get_code() || (error && error.pos() != whole_error.pos()))
+            return false;
+        if (fn(src, error, test_parallel_reverse_executor{}, size) != whole)
+            return false;
+        if (error.get_code() != whole_error.get_code() || (error && error.pos() != whole_error.pos()))
+            return false;
+    }
+    return true;
+}
+
+bool test_parallel_conv()
+{
+    std::mt19937 gen{42};
+
+    const std::string bad[] = {"\x80", "\xC2", "\xE2\x82", "\xF0\x9F\x98", "\xFF", "\xED\xA0\x80"};
+    std::uniform_int_distribution<std::size_t> index{0, std::size(bad) - 1};
+
+    const std::size_t sizes[] = {0, 1, 10, 100, 1000};
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 10; ++n)
+        {
+            std::string str = test_simd_random_utf8(gen, size);
+            std::u16string u16str = una::utf8to16u(str);
+            // Ill-formed sequences in the second half so valid chunks are before the error
+            if (n % 2)
+            {
+                std::uniform_int_distribution<std::size_t> pos{str.size() / 2, str.size()};
+                str.insert(pos(gen), bad[index(gen)]);
+                str.insert(pos(gen), bad[index(gen)]);
+                std::uniform_int_distribution<std::size_t> pos16{u16str.size() / 2, u16str.size()};
+                u16str.insert(pos16(gen), 1, u'\xDC00');
+                u16str.insert(pos16(gen), 1, u'\xD800');
+            }
+
+            TESTX(test_parallel_compare(str, una::utf8to16u(str),
+                [](std::string_view s, auto&& e, std::size_t k) { return unx::utf8to16_parallel<char, char16_t>(s, e, k); }));
+            TESTX(test_parallel_compare(str, una::utf8to32u(str),
+                [](std::string_view s, auto&& e, std::size_t k) { return unx::utf8to32_parallel<char, char32_t>(s, e, k); }));
+            TESTX(test_parallel_compare(u16str, una::utf16to8(u16str),
+                [](std::u16string_view s, auto&& e, std::size_t k) { return unx::utf16to8_parallel<char16_t, char>(s, e, k); }));
+
+            una::error error;
+            std::u16string result16 = una::strict::utf8to16u(str, error);
+            TESTX(test_parallel_compare_strict(str, result16, error,
+                [](std::string_view s, una::error& r, auto&& e, std::size_t k) { return unx::strict::utf8to16_parallel<char, char16_t>(s, r, e, k); }));
+            std::u32string result32 = una::strict::utf8to32u(str, error);
+            TESTX(test_parallel_compare_strict(str, result32, error,
+                [](std::string_view s, una::error& r, auto&& e, std::size_t k) { return unx::strict::utf8to32_parallel<char, char32_t>(s, r, e, k); }));
+            std::string result8 = una::strict::utf16to8(u16str, error);
+            TESTX(test_parallel_compare_strict(u16str, result8, error,
+                [](std::u16string_view s, una::error& r, auto&& e, std::size_t k) { return unx::strict::utf16to8_parallel<char16_t, char>(s, r, e, k); }));
+        }
+    }
+
+    // Default chunk size and executor
+    const std::string big = test_simd_random_utf8(gen, 3 * 1024 * 1024);
+    TESTX(unx::utf8to16u_parallel(big) == una::utf8to16u(big));
+    TESTX(unx::utf8to32u_parallel(big) == una::utf8to32u(big));
+    una::error error;
+    TESTX(unx::strict::utf8to16u_parallel(big + "\xFF", error).empty() && error && error.pos() == big.size());
+
+    return true;
+}
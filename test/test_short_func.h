@@ -99,6 +99,85 @@ test_constexpr bool test_short_func_conv()
 #endif // WCHAR_MAX >= 0x7FFFFFFF
 #endif // __cpp_lib_char8_t
 
+//---------------------------------------------
+// Repeat prev tests with una::exact namespace
+//---------------------------------------------
+    TESTX(una::exact::utf8to16u(str) == u16str);
+    TESTX(una::exact::utf8to32u(str) == u32str);
+
+    TESTX(una::exact::utf16to8(u16str) == str);
+    TESTX(una::exact::utf32to8(u32str) == str);
+
+    TESTX(una::exact::utf16to32u(u16str) == u32str);
+    TESTX(una::exact::utf32to16u(u32str) == u16str);
+
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+    TESTX(una::exact::utf8to16(str) == wstr);
+    TESTX(una::exact::utf16to8(wstr) == str);
+
+    TESTX(una::exact::utf16to32u(wstr) == u32str);
+    TESTX(una::exact::utf32to16(u32str) == wstr);
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+    TESTX(una::exact::utf8to32(str) == wstr);
+    TESTX(una::exact::utf32to8(wstr) == str);
+
+    TESTX(una::exact::utf16to32(u16str) == wstr);
+    TESTX(una::exact::utf32to16u(wstr) == u16str);
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+
+#ifdef __cpp_lib_char8_t
+    TESTX(una::exact::utf8to16u(u8str) == u16str);
+    TESTX(una::exact::utf8to32u(u8str) == u32str);
+
+    TESTX(una::exact::utf16to8u(u16str) == u8str);
+    TESTX(una::exact::utf32to8u(u32str) == u8str);
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+    TESTX(una::exact::utf8to16(u8str) == wstr);
+    TESTX(una::exact::utf16to8u(wstr) == u8str);
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+    TESTX(una::exact::utf8to32(u8str) == wstr);
+    TESTX(una::exact::utf32to8u(wstr) == u8str);
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+#endif // __cpp_lib_char8_t
+
+    TESTX(una::exact::strict::utf8to16u(str, error) == u16str);
+    TESTX(una::exact::strict::utf8to32u(str, error) == u32str);
+
+    TESTX(una::exact::strict::utf16to8(u16str, error) == str);
+    TESTX(una::exact::strict::utf32to8(u32str, error) == str);
+
+    TESTX(una::exact::strict::utf16to32u(u16str, error) == u32str);
+    TESTX(una::exact::strict::utf32to16u(u32str, error) == u16str);
+
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+    TESTX(una::exact::strict::utf8to16(str, error) == wstr);
+    TESTX(una::exact::strict::utf16to8(wstr, error) == str);
+
+    TESTX(una::exact::strict::utf16to32u(wstr, error) == u32str);
+    TESTX(una::exact::strict::utf32to16(u32str, error) == wstr);
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+    TESTX(una::exact::strict::utf8to32(str, error) == wstr);
+    TESTX(una::exact::strict::utf32to8(wstr, error) == str);
+
+    TESTX(una::exact::strict::utf16to32(u16str, error) == wstr);
+    TESTX(una::exact::strict::utf32to16u(wstr, error) == u16str);
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+
+#ifdef __cpp_lib_char8_t
+    TESTX(una::exact::strict::utf8to16u(u8str, error) == u16str);
+    TESTX(una::exact::strict::utf8to32u(u8str, error) == u32str);
+
+    TESTX(una::exact::strict::utf16to8u(u16str, error) == u8str);
+    TESTX(una::exact::strict::utf32to8u(u32str, error) == u8str);
+#if WCHAR_MAX >= 0x7FFF && WCHAR_MAX <= 0xFFFF // 16-bit wchar_t
+    TESTX(una::exact::strict::utf8to16(u8str, error) == wstr);
+    TESTX(una::exact::strict::utf16to8u(wstr, error) == u8str);
+#elif WCHAR_MAX >= 0x7FFFFFFF // 32-bit wchar_t
+    TESTX(una::exact::strict::utf8to32(u8str, error) == wstr);
+    TESTX(una::exact::strict::utf32to8u(wstr, error) == u8str);
+#endif // WCHAR_MAX >= 0x7FFFFFFF
+#endif // __cpp_lib_char8_t
+
 //---------------------------------------------
 // Validation functions
 //---------------------------------------------
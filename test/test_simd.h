@@ -0,0 +1,420 @@
+/* Test for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// SIMD fast paths test
+// Everything is compared with low-level directly because it never uses SIMD
+
+std::string test_simd_random_utf8(std::mt19937& gen, std::size_t size)
+{
+    // Mostly ASCII with all lengths of sequences to test blocks that are not ASCII-only too
+    std::uniform_int_distribution<int> kind{0, 9};
+    std::uniform_int_distribution<char32_t> ascii{0x00, 0x7F};
+    std::uniform_int_distribution<char32_t> two{0x80, 0x7FF};
+    std::uniform_int_distribution<char32_t> three{0x800, 0xFFFF};
+    std::uniform_int_distribution<char32_t> four{0x10000, 0x10FFFF};
+
+    std::u32string str32;
+    while (str32.size() < size)
+    {
+        const int k = kind(gen);
+        char32_t c = 0;
+        if (k < 6)
+            c = ascii(gen);
+        else if (k == 6)
+            c = two(gen);
+        else if (k < 9)
+            c = three(gen);
+        else
+            c = four(gen);
+        if (c >= 0xD800 && c <= 0xDFFF)
+            c = 0xFFFD;
+        str32.push_back(c);
+    }
+    return una::utf32to8<char32_t, char>(str32);
+}
+
+bool test_simd_valid_utf8_compare(const std::string& str)
+{
+    std::size_t pos = una::detail::impl_npos;
+    const bool valid = una::detail::impl_is_valid_utf8(str.cbegin(), str.cend(), &pos);
+
+    una::error error;
+    if (una::is_valid_utf8(str) != valid || una::is_valid_utf8(str, error) != valid)
+        return false;
+    if (!valid && (!error || error.pos() != pos))
+        return false;
+    return true;
+}
+
+bool test_simd_valid_utf8()
+{
+    std::mt19937 gen{42};
+
+    const std::string bad[] = {
+        "\x80", "\xBF", "\xC0\x80", "\xC1\xBF", "\xC2", "\xE0\x80\x80", "\xE0\x9F\xBF", "\xED\xA0\x80",
+        "\xED\xBF\xBF", "\xE1\x80", "\xF0\x80\x80\x80", "\xF0\x8F\xBF\xBF", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80",
+        "\xF8", "\xFF", "\xF1\x80\x80", "\xC2\xC2", "\xE1\x80\xC2", "\xF1\x80\x80\x80\x80"
+    };
+
+    const std::size_t sizes[] = {15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 257};
+
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 10; ++n)
+        {
+            const std::string str = test_simd_random_utf8(gen, size);
+            TESTX(una::is_valid_utf8(str));
+            TESTX(test_simd_valid_utf8_compare(str));
+
+            for (std::size_t i = 0; i <= str.size(); ++i)
+            {
+                // Truncated
+                TESTX(test_simd_valid_utf8_compare(str.substr(0, i)));
+
+                // Ill-formed sequence inserted at every position
+                for (const std::string& b : bad)
+                {
+                    std::string s = str;
+                    s.insert(i, b);
+                    TESTX(test_simd_valid_utf8_compare(s));
+                }
+
+                // Byte replaced at every position
+                if (i < str.size())
+                {
+                    for (char c : {'\x80', '\xC3', '\xE2', '\xF0', '\xFF', 'a'})
+                    {
+                        std::string s = str;
+                        s[i] = c;
+                        TESTX(test_simd_valid_utf8_compare(s));
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+template<typename UTFX, std::size_t SizeX, std::size_t(*FnUTF)(std::string::const_iterator, std::string::const_iterator,
+                                                              typename std::basic_string<UTFX>::iterator, std::size_t*)>
+bool test_simd_utf8to_compare(const std::string& str)
+{
+    // Lenient
+    std::basic_string<UTFX> ref(str.size() * SizeX, 0);
+    ref.resize(FnUTF(str.cbegin(), str.cend(), ref.begin(), nullptr));
+
+    std::basic_string<UTFX> result;
+    if constexpr (sizeof(UTFX) == sizeof(char16_t))
+        result = una::utf8to16<char, UTFX>(str);
+    else
+        result = una::utf8to32<char, UTFX>(str);
+    if (result != ref)
+        return false;
+
+    // Strict
+    std::size_t pos = una::detail::impl_npos;
+    std::basic_string<UTFX> ref_strict(str.size() * SizeX, 0);
+    ref_strict.resize(FnUTF(str.cbegin(), str.cend(), ref_strict.begin(), &pos));
+
+    una::error error;
+    if constexpr (sizeof(UTFX) == sizeof(char16_t))
+        result = una::strict::utf8to16<char, UTFX>(str, error);
+    else
+        result = una::strict::utf8to32<char, UTFX>(str, error);
+    if (pos == una::detail::impl_npos)
+        return !error && result == ref_strict;
+    return error && error.pos() == pos && result.empty();
+}
+
+bool test_simd_utf8to16_utf8to32_compare(const std::string& str)
+{
+    using it8 = std::string::const_iterator;
+    using it16 = std::u16string::iterator;
+    using it32 = std::u32string::iterator;
+
+    return test_simd_utf8to_compare<char16_t, una::detail::impl_x_utf8to16, una::detail::impl_utf8to16<it8, it8, it16>>(str) &&
+           test_simd_utf8to_compare<char32_t, una::detail::impl_x_utf8to32, una::detail::impl_utf8to32<it8, it8, it32>>(str);
+}
+
+bool test_simd_ascii_utf8to16_utf8to32()
+{
+    std::mt19937 gen{42};
+
+    const std::string ascii = "{\"key\": \"value\", \"number\": 12345, \"array\": [1, 2, 3], \"bool\": true}";
+    const std::string other[] = {"\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\x80", "\xE2\x82", "\xF0\x9F\x98", "\xFF"};
+
+    for (std::size_t n = 0; n < 200; ++n)
+    {
+        std::string str;
+        std::uniform_int_distribution<std::size_t> run{0, 70};
+        std::uniform_int_distribution<std::size_t> pick{0, std::size(other) - 1};
+        while (str.size() < 300)
+        {
+            str += ascii.substr(0, run(gen));
+            str += other[pick(gen)];
+        }
+
+        TESTX(test_simd_utf8to16_utf8to32_compare(str));
+
+        // All lengths to test all possible tails
+        for (std::size_t i = 0; i <= 100; ++i)
+            TESTX(test_simd_utf8to16_utf8to32_compare(str.substr(0, i)));
+    }
+
+    TESTX(una::utf8to16u(ascii + ascii) == una::utf8to16u(ascii) + una::utf8to16u(ascii));
+    TESTX(una::utf8to16u(ascii + "\xC3\xA9" + ascii) == una::utf8to16u(ascii) + u"\x00E9" + una::utf8to16u(ascii));
+    TESTX(una::utf8to32u(ascii + "\xF0\x9F\x98\x80" + ascii) == una::utf8to32u(ascii) + U"\x0001F600" + una::utf8to32u(ascii));
+
+    return true;
+}
+
+bool test_simd_utf8to16()
+{
+    std::mt19937 gen{42};
+
+    // Cyrillic, CJK and mixed text with 4-byte sequences
+    const std::u32string text[] = {
+        U"Съешь же ещё этих мягких французских булок, да выпей чаю. ",
+        U"色は匂へど散りぬるを我が世誰ぞ常ならん有為の奥山今日越えて浅き夢見じ酔ひもせず",
+        U"Ünïcödé テキスト with 😀 emoji and Ελληνικά 𝔘𝔫𝔦𝔠𝔬𝔡𝔢 ",
+    };
+
+    for (const std::u32string& t : text)
+    {
+        std::u32string str32;
+        while (str32.size() < 5000) // More than validator part size
+            str32 += t;
+        const std::string str = una::utf32to8<char32_t, char>(str32);
+
+        TESTX((una::utf8to16<char, char16_t>(str) == una::utf32to16<char32_t, char16_t>(str32)));
+        TESTX(test_simd_utf8to16_utf8to32_compare(str));
+
+        // Ill-formed and truncated at different positions
+        for (std::size_t i = 0; i < 200; ++i)
+        {
+            std::uniform_int_distribution<std::size_t> pos{0, str.size() - 1};
+            std::string s = str;
+            s[pos(gen)] = static_cast<char>(i);
+            TESTX(test_simd_utf8to16_utf8to32_compare(s));
+            TESTX(test_simd_utf8to16_utf8to32_compare(str.substr(0, pos(gen))));
+        }
+    }
+
+    for (std::size_t n = 0; n < 100; ++n)
+    {
+        const std::string str = test_simd_random_utf8(gen, 200);
+        for (std::size_t i = 0; i < str.size(); ++i)
+        {
+            std::string s = str;
+            s[i] = '\x80';
+            TESTX(test_simd_utf8to16_utf8to32_compare(s));
+        }
+    }
+
+    return true;
+}
+
+template<typename Dst, typename Src>
+bool test_simd_exact_compare(const Src& src)
+{
+    using src_t = typename Src::value_type;
+    using dst_t = typename Dst::value_type;
+
+    Dst result, result_exact, result_strict, result_strict_exact;
+    una::error error, error_exact;
+
+    if constexpr (sizeof(src_t) == sizeof(char) && sizeof(dst_t) == sizeof(char16_t))
+    {
+        result = una::utf8to16<src_t, dst_t>(src);
+        result_exact = una::exact::utf8to16<src_t, dst_t>(src);
+        result_strict = una::strict::utf8to16<src_t, dst_t>(src, error);
+        result_strict_exact = una::exact::strict::utf8to16<src_t, dst_t>(src, error_exact);
+    }
+    else if constexpr (sizeof(src_t) == sizeof(char))
+    {
+        result = una::utf8to32<src_t, dst_t>(src);
+        result_exact = una::exact::utf8to32<src_t, dst_t>(src);
+        result_strict = una::strict::utf8to32<src_t, dst_t>(src, error);
+        result_strict_exact = una::exact::strict::utf8to32<src_t, dst_t>(src, error_exact);
+    }
+    else if constexpr (sizeof(src_t) == sizeof(char16_t) && sizeof(dst_t) == sizeof(char))
+    {
+        result = una::utf16to8<src_t, dst_t>(src);
+        result_exact = una::exact::utf16to8<src_t, dst_t>(src);
+        result_strict = una::strict::utf16to8<src_t, dst_t>(src, error);
+        result_strict_exact = una::exact::strict::utf16to8<src_t, dst_t>(src, error_exact);
+    }
+    else if constexpr (sizeof(src_t) == sizeof(char16_t))
+    {
+        result = una::utf16to32<src_t, dst_t>(src);
+        result_exact = una::exact::utf16to32<src_t, dst_t>(src);
+        result_strict = una::strict::utf16to32<src_t, dst_t>(src, error);
+        result_strict_exact = una::exact::strict::utf16to32<src_t, dst_t>(src, error_exact);
+    }
+    else if constexpr (sizeof(dst_t) == sizeof(char))
+    {
+        result = una::utf32to8<src_t, dst_t>(src);
+        result_exact = una::exact::utf32to8<src_t, dst_t>(src);
+        result_strict = una::strict::utf32to8<src_t, dst_t>(src, error);
+        result_strict_exact = una::exact::strict::utf32to8<src_t, dst_t>(src, error_exact);
+    }
+    else
+    {
+        result = una::utf32to16<src_t, dst_t>(src);
+        result_exact = una::exact::utf32to16<src_t, dst_t>(src);
+        result_strict = una::strict::utf32to16<src_t, dst_t>(src, error);
+        result_strict_exact = una::exact::strict::utf32to16<src_t, dst_t>(src, error_exact);
+    }
+
+    if (result != result_exact || result_strict != result_strict_exact)
+        return false;
+    if (error)
+        return error_exact && error.pos() == error_exact.pos();
+    return !error_exact;
+}
+
+bool test_simd_exact_compare_utf8(const std::string& str)
+{
+    return test_simd_exact_compare<std::u16string>(str) && test_simd_exact_compare<std::u32string>(str);
+}
+
+bool test_simd_exact_compare_utf16(const std::u16string& str)
+{
+    return test_simd_exact_compare<std::string>(str) && test_simd_exact_compare<std::u32string>(str);
+}
+
+bool test_simd_exact_compare_utf32(const std::u32string& str)
+{
+    return test_simd_exact_compare<std::string>(str) && test_simd_exact_compare<std::u16string>(str);
+}
+
+bool test_simd_exact()
+{
+    std::mt19937 gen{42};
+
+    const std::size_t sizes[] = {0, 1, 7, 8, 9, 15, 16, 17, 33, 100, 300, 5000};
+
+    for (std::size_t size : sizes)
+    {
+        for (int n = 0; n < 10; ++n)
+        {
+            const std::string str = test_simd_random_utf8(gen, size);
+            const std::u16string u16str = una::utf8to16<char, char16_t>(str);
+            const std::u32string u32str = una::utf8to32<char, char32_t>(str);
+            TESTX(test_simd_exact_compare_utf8(str));
+            TESTX(test_simd_exact_compare_utf16(u16str));
+            TESTX(test_simd_exact_compare_utf32(u32str));
+
+            if (str.empty())
+                continue;
+
+            // Ill-formed UTF-8 and truncated
+            std::uniform_int_distribution<std::size_t> pos{0, str.size() - 1};
+            for (std::size_t i = 0; i < 50; ++i)
+            {
+                std::string s = str;
+                s[pos(gen)] = static_cast<char>(i + 0x80);
+                TESTX(test_simd_exact_compare_utf8(s));
+                TESTX(test_simd_exact_compare_utf8(str.substr(0, pos(gen))));
+            }
+
+            // Unpaired surrogates in UTF-16 and ill-formed UTF-32
+            for (std::size_t i = 0; i < 20; ++i)
+            {
+                std::u16string s16 = u16str;
+                s16.insert(std::min(pos(gen), s16.size()), 1, (i % 2) ? u'\xD800' : u'\xDFFF');
+                TESTX(test_simd_exact_compare_utf16(s16));
+
+                std::u32string s32 = u32str;
+                s32.insert(std::min(pos(gen), s32.size()), 1, (i % 2) ? U'\xD800' : static_cast<char32_t>(0x110000));
+                TESTX(test_simd_exact_compare_utf32(s32));
+            }
+        }
+    }
+
+    return true;
+}
+
+bool test_simd_case_map_compare(const std::string& str)
+{
+    using it8 = std::string::const_iterator;
+    using out8 = std::string::iterator;
+
+    for (int mode : {una::detail::impl_case_map_mode_lowercase,
+                     una::detail::impl_case_map_mode_uppercase,
+                     una::detail::impl_case_map_mode_casefold})
+    {
+        std::string ref(str.size() * una::detail::impl_x_case_map_utf8, 0);
+        ref.resize(una::detail::impl_case_map_utf8<it8, it8, out8>(str.cbegin(), str.cend(), ref.begin(), mode));
+
+        std::string result, append = "prefix";
+        std::size_t written = 0;
+        if (mode == una::detail::impl_case_map_mode_lowercase)
+        {
+            result = una::cases::to_lowercase_utf8(str);
+            written = una::cases::to_lowercase_utf8<char>(str, append);
+        }
+        else if (mode == una::detail::impl_case_map_mode_uppercase)
+        {
+            result = una::cases::to_uppercase_utf8(str);
+            written = una::cases::to_uppercase_utf8<char>(str, append);
+        }
+        else
+        {
+            result = una::cases::to_casefold_utf8(str);
+            written = una::cases::to_casefold_utf8<char>(str, append);
+        }
+        if (result != ref || append != "prefix" + ref || written != ref.size())
+            return false;
+    }
+    return true;
+}
+
+bool test_simd_case_map()
+{
+    std::mt19937 gen{42};
+
+    // Final_Sigma depends on the text before it so put it after ASCII of different lengths
+    const std::string ascii = "The Quick Brown Fox Jumps Over The Lazy Dog 0123456789 ";
+    const std::string other[] = {"\xCE\xA3", "\xCE\xA3 ", "'\xCE\xA3", "\xC3\x9F", "\xC4\xB0", "\xE1\xBA\x9E",
+                                 "\xEF\xAC\x80", "\xE2\x84\xAA", "\x80", "\xCE", "\xFF"};
+
+    for (std::size_t n = 0; n < 200; ++n)
+    {
+        std::string str;
+        std::uniform_int_distribution<std::size_t> run{0, 70};
+        std::uniform_int_distribution<std::size_t> pick{0, std::size(other) - 1};
+        while (str.size() < 300)
+        {
+            str += ascii.substr(0, run(gen));
+            str += other[pick(gen)];
+        }
+
+        TESTX(test_simd_case_map_compare(str));
+
+        // All lengths to test all possible tails
+        for (std::size_t i = 0; i <= 100; ++i)
+            TESTX(test_simd_case_map_compare(str.substr(0, i)));
+    }
+
+    for (std::size_t n = 0; n < 50; ++n)
+        TESTX(test_simd_case_map_compare(test_simd_random_utf8(gen, 300)));
+
+    // Final_Sigma looks back through case-ignorable characters so the cased letter can be far before it
+    const std::string a(40, 'A');
+    const std::string dots(40, '.');
+    TESTX(una::cases::to_lowercase_utf8(a + "\xCE\xA3") == std::string(40, 'a') + "\xCF\x82");
+    TESTX(una::cases::to_lowercase_utf8(a + dots + "\xCE\xA3") == std::string(40, 'a') + dots + "\xCF\x82");
+    TESTX(una::cases::to_lowercase_utf8(dots + dots + "\xCE\xA3") == dots + dots + "\xCF\x83");
+    TESTX(una::cases::to_lowercase_utf8(a + "1" + dots + "\xCE\xA3") == std::string(40, 'a') + "1" + dots + "\xCF\x83");
+    TESTX(una::cases::to_lowercase_utf8(a + dots + "\xCE\xA3" + a) == std::string(40, 'a') + dots + "\xCF\x83" + std::string(40, 'a'));
+
+    // Locale case mapping never uses the fast path
+    TESTX(una::cases::to_uppercase_utf8(a + "i" + a, una::locale{"tr"}) == a + "\xC4\xB0" + a);
+    TESTX(una::cases::to_lowercase_utf8(a + "I", una::locale{"tr"}) == std::string(40, 'a') + "\xC4\xB1");
+    TESTX(una::cases::to_lowercase_utf8(a + "I\xCC\x87", una::locale{"tr"}) == std::string(40, 'a') + "i");
+
+    return true;
+}
@@ -0,0 +1,54 @@
+/* File transform tool for Unicode Algorithms Implementation.
+ * License: Public Domain or MIT - choose whatever you want.
+ * See LICENSE.md */
+
+// Memory maps a UTF-8 file and writes the transformed data to another file chunk by chunk
+// so the memory usage does not depend on the file size. See uni_algo/ext/file.h
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <cstdlib>
+
+#include "../include/uni_algo/ext/file.h"
+
+int main(int argc, char* argv[])
+{
+    if (argc < 4 || argc > 5)
+    {
+        std::cerr << "Usage: uni-algo-file <utf8to16|nfc|lower|upper|fold> <input> <output> [chunk size in KiB]" << '\n';
+        return 2;
+    }
+
+    const std::string_view name = argv[1];
+
+    unx::file_transform mode = unx::file_transform::nfc;
+    if (name == "utf8to16")
+        mode = unx::file_transform::utf8to16;
+    else if (name == "nfc")
+        mode = unx::file_transform::nfc;
+    else if (name == "lower")
+        mode = unx::file_transform::lowercase;
+    else if (name == "upper")
+        mode = unx::file_transform::uppercase;
+    else if (name == "fold")
+        mode = unx::file_transform::casefold;
+    else
+    {
+        std::cerr << "Unknown transform: " << name << '\n';
+        return 2;
+    }
+
+    std::size_t chunk_size = unx::file_chunk_size;
+    if (argc == 5)
+        chunk_size = static_cast<std::size_t>(std::strtoull(argv[4], nullptr, 10)) * 1024;
+
+    const std::error_code ec = unx::transform_file(argv[2], argv[3], mode, chunk_size);
+    if (ec)
+    {
+        std::cerr << "Error: " << ec.message() << '\n';
+        return 1;
+    }
+
+    return 0;
+}